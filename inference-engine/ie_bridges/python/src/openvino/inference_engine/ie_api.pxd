@@ -33,13 +33,13 @@ cdef class InferRequest:
 
     cpdef BlobBuffer _get_blob_buffer(self, const string & blob_name)
 
-    cpdef infer(self, inputs = ?)
-    cpdef async_infer(self, inputs = ?)
+    cpdef infer(self, inputs = ?, share_inputs = ?)
+    cpdef async_infer(self, inputs = ?, share_inputs = ?)
     cpdef wait(self, timeout = ?)
     cpdef get_perf_counts(self)
     cdef void user_callback(self, int status) with gil
     cdef public:
-        _inputs_list, _outputs_list, _py_callback, _py_data, _user_blobs, _inputs_is_dynamic
+        _inputs_list, _outputs_list, _py_callback, _py_data, _user_blobs, _inputs_is_dynamic, _shared_inputs
 
 cdef class IENetwork:
     cdef C.IENetwork impl
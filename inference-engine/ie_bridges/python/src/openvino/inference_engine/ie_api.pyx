@@ -879,6 +879,8 @@ cdef class ExecutableNetwork:
     #  Wraps `infer()` method of the `InferRequest` class
     #  @param inputs:  A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
     #                  input data for the layer
+    #  @param share_inputs: If `True`, the arrays are used as input blobs memory without copying when possible,
+    #                       see `infer()` method of the `InferRequest` class
     #  @return A dictionary that maps output layer names to `numpy.ndarray` objects with output data of the layer
     #
     #  Usage example:\n
@@ -895,9 +897,9 @@ cdef class ExecutableNetwork:
     #                  ......
     #                 ]])}
     #  ```
-    def infer(self, inputs=None):
+    def infer(self, inputs=None, share_inputs=False):
         current_request = self.requests[0]
-        current_request.infer(inputs)
+        current_request.infer(inputs, share_inputs)
         res = {}
         for name, value in current_request.output_blobs.items():
             res[name] = deepcopy(value.buffer)
@@ -908,6 +910,8 @@ cdef class ExecutableNetwork:
     #  @param request_id: Index of infer request to start inference
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper
     #                 shape with input data for the layer
+    #  @param share_inputs: If `True`, the arrays are used as input blobs memory without copying when possible,
+    #                       see `async_infer()` method of the `InferRequest` class
     #  @return A handler of specified infer request, which is an instance of the `InferRequest` class.
     #
     #  Usage example:\n
@@ -916,11 +920,11 @@ cdef class ExecutableNetwork:
     #  infer_status = infer_request_handle.wait()
     #  res = infer_request_handle.output_blobs[out_blob_name]
     #  ```
-    def start_async(self, request_id, inputs=None):
+    def start_async(self, request_id, inputs=None, share_inputs=False):
         if request_id not in list(range(len(self.requests))):
             raise ValueError("Incorrect request_id specified!")
         current_request = self.requests[request_id]
-        current_request.async_infer(inputs)
+        current_request.async_infer(inputs, share_inputs)
         return current_request
 
     ## A tuple of `InferRequest` instances
@@ -1060,6 +1064,16 @@ cdef class ExecutableNetwork:
 
 ctypedef extern void (*cb_type)(void*, int) with gil
 
+# Checks if the array can be used as a memory of the blob with the given TensorDesc without copying
+def _can_share_memory(array : np.ndarray, tensor_desc : TensorDesc):
+    # the elements of these precisions don't match numpy types, for the layouts with
+    # channels last the order of the blob dims differs from the memory order
+    if tensor_desc.precision in ("BF16", "BIN", "I4", "U4") or tensor_desc.layout in ("NHWC", "NDHWC", "HWC"):
+        return False
+    return (array.flags['C_CONTIGUOUS'] and array.flags['ALIGNED'] and
+            array.dtype == format_map[tensor_desc.precision] and
+            tuple(array.shape) == tuple(tensor_desc.dims))
+
 ## This class provides an interface to infer requests of `ExecutableNetwork` and serves to handle infer requests execution
 #  and to set and get output data.
 cdef class InferRequest:
@@ -1073,6 +1087,7 @@ cdef class InferRequest:
         self._py_callback = lambda *args, **kwargs: None
         self._py_data = None
         self._inputs_is_dynamic = {}
+        self._shared_inputs = set()
 
     cdef void user_callback(self, int status) with gil:
         if self._py_callback:
@@ -1127,6 +1142,10 @@ cdef class InferRequest:
     def output_blobs(self):
         output_blobs = {}
         for output in self._outputs_list:
+            # bound output arrays are returned as is, the data is already in the user memory
+            if output in self._user_blobs:
+                output_blobs[output] = self._user_blobs[output]
+                continue
             blob = Blob()
             blob._ptr = deref(self.impl).getBlobPtr(output.encode())
             output_blobs[output] = deepcopy(blob)
@@ -1179,10 +1198,42 @@ cdef class InferRequest:
         else:
             deref(self.impl).setBlob(blob_name.encode(), blob._ptr)
         self._user_blobs[blob_name] = blob
+        self._shared_inputs.discard(blob_name)
+
+    ## Binds numpy array as the memory of output blob, so the following inferences write the output data
+    #  directly to the array
+    #
+    #  \note The array has to be C-contiguous and aligned, have the shape and the element type of the output.
+    #        The array must not be modified or deleted while the inference is running.
+    #
+    #  @param output_name: A name of output blob
+    #  @param array: numpy.ndarray to store the output data to
+    #  @return None
+    #
+    #  Usage example:\n
+    #  ```python
+    #  exec_net = ie_core.load_network(network=net, device_name="CPU", num_requests=2)
+    #  res = np.zeros(shape=(1, 1000), dtype=np.float32)
+    #  exec_net.requests[0].bind_output("prob", res)
+    #  exec_net.requests[0].infer({input_blob: image})
+    #  ```
+    def bind_output(self, output_name : str, array : np.ndarray):
+        assert output_name in self._outputs_list, f"No output with name {output_name} found in network"
+        output_blob = Blob()
+        output_blob._ptr = deref(self.impl).getBlobPtr(output_name.encode())
+        tensor_desc = output_blob.tensor_desc
+        if not _can_share_memory(array, tensor_desc):
+            raise ValueError(f"Array of shape {array.shape} and type {array.dtype} can't be bound to output "
+                             f"{output_name}. C-contiguous aligned array of shape {tuple(tensor_desc.dims)} and "
+                             f"type {np.dtype(format_map[tensor_desc.precision])} is expected")
+        self.set_blob(output_name, Blob(tensor_desc, array))
     ## Starts synchronous inference of the infer request and fill outputs array
     #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
     #                 input data for the layer
+    #  @param share_inputs: If `True`, C-contiguous aligned arrays of the input shape and element type are set
+    #                       as input blobs without copying, the other arrays are copied. The shared arrays stay
+    #                       bound to the request until the inputs are set again.
     #  @return None
     #
     #  Usage example:\n
@@ -1195,15 +1246,18 @@ cdef class InferRequest:
     #         5.45198545e-02, 2.44456064e-02, 5.41366823e-03, 3.42589128e-03,
     #         2.26027006e-03, 2.12283316e-03 ...])
     #  ```
-    cpdef infer(self, inputs=None):
+    cpdef infer(self, inputs=None, share_inputs=False):
         if inputs is not None:
-            self._fill_inputs(inputs)
+            self._fill_inputs(inputs, share_inputs)
         with nogil:
             deref(self.impl).infer()
 
     ## Starts asynchronous inference of the infer request and fill outputs array
     #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with input data for the layer
+    #  @param share_inputs: If `True`, C-contiguous aligned arrays of the input shape and element type are set
+    #                       as input blobs without copying, the other arrays are copied. The shared arrays must not
+    #                       be modified or deleted until the request is completed.
     #  @return: None
     #
     #  Usage example:\n
@@ -1213,9 +1267,9 @@ cdef class InferRequest:
     #  request_status = exec_net.requests[0].wait()
     #  res = exec_net.requests[0].output_blobs['prob']
     #  ```
-    cpdef async_infer(self, inputs=None):
+    cpdef async_infer(self, inputs=None, share_inputs=False):
         if inputs is not None:
-            self._fill_inputs(inputs)
+            self._fill_inputs(inputs, share_inputs)
         with nogil:
             deref(self.impl).infer_async()
 
@@ -1307,9 +1361,18 @@ cdef class InferRequest:
             raise ValueError(f"Batch size should be positive integer number but {size} specified")
         deref(self.impl).setBatch(size)
 
-    def _fill_inputs(self, inputs):
+    def _fill_inputs(self, inputs, share_inputs=False):
         for k, v in inputs.items():
             assert k in self._inputs_list, f"No input with name {k} found in network"
+            if share_inputs and not self._inputs_is_dynamic[k] and isinstance(v, np.ndarray):
+                tensor_desc = self.input_blobs[k].tensor_desc
+                if _can_share_memory(v, tensor_desc):
+                    self.set_blob(k, Blob(tensor_desc, v))
+                    self._shared_inputs.add(k)
+                    continue
+            if k in self._shared_inputs:
+                # the blob points to the array of the previous call, allocate own memory not to overwrite it
+                self.set_blob(k, Blob(self.input_blobs[k].tensor_desc))
             if self._inputs_is_dynamic[k]:
                 shape = expand_dims_to_corresponding_layout(v.shape, self.input_blobs[k].tensor_desc.layout)
                 self.input_blobs[k].set_shape(shape)
@@ -154,6 +154,55 @@ def test_infer(device):
     del net
 
 
+def test_infer_share_inputs(device):
+    exec_net = load_sample_model(device)
+    img = read_image()
+    request = exec_net.requests[0]
+    request.infer({'data': img}, share_inputs=True)
+    assert np.shares_memory(request.input_blobs['data'].buffer, img)
+    res = request.output_blobs['fc_out'].buffer
+    assert np.argmax(res) == 2
+
+
+def test_infer_share_inputs_fallback_to_copy(device):
+    exec_net = load_sample_model(device)
+    img = np.asfortranarray(read_image())
+    request = exec_net.requests[0]
+    request.infer({'data': img}, share_inputs=True)
+    assert not np.shares_memory(request.input_blobs['data'].buffer, img)
+    res = request.output_blobs['fc_out'].buffer
+    assert np.argmax(res) == 2
+
+
+def test_infer_copy_after_share_inputs(device):
+    exec_net = load_sample_model(device)
+    img = read_image()
+    img_copy = img.copy()
+    request = exec_net.requests[0]
+    request.infer({'data': img}, share_inputs=True)
+    request.infer({'data': np.zeros_like(img)})
+    assert np.array_equal(img, img_copy)
+    assert not np.shares_memory(request.input_blobs['data'].buffer, img)
+
+
+def test_bind_output(device):
+    exec_net = load_sample_model(device)
+    img = read_image()
+    res = np.zeros(shape=(1, 10), dtype=np.float32)
+    request = exec_net.requests[0]
+    request.bind_output('fc_out', res)
+    request.infer({'data': img})
+    assert np.argmax(res) == 2
+    assert np.shares_memory(request.output_blobs['fc_out'].buffer, res)
+
+
+def test_bind_output_incorrect_shape(device):
+    exec_net = load_sample_model(device)
+    with pytest.raises(ValueError) as e:
+        exec_net.requests[0].bind_output('fc_out', np.zeros(shape=(10,), dtype=np.float32))
+    assert "can't be bound to output fc_out" in str(e.value)
+
+
 def test_async_infer_default_timeout(device):
     ie_core = ie.IECore()
     net = ie_core.read_network(test_net_xml, test_net_bin)
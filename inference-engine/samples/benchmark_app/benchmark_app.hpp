@@ -78,6 +78,21 @@ static const char infer_latency_percentile_message[] =
     "Optional. Defines the percentile to be reported in latency metric. The valid range is [1, 100]. The default value "
     "is 50 (median).";
 
+/// @brief message for open-loop arrival rate
+static const char arrival_rate_message[] =
+    "Optional. Enables open-loop mode: requests are issued at the given rate (requests per second) regardless of "
+    "their completion and latency is measured from the scheduled arrival time, so queueing delay is included. "
+    "A comma-separated list of rates runs them one by one, e.g. \"100,200,400\". Requires async API.";
+
+/// @brief message for open-loop arrival distribution
+static const char arrival_distribution_message[] =
+    "Optional. Distribution of the open-loop arrivals: \"constant\" (default) or \"poisson\".";
+
+/// @brief message for latency SLO
+static const char latency_slo_message[] =
+    "Optional. Latency SLO in milliseconds for the open-loop mode. The maximum rate from -arrival_rate list "
+    "whose 99th percentile latency meets the SLO is reported as the maximum sustainable throughput.";
+
 /// @brief message for enforcing of BF16 execution where it is possible
 static const char enforce_bf16_message[] =
     "Optional. By default floating point operations execution in bfloat16 precision are enforced "
@@ -248,6 +263,15 @@ DEFINE_string(nstreams, "", infer_num_streams_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint32(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Rates of the open-loop mode in requests per second
+DEFINE_string(arrival_rate, "", arrival_rate_message);
+
+/// @brief Distribution of the open-loop arrivals
+DEFINE_string(arrival_distribution, "constant", arrival_distribution_message);
+
+/// @brief Latency SLO in milliseconds for the open-loop mode
+DEFINE_double(latency_slo, 0, latency_slo_message);
+
 /// @brief Enforces bf16 execution with bfloat16 precision on systems having this capability
 DEFINE_bool(enforcebf16, false, enforce_bf16_message);
 
@@ -350,6 +374,10 @@ static void showUsage() {
     std::cout << "    -cache_dir \"<path>\"        " << cache_dir_message << std::endl;
     std::cout << "    -load_from_file           " << load_from_file_message << std::endl;
     std::cout << "    -latency_percentile       " << infer_latency_percentile_message << std::endl;
+    std::cout << std::endl << "  open-loop options:" << std::endl;
+    std::cout << "    -arrival_rate \"<rates>\"   " << arrival_rate_message << std::endl;
+    std::cout << "    -arrival_distribution     " << arrival_distribution_message << std::endl;
+    std::cout << "    -latency_slo \"<ms>\"       " << latency_slo_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
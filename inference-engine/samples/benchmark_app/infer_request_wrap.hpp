@@ -46,6 +46,13 @@ public:
         _request.StartAsync();
     }
 
+    /// @brief Starts the request which was scheduled to arrive at the given time, the latency includes the time the
+    /// request waited for an idle infer request
+    void startAsync(const Time::time_point& arrivalTime) {
+        _startTime = arrivalTime;
+        _request.StartAsync();
+    }
+
     void wait() {
         _request.Wait(InferenceEngine::InferRequest::RESULT_READY);
     }
@@ -0,0 +1,88 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/// @brief Log-linear latency histogram in the spirit of HdrHistogram. Values are recorded with microsecond
+/// resolution, every power of two range above 128 us is split into 64 buckets, so the relative error of the
+/// reported percentiles is below 2% while the memory does not depend on the number of recorded values.
+class LatencyHistogram {
+public:
+    LatencyHistogram() : _counts(bucketIndex(std::numeric_limits<uint64_t>::max()) + 1, 0) {}
+
+    void record(double latencyMs) {
+        const auto value = static_cast<uint64_t>(std::max(0.0, latencyMs) * 1000.0);
+        _counts[bucketIndex(value)]++;
+        _total++;
+        _min = std::min(_min, value);
+        _max = std::max(_max, value);
+    }
+
+    uint64_t count() const {
+        return _total;
+    }
+
+    double maxMs() const {
+        return _total == 0 ? 0.0 : static_cast<double>(_max) / 1000.0;
+    }
+
+    double minMs() const {
+        return _total == 0 ? 0.0 : static_cast<double>(_min) / 1000.0;
+    }
+
+    /// @brief Returns the upper bound of the bucket which holds the given percentile in (0, 100]
+    double percentileMs(double percentile) const {
+        if (_total == 0)
+            return 0.0;
+        const auto rank =
+            std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(_total))));
+        uint64_t cumulative = 0;
+        for (size_t index = 0; index < _counts.size(); index++) {
+            cumulative += _counts[index];
+            if (cumulative >= rank) {
+                return static_cast<double>(std::min(bucketUpperBound(index), _max)) / 1000.0;
+            }
+        }
+        return maxMs();
+    }
+
+private:
+    static constexpr unsigned linearBits = 7;
+    static constexpr uint64_t linearBuckets = 1ull << linearBits;
+    static constexpr uint64_t subBuckets = linearBuckets / 2;
+
+    static unsigned highestBit(uint64_t value) {
+        unsigned bit = 0;
+        while (value >>= 1)
+            bit++;
+        return bit;
+    }
+
+    // values below 128 us have their own buckets, the larger ones are split into 64 buckets per power of two
+    static size_t bucketIndex(uint64_t value) {
+        if (value < linearBuckets)
+            return static_cast<size_t>(value);
+        const unsigned shift = highestBit(value) - (linearBits - 1);
+        return static_cast<size_t>(linearBuckets + (shift - 1) * subBuckets + ((value >> shift) - subBuckets));
+    }
+
+    static uint64_t bucketUpperBound(size_t index) {
+        if (index < linearBuckets)
+            return index;
+        const uint64_t shift = (index - linearBuckets) / subBuckets + 1;
+        const uint64_t mantissa = (index - linearBuckets) % subBuckets + subBuckets;
+        return ((mantissa + 1) << shift) - 1;
+    }
+
+    std::vector<uint64_t> _counts;
+    uint64_t _total = 0;
+    uint64_t _min = std::numeric_limits<uint64_t>::max();
+    uint64_t _max = 0;
+};
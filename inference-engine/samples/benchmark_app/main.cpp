@@ -7,12 +7,15 @@
 #include <gna/gna_config.hpp>
 #include <gpu/gpu_config.hpp>
 #include <inference_engine.hpp>
+#include <iomanip>
 #include <map>
 #include <memory>
+#include <random>
 #include <samples/args_helper.hpp>
 #include <samples/common.hpp>
 #include <samples/slog.hpp>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #include <vpu/vpu_plugin_config.hpp>
@@ -20,6 +23,7 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "latency_histogram.hpp"
 #include "progress_bar.hpp"
 #include "remote_blobs_filling.hpp"
 #include "statistics_report.hpp"
@@ -76,6 +80,20 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if (!FLAGS_arrival_rate.empty()) {
+        if (FLAGS_api != "async") {
+            throw std::logic_error("Open-loop mode (-arrival_rate) requires async API.");
+        }
+        if (FLAGS_arrival_distribution != "constant" && FLAGS_arrival_distribution != "poisson") {
+            throw std::logic_error("Incorrect arrival distribution. Please set -arrival_distribution option to "
+                                   "either `constant` or `poisson` value.");
+        }
+        parseArrivalRates(FLAGS_arrival_rate);
+    }
+    if (FLAGS_latency_slo < 0) {
+        throw std::logic_error("Latency SLO must not be negative.");
+    }
+
     bool isNetworkCompiled = fileExt(FLAGS_m) == "blob";
     bool isPrecisionSet = !(FLAGS_ip.empty() && FLAGS_op.empty() && FLAGS_iop.empty());
     if (isNetworkCompiled && isPrecisionSet) {
@@ -118,6 +136,60 @@ T getMedianValue(const std::vector<T>& vec, std::size_t percentile) {
     return sortedVec[(sortedVec.size() / 100) * percentile];
 }
 
+struct OpenLoopResult {
+    double rate;
+    size_t iterations;
+    double durationMs;
+    LatencyHistogram latencies;
+};
+
+/**
+ * @brief Issues requests at the scheduled arrival times regardless of their completion. When all infer requests are
+ * busy the arrivals keep their schedule and wait, their latency is measured from the scheduled arrival time, so the
+ * queueing delay is not hidden by the load generator (coordinated omission).
+ */
+OpenLoopResult runOpenLoop(InferRequestsQueue& inferRequestsQueue,
+                           double rate,
+                           bool poissonArrivals,
+                           uint32_t niter,
+                           uint64_t durationNanoseconds) {
+    std::mt19937_64 generator(std::random_device{}());
+    std::exponential_distribution<double> poissonInterval(rate);
+    const double constantInterval = 1.0 / rate;
+
+    inferRequestsQueue.resetTimes();
+    const auto startTime = Time::now();
+    auto arrivalTime = startTime;
+    size_t iteration = 0;
+    while ((niter != 0 && iteration < niter) ||
+           (durationNanoseconds != 0 &&
+            static_cast<uint64_t>(std::chrono::duration_cast<ns>(arrivalTime - startTime).count()) <
+                durationNanoseconds)) {
+        std::this_thread::sleep_until(arrivalTime);
+        auto inferRequest = inferRequestsQueue.getIdleRequest();
+        if (!inferRequest) {
+            IE_THROW() << "No idle Infer Requests!";
+        }
+        inferRequest->wait();
+        inferRequest->startAsync(arrivalTime);
+        iteration++;
+
+        const double interval = poissonArrivals ? poissonInterval(generator) : constantInterval;
+        arrivalTime += std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(interval));
+    }
+    inferRequestsQueue.waitAll();
+
+    OpenLoopResult result;
+    result.rate = rate;
+    result.iterations = iteration;
+    result.durationMs =
+        static_cast<double>(std::chrono::duration_cast<ns>(Time::now() - startTime).count()) * 0.000001;
+    for (auto latency : inferRequestsQueue.getLatencies()) {
+        result.latencies.record(latency);
+    }
+    return result;
+}
+
 /**
  * @brief The entry point of the benchmark application
  */
@@ -628,6 +700,8 @@ int main(int argc, char* argv[]) {
 
         // ----------------- 10. Measuring performance
         // ------------------------------------------------------------------
+        const auto arrivalRates =
+            FLAGS_arrival_rate.empty() ? std::vector<double>{} : parseArrivalRates(FLAGS_arrival_rate);
         size_t progressCnt = 0;
         size_t progressBarTotalCount = progressBarDefaultTotalCount;
         size_t iteration = 0;
@@ -663,6 +737,9 @@ int main(int argc, char* argv[]) {
             }
             ss << niter << " iterations";
         }
+        if (!arrivalRates.empty()) {
+            ss << ", open-loop " << FLAGS_arrival_distribution << " arrivals at " << FLAGS_arrival_rate << " req/s";
+        }
         next_step(ss.str());
 
         // warming up - out of scope
@@ -683,83 +760,118 @@ int main(int argc, char* argv[]) {
                                       {{"first inference time (ms)", duration_ms}});
         inferRequestsQueue.resetTimes();
 
-        auto startTime = Time::now();
-        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+        double latency = 0;
+        double totalDuration = 0;
+        double fps = 0;
+        std::vector<OpenLoopResult> openLoopResults;
+        if (arrivalRates.empty()) {
+            auto startTime = Time::now();
+            auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+
+            /** Start inference & calculate performance **/
+            /** to align number if iterations to guarantee that last infer requests are
+             * executed in the same conditions **/
+            ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
+
+            while ((niter != 0LL && iteration < niter) ||
+                   (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                   (FLAGS_api == "async" && iteration % nireq != 0)) {
+                inferRequest = inferRequestsQueue.getIdleRequest();
+                if (!inferRequest) {
+                    IE_THROW() << "No idle Infer Requests!";
+                }
 
-        /** Start inference & calculate performance **/
-        /** to align number if iterations to guarantee that last infer requests are
-         * executed in the same conditions **/
-        ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
+                if (FLAGS_api == "sync") {
+                    inferRequest->infer();
+                } else {
+                    // As the inference request is currently idle, the wait() adds no
+                    // additional overhead (and should return immediately). The primary
+                    // reason for calling the method is exception checking/re-throwing.
+                    // Callback, that governs the actual execution can handle errors as
+                    // well, but as it uses just error codes it has no details like ‘what()’
+                    // method of `std::exception` So, rechecking for any exceptions here.
+                    inferRequest->wait();
+                    inferRequest->startAsync();
+                }
+                iteration++;
 
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.getIdleRequest();
-            if (!inferRequest) {
-                IE_THROW() << "No idle Infer Requests!";
-            }
+                execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
-            } else {
-                // As the inference request is currently idle, the wait() adds no
-                // additional overhead (and should return immediately). The primary
-                // reason for calling the method is exception checking/re-throwing.
-                // Callback, that governs the actual execution can handle errors as
-                // well, but as it uses just error codes it has no details like ‘what()’
-                // method of `std::exception` So, rechecking for any exceptions here.
-                inferRequest->wait();
-                inferRequest->startAsync();
+                if (niter > 0) {
+                    progressBar.addProgress(1);
+                } else {
+                    // calculate how many progress intervals are covered by current
+                    // iteration. depends on the current iteration time and time of each
+                    // progress interval. Previously covered progress intervals must be
+                    // skipped.
+                    auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
+                    size_t newProgress = execTime / progressIntervalTime - progressCnt;
+                    progressBar.addProgress(newProgress);
+                    progressCnt += newProgress;
+                }
             }
-            iteration++;
-
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
-            if (niter > 0) {
-                progressBar.addProgress(1);
-            } else {
-                // calculate how many progress intervals are covered by current
-                // iteration. depends on the current iteration time and time of each
-                // progress interval. Previously covered progress intervals must be
-                // skipped.
-                auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
-                size_t newProgress = execTime / progressIntervalTime - progressCnt;
-                progressBar.addProgress(newProgress);
-                progressCnt += newProgress;
-            }
-        }
+            // wait the latest inference executions
+            inferRequestsQueue.waitAll();
 
-        // wait the latest inference executions
-        inferRequestsQueue.waitAll();
+            latency = getMedianValue<double>(inferRequestsQueue.getLatencies(), FLAGS_latency_percentile);
+            totalDuration = inferRequestsQueue.getDurationInMilliseconds();
+            fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency : batchSize * 1000.0 * iteration / totalDuration;
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies(), FLAGS_latency_percentile);
-        double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
-        double fps =
-            (FLAGS_api == "sync") ? batchSize * 1000.0 / latency : batchSize * 1000.0 * iteration / totalDuration;
-
-        if (statistics) {
-            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
-                                      {
-                                          {"total execution time (ms)", double_to_string(totalDuration)},
-                                          {"total number of iterations", std::to_string(iteration)},
-                                      });
-            if (device_name.find("MULTI") == std::string::npos) {
-                std::string latency_label;
-                if (FLAGS_latency_percentile == 50) {
-                    latency_label = "latency (ms)";
-                } else {
-                    latency_label = "latency (" + std::to_string(FLAGS_latency_percentile) + " percentile) (ms)";
-                }
+            if (statistics) {
                 statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                           {
-                                              {latency_label, double_to_string(latency)},
+                                              {"total execution time (ms)", double_to_string(totalDuration)},
+                                              {"total number of iterations", std::to_string(iteration)},
                                           });
+                if (device_name.find("MULTI") == std::string::npos) {
+                    std::string latency_label;
+                    if (FLAGS_latency_percentile == 50) {
+                        latency_label = "latency (ms)";
+                    } else {
+                        latency_label = "latency (" + std::to_string(FLAGS_latency_percentile) + " percentile) (ms)";
+                    }
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                  {latency_label, double_to_string(latency)},
+                                              });
+                }
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {{"throughput", double_to_string(fps)}});
             }
-            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
-                                      {{"throughput", double_to_string(fps)}});
-        }
 
-        progressBar.finish();
+            progressBar.finish();
+        } else {
+            // open-loop: the requests are issued at the given arrival rates, each rate is measured separately
+            for (auto rate : arrivalRates) {
+                openLoopResults.push_back(runOpenLoop(inferRequestsQueue,
+                                                      rate,
+                                                      FLAGS_arrival_distribution == "poisson",
+                                                      niter,
+                                                      duration_nanoseconds));
+                const auto& result = openLoopResults.back();
+                slog::info << "Arrival rate " << double_to_string(rate) << " req/s: p50 "
+                           << double_to_string(result.latencies.percentileMs(50)) << " ms, p99 "
+                           << double_to_string(result.latencies.percentileMs(99)) << " ms" << slog::endl;
+
+                if (statistics) {
+                    const std::string prefix = "arrival rate " + double_to_string(rate) + " req/s: ";
+                    statistics->addParameters(
+                        StatisticsReport::Category::EXECUTION_RESULTS,
+                        {
+                            {prefix + "total execution time (ms)", double_to_string(result.durationMs)},
+                            {prefix + "total number of iterations", std::to_string(result.iterations)},
+                            {prefix + "throughput",
+                             double_to_string(batchSize * 1000.0 * result.iterations / result.durationMs)},
+                            {prefix + "latency p50 (ms)", double_to_string(result.latencies.percentileMs(50))},
+                            {prefix + "latency p90 (ms)", double_to_string(result.latencies.percentileMs(90))},
+                            {prefix + "latency p99 (ms)", double_to_string(result.latencies.percentileMs(99))},
+                            {prefix + "latency p99.9 (ms)", double_to_string(result.latencies.percentileMs(99.9))},
+                            {prefix + "latency max (ms)", double_to_string(result.latencies.maxMs())},
+                        });
+                }
+            }
+        }
 
         // ----------------- 11. Dumping statistics report
         // -------------------------------------------------------------
@@ -800,18 +912,47 @@ int main(int argc, char* argv[]) {
         if (statistics)
             statistics->dump();
 
-        std::cout << "Count:      " << iteration << " iterations" << std::endl;
-        std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos) {
-            std::cout << "Latency";
-            if (FLAGS_latency_percentile == 50) {
-                std::cout << ":    ";
-            } else {
-                std::cout << " (" << FLAGS_latency_percentile << " percentile):    ";
+        if (openLoopResults.empty()) {
+            std::cout << "Count:      " << iteration << " iterations" << std::endl;
+            std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
+            if (device_name.find("MULTI") == std::string::npos) {
+                std::cout << "Latency";
+                if (FLAGS_latency_percentile == 50) {
+                    std::cout << ":    ";
+                } else {
+                    std::cout << " (" << FLAGS_latency_percentile << " percentile):    ";
+                }
+                std::cout << double_to_string(latency) << " ms" << std::endl;
+            }
+            std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+        } else {
+            std::cout << "Arrival rate (req/s)  Count  Throughput (FPS)  p50 (ms)  p90 (ms)  p99 (ms)  p99.9 (ms)  "
+                      << "max (ms)" << std::endl;
+            const OpenLoopResult* bestUnderSlo = nullptr;
+            for (const auto& result : openLoopResults) {
+                const double throughput = batchSize * 1000.0 * result.iterations / result.durationMs;
+                std::cout << std::setw(20) << double_to_string(result.rate) << std::setw(7) << result.iterations
+                          << std::setw(18) << double_to_string(throughput) << std::setw(10)
+                          << double_to_string(result.latencies.percentileMs(50)) << std::setw(10)
+                          << double_to_string(result.latencies.percentileMs(90)) << std::setw(10)
+                          << double_to_string(result.latencies.percentileMs(99)) << std::setw(12)
+                          << double_to_string(result.latencies.percentileMs(99.9)) << std::setw(10)
+                          << double_to_string(result.latencies.maxMs()) << std::endl;
+                if (FLAGS_latency_slo > 0 && result.latencies.percentileMs(99) <= FLAGS_latency_slo &&
+                    (!bestUnderSlo || result.rate > bestUnderSlo->rate)) {
+                    bestUnderSlo = &result;
+                }
+            }
+            if (FLAGS_latency_slo > 0) {
+                if (bestUnderSlo) {
+                    std::cout << "Max arrival rate with p99 latency within " << double_to_string(FLAGS_latency_slo)
+                              << " ms: " << double_to_string(bestUnderSlo->rate) << " req/s" << std::endl;
+                } else {
+                    std::cout << "None of the arrival rates meets p99 latency of "
+                              << double_to_string(FLAGS_latency_slo) << " ms" << std::endl;
+                }
             }
-            std::cout << double_to_string(latency) << " ms" << std::endl;
         }
-        std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
@@ -105,6 +105,23 @@ std::vector<float> splitFloat(const std::string& s, char delim) {
     return result;
 }
 
+std::vector<double> parseArrivalRates(const std::string& rates_string) {
+    std::vector<double> rates;
+    for (const auto& item : split(rates_string, ',')) {
+        double rate = 0;
+        try {
+            rate = std::stod(item);
+        } catch (const std::exception&) {
+            throw std::logic_error("Can't parse arrival rate: " + item);
+        }
+        if (rate <= 0) {
+            throw std::logic_error("Arrival rate must be positive: " + item);
+        }
+        rates.push_back(rate);
+    }
+    return rates;
+}
+
 std::vector<std::string> parseDevices(const std::string& device_string) {
     std::string comma_separated_devices = device_string;
     if (comma_separated_devices.find(":") != std::string::npos) {
@@ -113,6 +130,10 @@ std::vector<std::string> parseDevices(const std::string& device_string) {
     if ((comma_separated_devices == "MULTI") || (comma_separated_devices == "HETERO"))
         return std::vector<std::string>();
     auto devices = split(comma_separated_devices, ',');
+    // the BATCH device takes the batch size in braces, e.g. BATCH:CPU(4)
+    for (auto& device : devices) {
+        device = device.substr(0, device.find("("));
+    }
     return devices;
 }
 
@@ -34,6 +34,7 @@ std::map<std::string, std::string> parseNStreamsValuePerDevice(const std::vector
 std::string getShapesString(const InferenceEngine::ICNNNetwork::InputShapes& shapes);
 size_t getBatchSize(const benchmark_app::InputsInfo& inputs_info);
 std::vector<std::string> split(const std::string& s, char delim);
+std::vector<double> parseArrivalRates(const std::string& rates_string);
 std::map<std::string, std::vector<float>> parseScaleOrMean(const std::string& scale_mean,
                                                            const benchmark_app::InputsInfo& inputs_info);
 
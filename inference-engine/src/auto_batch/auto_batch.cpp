@@ -0,0 +1,553 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <blob_factory.hpp>
+#include <ie_icore.hpp>
+#include <ie_metric_helpers.hpp>
+#include <ie_ngraph_utils.hpp>
+#include <ie_plugin_config.hpp>
+#include <threading/ie_immediate_executor.hpp>
+
+#include "auto_batch.hpp"
+
+namespace AutoBatchPlugin {
+using namespace InferenceEngine;
+
+namespace {
+
+std::map<std::string, std::string> mergeConfigs(std::map<std::string, std::string> config,
+                                                const std::map<std::string, std::string>& local) {
+    for (auto&& kvp : local) {
+        config[kvp.first] = kvp.second;
+    }
+    return config;
+}
+
+const std::vector<std::string> supported_configKeys = {
+    CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
+    CONFIG_KEY(AUTO_BATCH_TIMEOUT)
+};
+
+int64_t ParseTimeout(const std::string& value) {
+    int64_t timeout = -1;
+    try {
+        timeout = std::stoll(value);
+    } catch (...) {
+    }
+    if (timeout < 0) {
+        IE_THROW() << "Wrong value " << value << " for the " << CONFIG_KEY(AUTO_BATCH_TIMEOUT)
+                   << " key, expected non-negative number of milliseconds";
+    }
+    return timeout;
+}
+
+// the layouts with the batch as the outermost dimension, so every sample is a contiguous part of the blob
+bool IsBatchOutermost(Layout layout) {
+    switch (layout) {
+    case Layout::NC:
+    case Layout::NCHW:
+    case Layout::NHWC:
+    case Layout::NCDHW:
+    case Layout::NDHWC:
+        return true;
+    default:
+        return false;
+    }
+}
+
+Blob::Ptr CreateSliceOfBatchedBlob(const Blob::Ptr& batchedBlob, int batchId, int numBatch) {
+    auto memoryBlob = as<MemoryBlob>(batchedBlob);
+    const auto& desc = batchedBlob->getTensorDesc();
+    auto dims = desc.getDims();
+    if (!memoryBlob || dims.empty() || dims[0] != static_cast<size_t>(numBatch) || !IsBatchOutermost(desc.getLayout())) {
+        IE_THROW(NotImplemented) << "BATCH device supports only memory blobs with the batch as the outermost dimension";
+    }
+    dims[0] = 1;
+    const auto sliceSize = memoryBlob->byteSize() / numBatch;
+    auto ptr = memoryBlob->buffer().as<uint8_t*>() + batchId * sliceSize;
+    return make_blob_with_precision(TensorDesc{desc.getPrecision(), dims, desc.getLayout()}, ptr);
+}
+
+void CopyBlob(const Blob::Ptr& src, const Blob::Ptr& dst) {
+    auto srcMemory = as<MemoryBlob>(src);
+    auto dstMemory = as<MemoryBlob>(dst);
+    if (!srcMemory || !dstMemory || srcMemory->byteSize() != dstMemory->byteSize()) {
+        IE_THROW() << "BATCH device can't copy the blob set by the user, its size or type differs from the network's one";
+    }
+    auto srcHolder = srcMemory->rmap();
+    auto dstHolder = dstMemory->wmap();
+    std::memcpy(dstHolder.as<uint8_t*>(), srcHolder.as<const uint8_t*>(), srcMemory->byteSize());
+}
+
+}  // namespace
+
+// ------------------------------AutoBatchInferRequest----------------------------
+AutoBatchInferRequest::AutoBatchInferRequest(const InputsDataMap&                             networkInputs,
+                                             const OutputsDataMap&                            networkOutputs,
+                                             AutoBatchExecutableNetwork::WorkerInferRequest&  workerRequest,
+                                             int                                              batchId,
+                                             int                                              numBatch)
+        : IInferRequestInternal(networkInputs, networkOutputs), _workerInferRequest(workerRequest) {
+    // the request works with its slices of the batched blobs, so the data is neither gathered nor scattered
+    for (const auto& it : _networkInputs) {
+        _inputSlices[it.first] = CreateSliceOfBatchedBlob(workerRequest._inferRequestBatched->GetBlob(it.first),
+                                                          batchId, numBatch);
+        _inputs[it.first] = _inputSlices[it.first];
+    }
+    for (const auto& it : _networkOutputs) {
+        _outputSlices[it.first] = CreateSliceOfBatchedBlob(workerRequest._inferRequestBatched->GetBlob(it.first),
+                                                           batchId, numBatch);
+        _outputs[it.first] = _outputSlices[it.first];
+    }
+    std::lock_guard<std::mutex> lock(workerRequest._mutex);
+    workerRequest._numRequests++;
+}
+
+AutoBatchInferRequest::~AutoBatchInferRequest() {
+    {
+        std::lock_guard<std::mutex> lock(_workerInferRequest._mutex);
+        _workerInferRequest._numRequests--;
+    }
+    // the worker waiting for the batch of this request runs the collected ones without waiting for the timeout
+    _workerInferRequest._cond.notify_one();
+}
+
+void AutoBatchInferRequest::CopyInputsIfNeeded() {
+    for (const auto& it : _inputSlices) {
+        auto& blob = _inputs[it.first];
+        if (blob != it.second)
+            CopyBlob(blob, it.second);
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsIfNeeded() {
+    for (const auto& it : _outputSlices) {
+        auto& blob = _outputs[it.first];
+        if (blob != it.second)
+            CopyBlob(it.second, blob);
+    }
+}
+
+void AutoBatchInferRequest::SetBlobsToAnotherRequest(const SoIInferRequestInternal& req) {
+    for (const auto& it : _inputSlices)
+        req->SetBlob(it.first, it.second);
+    for (const auto& it : _outputSlices)
+        req->SetBlob(it.first, it.second);
+}
+
+std::map<std::string, InferenceEngineProfileInfo> AutoBatchInferRequest::GetPerformanceCounts() const {
+    IE_THROW(NotImplemented);
+}
+
+void AutoBatchInferRequest::InferImpl() {
+    IE_THROW(NotImplemented);
+}
+
+// ------------------------------AutoBatchAsyncInferRequest----------------------------
+AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(const AutoBatchInferRequest::Ptr&   inferRequest,
+                                                       const bool                          needPerfCounters,
+                                                       const SoIInferRequestInternal&      inferRequestWithoutBatch,
+                                                       const ITaskExecutor::Ptr&           callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
+    _inferRequestWithoutBatch{inferRequestWithoutBatch},
+    _inferRequest{inferRequest},
+    _needPerfCounters{needPerfCounters} {
+    _inferRequest->SetBlobsToAnotherRequest(_inferRequestWithoutBatch);
+    // this executor hands the rest of the pipeline over to the worker, which runs it once the sample is inferred
+    struct ThisRequestExecutor : public ITaskExecutor {
+        explicit ThisRequestExecutor(AutoBatchAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            auto& workerInferRequest = _this->_inferRequest->_workerInferRequest;
+            {
+                std::lock_guard<std::mutex> lock(workerInferRequest._mutex);
+                if (workerInferRequest._tasks.empty())
+                    workerInferRequest._firstTaskTime = std::chrono::steady_clock::now();
+                workerInferRequest._tasks.emplace_back(_this, std::move(task));
+            }
+            workerInferRequest._cond.notify_one();
+        };
+        AutoBatchAsyncInferRequest* _this = nullptr;
+    };
+    _pipeline = {
+        { /*TaskExecutor*/ std::make_shared<ImmediateExecutor>(), /*task*/ [this] {
+            _exceptionPtr = nullptr;
+            _inferRequest->CopyInputsIfNeeded();
+        }},
+        // final task in the pipeline:
+        { /*TaskExecutor*/ std::make_shared<ThisRequestExecutor>(this), /*task*/ [this] {
+            if (nullptr != _exceptionPtr) {
+                std::rethrow_exception(_exceptionPtr);
+            }
+            _inferRequest->CopyOutputsIfNeeded();
+            if (_needPerfCounters)
+                _perfMap = _wasBatched ? _inferRequest->_workerInferRequest._inferRequestBatched->GetPerformanceCounts()
+                                       : _inferRequestWithoutBatch->GetPerformanceCounts();
+        }}
+    };
+}
+
+void AutoBatchAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
+std::map<std::string, InferenceEngineProfileInfo> AutoBatchAsyncInferRequest::GetPerformanceCounts() const {
+    CheckState();
+    return _perfMap;
+}
+
+AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
+    StopAndWait();
+}
+
+// ------------------------------AutoBatchExecutableNetwork----------------------------
+AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(const SoExecutableNetworkInternal&                 networkForDevice,
+                                                       const SoExecutableNetworkInternal&                 networkWithoutBatch,
+                                                       const DeviceInformation&                           networkDevice,
+                                                       const std::unordered_map<std::string, Parameter>& config,
+                                                       const bool                                         needPerfCounters) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
+    _device{networkDevice},
+    _network{networkForDevice},
+    _networkWithoutBatch{networkWithoutBatch},
+    _config{config},
+    _needPerfCounters{needPerfCounters} {
+    _taskExecutor.reset();
+    auto timeout = _config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
+    if (timeout != _config.end())
+        _timeoutMs = ParseTimeout(timeout->second.as<std::string>());
+}
+
+AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
+    /* NOTE: The user-facing requests hold the network, so there are no requests waiting for a batch here.
+     *       The workers are woken up under their mutexes so none of them misses the termination.
+     */
+    _terminate = true;
+    for (auto&& workerRequest : _workerRequests) {
+        {
+            std::lock_guard<std::mutex> lock(workerRequest->_mutex);
+        }
+        workerRequest->_cond.notify_one();
+        workerRequest->_thread.join();
+    }
+    _workerRequests.clear();
+}
+
+void AutoBatchExecutableNetwork::RunWorker(WorkerInferRequest& workerRequest) {
+    const auto batchSize = static_cast<size_t>(workerRequest._batchSize);
+    while (true) {
+        std::vector<std::pair<AutoBatchAsyncInferRequest*, Task>> tasks;
+        {
+            std::unique_lock<std::mutex> lock(workerRequest._mutex);
+            workerRequest._cond.wait(lock, [&] { return _terminate || !workerRequest._tasks.empty(); });
+            if (_terminate)
+                break;
+            // the batch is never collected by the last worker if the number of requests is not a multiple of the batch,
+            // its requests are run without batching right away
+            const auto deadline = workerRequest._firstTaskTime + std::chrono::milliseconds(_timeoutMs.load());
+            workerRequest._cond.wait_until(lock, deadline, [&] {
+                return _terminate || workerRequest._tasks.size() == batchSize || workerRequest._numRequests < batchSize;
+            });
+            if (_terminate)
+                break;
+            tasks.swap(workerRequest._tasks);
+        }
+
+        // the device requests are run to completion here, so their callbacks are never needed
+        const bool batched = tasks.size() == batchSize;
+        if (batched) {
+            std::exception_ptr exceptionPtr = nullptr;
+            try {
+                workerRequest._inferRequestBatched->Infer();
+            } catch (...) {
+                exceptionPtr = std::current_exception();
+            }
+            for (auto&& task : tasks)
+                task.first->_exceptionPtr = exceptionPtr;
+        } else {
+            // the batch was not collected in time: the samples are inferred in parallel by the network without batching
+            for (auto&& task : tasks) {
+                try {
+                    task.first->_inferRequestWithoutBatch->StartAsync();
+                } catch (...) {
+                    task.first->_exceptionPtr = std::current_exception();
+                }
+            }
+            for (auto&& task : tasks) {
+                if (nullptr != task.first->_exceptionPtr)
+                    continue;
+                try {
+                    task.first->_inferRequestWithoutBatch->Wait(InferRequest::RESULT_READY);
+                } catch (...) {
+                    task.first->_exceptionPtr = std::current_exception();
+                }
+            }
+        }
+        for (auto&& task : tasks) {
+            task.first->_wasBatched = batched;
+            auto capturedTask = std::move(task.second);
+            capturedTask();
+        }
+    }
+}
+
+IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
+                                                                              OutputsDataMap networkOutputs) {
+    // every batchForDevice consecutive requests share the request of the batched network
+    std::lock_guard<std::mutex> lock(_workerRequestsMutex);
+    const int batchId = static_cast<int>(_numRequestsCreated++ % _device.batchForDevice);
+    if (batchId == 0) {
+        auto workerRequest = std::make_shared<WorkerInferRequest>();
+        workerRequest->_inferRequestBatched = { _network._so, _network->CreateInferRequest() };
+        workerRequest->_batchSize = _device.batchForDevice;
+        auto* workerRequestPtr = workerRequest.get();
+        workerRequest->_thread = std::thread([this, workerRequestPtr] { RunWorker(*workerRequestPtr); });
+        _workerRequests.push_back(workerRequest);
+    }
+    return std::make_shared<AutoBatchInferRequest>(networkInputs, networkOutputs, *_workerRequests.back(),
+                                                   batchId, _device.batchForDevice);
+}
+
+IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequest() {
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    SoIInferRequestInternal inferRequestWithoutBatch = { _networkWithoutBatch._so,
+                                                         _networkWithoutBatch->CreateInferRequest() };
+    return std::make_shared<AutoBatchAsyncInferRequest>(std::static_pointer_cast<AutoBatchInferRequest>(syncRequestImpl),
+                                                        _needPerfCounters,
+                                                        inferRequestWithoutBatch,
+                                                        _callbackExecutor);
+}
+
+std::shared_ptr<RemoteContext> AutoBatchExecutableNetwork::GetContext() const {
+    return _network->GetContext();
+}
+
+void AutoBatchExecutableNetwork::SetConfig(const std::map<std::string, Parameter>& config) {
+    auto timeout = config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
+    if (timeout == config.end() || config.size() > 1) {
+        IE_THROW() << "The only config supported for the Network's SetConfig is " << CONFIG_KEY(AUTO_BATCH_TIMEOUT);
+    }
+    _timeoutMs = ParseTimeout(timeout->second.as<std::string>());
+    _config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = timeout->second;
+}
+
+Parameter AutoBatchExecutableNetwork::GetConfig(const std::string& name) const {
+    auto it = _config.find(name);
+    if (it != _config.end()) {
+        return it->second;
+    }
+    // find config key among the keys of the network on the device
+    std::vector<std::string> configKeys = _network->GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    if (std::find(configKeys.begin(), configKeys.end(), name) != configKeys.end()) {
+        return _network->GetConfig(name);
+    }
+    IE_THROW(NotFound) << name << " not found in the ExecutableNetwork config";
+}
+
+Parameter AutoBatchExecutableNetwork::GetMetric(const std::string& name) const {
+    if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        unsigned int optimalBatchedRequests = 1u;
+        try {
+            optimalBatchedRequests = _network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        } catch (const InferenceEngine::Exception&) {
+        }
+        // enough requests to keep every batched request of the device busy
+        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS,
+                             optimalBatchedRequests * static_cast<unsigned int>(_device.batchForDevice));
+    } else if (name == METRIC_KEY(NETWORK_NAME)) {
+        IE_SET_METRIC_RETURN(NETWORK_NAME, _network->GetMetric(METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(NETWORK_NAME),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+        });
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, supported_configKeys);
+    } else {
+        IE_THROW() << "Unsupported Network metric: " << name;
+    }
+}
+
+// ------------------------------AutoBatchInferencePlugin----------------------------
+static const Version version = {{2, 1}, CI_BUILD_NUMBER, "AutoBatchPlugin"};
+IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
+
+AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
+    _pluginName = "BATCH";
+}
+
+std::map<std::string, std::string> AutoBatchInferencePlugin::GetSupportedConfig(
+    const std::map<std::string, std::string>& config, const std::string& deviceName) const {
+    std::vector<std::string> supportedConfigKeys = GetCore()->GetMetric(deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    std::map<std::string, std::string> supportedConfig;
+    for (auto&& key : supportedConfigKeys) {
+        auto itKey = config.find(key);
+        if (config.end() != itKey) {
+            supportedConfig[key] = itKey->second;
+        }
+    }
+    return supportedConfig;
+}
+
+DeviceInformation AutoBatchInferencePlugin::ParseBatchDevice(const std::string& deviceWithBatch,
+                                                             const std::map<std::string, std::string>& config) const {
+    auto openingBracket = deviceWithBatch.find_first_of('(');
+    auto closingBracket = deviceWithBatch.find_first_of(')', openingBracket);
+    auto deviceName = deviceWithBatch.substr(0, openingBracket);
+
+    int batch = -1;
+    if (closingBracket != std::string::npos && openingBracket < closingBracket) {
+        try {
+            batch = std::stoi(deviceWithBatch.substr(openingBracket + 1, closingBracket - openingBracket - 1));
+        } catch (...) {
+        }
+    }
+    if (deviceName.empty() || batch <= 0) {
+        IE_THROW() << "Wrong value '" << deviceWithBatch << "' for the " << CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG)
+                   << " key, expected the device with the batch size > 0 in brackets, e.g. CPU(4)";
+    }
+
+    auto deviceConfig = config;
+    DeviceIDParser deviceParser(deviceName);
+    if (!deviceParser.getDeviceID().empty()) {
+        deviceConfig[PluginConfigParams::KEY_DEVICE_ID] = deviceParser.getDeviceID();
+    }
+    return { deviceName, GetSupportedConfig(deviceConfig, deviceParser.getDeviceName()), batch };
+}
+
+void AutoBatchInferencePlugin::SetConfig(const std::map<std::string, std::string>& config) {
+    for (auto&& kvp : config) {
+        const auto& name = kvp.first;
+        if (supported_configKeys.end() == std::find(supported_configKeys.begin(), supported_configKeys.end(), name)) {
+            IE_THROW() << "Unsupported config key: " << name;
+        }
+        if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT))
+            ParseTimeout(kvp.second);
+        _config[name] = kvp.second;
+    }
+}
+
+Parameter AutoBatchInferencePlugin::GetConfig(const std::string& name,
+                                              const std::map<std::string, Parameter>& options) const {
+    if (supported_configKeys.end() == std::find(supported_configKeys.begin(), supported_configKeys.end(), name)) {
+        IE_THROW() << "Unsupported config key: " << name;
+    }
+    auto it = _config.find(name);
+    if (it == _config.end()) {
+        IE_THROW() << "Value for " << name << " is not set";
+    }
+    return { it->second };
+}
+
+Parameter AutoBatchInferencePlugin::GetMetric(const std::string& name,
+                                              const std::map<std::string, Parameter>& options) const {
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(FULL_DEVICE_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
+        IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, _pluginName);
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, supported_configKeys);
+    } else {
+        IE_THROW() << "Unsupported metric key " << name;
+    }
+}
+
+IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(const CNNNetwork& network,
+                                                                             const std::map<std::string, std::string>& config) {
+    if (GetCore() == nullptr) {
+        IE_THROW() << "Please, work with " << GetName() << " device via InferenceEngine::Core object";
+    }
+    if (network.getFunction() == nullptr) {
+        IE_THROW() << GetName() << " device supports just ngraph network representation";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto deviceConfig = fullConfig.find(CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG));
+    if (deviceConfig == fullConfig.end()) {
+        IE_THROW() << CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) << " key is not set for " << GetName() << " device";
+    }
+    auto metaDevice = ParseBatchDevice(deviceConfig->second, fullConfig);
+    const auto batch = metaDevice.batchForDevice;
+
+    // the samples are stacked along the outermost dimension, which is the batch of the original network
+    for (const auto& input : network.getInputsInfo()) {
+        const auto& desc = input.second->getTensorDesc();
+        if (!IsBatchOutermost(desc.getLayout()) || desc.getDims().empty() || desc.getDims()[0] != 1) {
+            IE_THROW(NotImplemented) << GetName() << " device supports only the inputs with the batch 1 as the outermost "
+                                     << "dimension, while the input " << input.first << " has " << desc.getLayout()
+                                     << " layout";
+        }
+    }
+    auto clonedNetwork = InferenceEngine::details::cloneNetwork(network);
+    auto shapes = clonedNetwork.getInputShapes();
+    for (auto&& shape : shapes) {
+        shape.second[0] = batch;
+    }
+    try {
+        clonedNetwork.reshape(shapes);
+    } catch (const std::exception& e) {
+        IE_THROW() << GetName() << " device failed to reshape the network to the batch " << batch << ": " << e.what();
+    }
+    for (const auto& output : clonedNetwork.getOutputsInfo()) {
+        const auto& desc = output.second->getTensorDesc();
+        if (!IsBatchOutermost(desc.getLayout()) || desc.getDims().empty() ||
+            desc.getDims()[0] != static_cast<size_t>(batch)) {
+            IE_THROW(NotImplemented) << GetName() << " device supports only the outputs with the batch as the outermost "
+                                     << "dimension, while the output " << output.first << " does not follow the batch";
+        }
+    }
+
+    auto executableNetworkForDevice = GetCore()->LoadNetwork(clonedNetwork, metaDevice.deviceName, metaDevice.config);
+    auto executableNetworkWithoutBatch = GetCore()->LoadNetwork(network, metaDevice.deviceName, metaDevice.config);
+
+    // the perf counters are reported if the device has them enabled
+    bool enablePerfCounters = false;
+    try {
+        enablePerfCounters = executableNetworkForDevice->GetConfig(PluginConfigParams::KEY_PERF_COUNT).as<std::string>() ==
+                             PluginConfigParams::YES;
+    } catch (...) {
+    }
+
+    std::unordered_map<std::string, Parameter> networkConfig;
+    networkConfig[CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG)] = deviceConfig->second;
+    auto timeout = fullConfig.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
+    networkConfig[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = timeout == fullConfig.end() ? std::string{"1000"} : timeout->second;
+    return std::make_shared<AutoBatchExecutableNetwork>(executableNetworkForDevice,
+                                                        executableNetworkWithoutBatch,
+                                                        metaDevice,
+                                                        networkConfig,
+                                                        enablePerfCounters);
+}
+
+QueryNetworkResult AutoBatchInferencePlugin::QueryNetwork(const CNNNetwork& network,
+                                                          const std::map<std::string, std::string>& config) const {
+    if (GetCore() == nullptr) {
+        IE_THROW() << "Please, work with " << GetName() << " device via InferenceEngine::Core object";
+    }
+    auto fullConfig = mergeConfigs(_config, config);
+    auto deviceConfig = fullConfig.find(CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG));
+    if (deviceConfig == fullConfig.end()) {
+        IE_THROW() << CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) << " key is not set for " << GetName() << " device";
+    }
+    auto metaDevice = ParseBatchDevice(deviceConfig->second, fullConfig);
+    return GetCore()->QueryNetwork(network, metaDevice.deviceName, metaDevice.config);
+}
+
+}  // namespace AutoBatchPlugin
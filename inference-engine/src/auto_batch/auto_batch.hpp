@@ -0,0 +1,156 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
+
+namespace AutoBatchPlugin {
+
+struct DeviceInformation {
+    std::string deviceName;
+    std::map<std::string, std::string> config;
+    int batchForDevice;
+};
+
+class AutoBatchAsyncInferRequest;
+
+class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchExecutableNetwork>;
+    // the request of the batched network, it serves batchForDevice user-facing requests
+    struct WorkerInferRequest {
+        using Ptr = std::shared_ptr<WorkerInferRequest>;
+        InferenceEngine::SoIInferRequestInternal                                       _inferRequestBatched;
+        int                                                                            _batchSize;
+        // the user-facing requests attached to the worker, it can't collect the batch while there are less of them
+        size_t                                                                         _numRequests = 0;
+        // the requests collected for the next batch and the rest of their pipelines
+        std::vector<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>>     _tasks;
+        std::chrono::steady_clock::time_point                                          _firstTaskTime;
+        std::thread                                                                    _thread;
+        std::condition_variable                                                        _cond;
+        std::mutex                                                                     _mutex;
+    };
+
+    explicit AutoBatchExecutableNetwork(const InferenceEngine::SoExecutableNetworkInternal&                networkForDevice,
+                                        const InferenceEngine::SoExecutableNetworkInternal&                networkWithoutBatch,
+                                        const DeviceInformation&                                           networkDevice,
+                                        const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
+                                        const bool                                                         needPerfCounters = false);
+
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) override;
+    InferenceEngine::Parameter GetConfig(const std::string& name) const override;
+    InferenceEngine::Parameter GetMetric(const std::string& name) const override;
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                       InferenceEngine::OutputsDataMap networkOutputs) override;
+    std::shared_ptr<InferenceEngine::RemoteContext> GetContext() const override;
+    ~AutoBatchExecutableNetwork();
+
+protected:
+    // collects the requests of the worker into the batch, runs the partial batch without batching on timeout
+    void RunWorker(WorkerInferRequest& workerRequest);
+
+    DeviceInformation                                           _device;
+    InferenceEngine::SoExecutableNetworkInternal                _network;
+    InferenceEngine::SoExecutableNetworkInternal                _networkWithoutBatch;
+    std::vector<WorkerInferRequest::Ptr>                        _workerRequests;
+    std::mutex                                                  _workerRequestsMutex;
+    std::unordered_map<std::string, InferenceEngine::Parameter> _config;
+    bool                                                        _needPerfCounters = false;
+    size_t                                                      _numRequestsCreated = 0;
+    std::atomic<int64_t>                                        _timeoutMs = {1000};
+    std::atomic_bool                                            _terminate = {false};
+};
+
+class AutoBatchInferRequest : public InferenceEngine::IInferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<AutoBatchInferRequest>;
+    explicit AutoBatchInferRequest(const InferenceEngine::InputsDataMap&            networkInputs,
+                                   const InferenceEngine::OutputsDataMap&           networkOutputs,
+                                   AutoBatchExecutableNetwork::WorkerInferRequest&  workerRequest,
+                                   int                                              batchId,
+                                   int                                              numBatch);
+    ~AutoBatchInferRequest();
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+    void InferImpl() override;
+
+    // the blobs set by the user with SetBlob are copied to/from the request's slices of the batched blobs
+    void CopyInputsIfNeeded();
+    void CopyOutputsIfNeeded();
+    // sets the slices of the batched blobs to the request which runs the sample without batching
+    void SetBlobsToAnotherRequest(const InferenceEngine::SoIInferRequestInternal& req);
+
+    AutoBatchExecutableNetwork::WorkerInferRequest&  _workerInferRequest;
+
+protected:
+    std::map<std::string, InferenceEngine::Blob::Ptr> _inputSlices;
+    std::map<std::string, InferenceEngine::Blob::Ptr> _outputSlices;
+};
+
+class AutoBatchAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchAsyncInferRequest>;
+
+    explicit AutoBatchAsyncInferRequest(const AutoBatchInferRequest::Ptr&               inferRequest,
+                                        const bool                                      needPerfCounters,
+                                        const InferenceEngine::SoIInferRequestInternal& inferRequestWithoutBatch,
+                                        const InferenceEngine::ITaskExecutor::Ptr&      callbackExecutor);
+    void Infer_ThreadUnsafe() override;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+    ~AutoBatchAsyncInferRequest();
+
+    // the request of the network without batching, executes the sample when the batch is not collected in time
+    InferenceEngine::SoIInferRequestInternal                            _inferRequestWithoutBatch;
+    AutoBatchInferRequest::Ptr                                          _inferRequest;
+    std::exception_ptr                                                  _exceptionPtr = nullptr;
+    bool                                                                _wasBatched = false;
+
+protected:
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>  _perfMap;
+    bool                                                                _needPerfCounters = false;
+};
+
+class AutoBatchInferencePlugin : public InferenceEngine::IInferencePlugin {
+public:
+    AutoBatchInferencePlugin();
+    ~AutoBatchInferencePlugin() = default;
+
+    InferenceEngine::IExecutableNetworkInternal::Ptr LoadExeNetworkImpl(const InferenceEngine::CNNNetwork&        network,
+                                                                       const std::map<std::string, std::string>& config) override;
+
+    void SetConfig(const std::map<std::string, std::string>& config) override;
+    InferenceEngine::Parameter GetConfig(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override;
+    InferenceEngine::QueryNetworkResult QueryNetwork(const InferenceEngine::CNNNetwork&        network,
+                                                     const std::map<std::string, std::string>& config) const override;
+    InferenceEngine::Parameter GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override;
+
+    // parses the "CPU(4)" value of the AUTO_BATCH_DEVICE_CONFIG key
+    DeviceInformation ParseBatchDevice(const std::string& deviceWithBatch,
+                                       const std::map<std::string, std::string>& config) const;
+
+protected:
+    std::map<std::string, std::string> GetSupportedConfig(const std::map<std::string, std::string>& config,
+                                                          const std::string& deviceName) const;
+};
+
+}  // namespace AutoBatchPlugin
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <utility>
 #include <cstdint>
 #include <cstdio>
 #include <gna_plugin_log.hpp>
@@ -13,8 +14,11 @@
 #include "backend/gna_limitations.hpp"
 #include "gna_lib_ver_selector.hpp"
 #include "layers/gna_convolution_layer.hpp"
+#include "parallel.hpp"
 
 using namespace GNAPluginNS::GNAConvolutionLayer;
+using GNAPluginNS::runtime::dot_product;
+using GNAPluginNS::runtime::parallel_for_chunks;
 
 void CNNFilter32(intel_dnn_component_t *component) {
     auto filters = reinterpret_cast<float *>(component->op.conv1D.ptr_filters);
@@ -37,15 +41,15 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < numberOfOutputsPerFilter; j++, input += convolutionStride, output += numberOfFilters) {
-        auto filter = filters;
-        for (uint32_t i = 0; i < numberOfFilters; i++, filter += filterSize) {
-            output[i] = biases[i];
-            for (uint32_t k = 0; k < filterSize; k++) {
-                output[i] += input[k] * filter[k];
+    parallel_for_chunks(numberOfOutputsPerFilter, numberOfFilters * filterSize, [&](size_t start, size_t end) {
+        for (size_t j = start; j < end; j++) {
+            const float *inputWindow = input + j * convolutionStride;
+            float *outputs = output + j * numberOfFilters;
+            for (uint32_t i = 0; i < numberOfFilters; i++) {
+                outputs[i] = biases[i] + dot_product(inputWindow, filters + i * filterSize, filterSize);
             }
         }
-    }
+    });
 }
 
 void CNNMaxPoolLegacy(intel_dnn_component_t *component, intel_dnn_number_type_t number_type, const bool sumPoolingOverRide) {
@@ -101,30 +105,28 @@ void CNNMaxPoolLegacy(intel_dnn_component_t *component, intel_dnn_number_type_t
         float *ptr_inputs = reinterpret_cast<float *>(component->ptr_inputs);
         float *ptr_outputs = reinterpret_cast<float *>(component->ptr_outputs);
 
-        for (uint32_t i = 0; i < in_c; i++) {
-            int32_t m = 0;
-            if (sumPoolingOverRide) {
-                for (uint32_t j = 0; j < num_rows_in; j += num_pool_step) {
-                    float sum = 0.0;
-                    uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
-                    for (uint32_t k = j; k < num_end; k++) {
-                        sum += ptr_inputs[k * in_c + i];
-                    }
-                    ptr_outputs[m * in_c + i] = sum;
-                    m++;
-                }
-            } else {
-                for (uint32_t j = 0; j < num_rows_in; j += num_pool_step) {
-                    float max = std::numeric_limits<float>::lowest();
-                    uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
-                    for (uint32_t k = j; k < num_end; k++) {
-                        if (ptr_inputs[k * in_c + i] > max) max = ptr_inputs[k * in_c + i];
+        // every pooling window is reduced for all channels at once, so the inner loop runs over contiguous memory
+        const uint32_t num_windows = (num_rows_in + num_pool_step - 1) / num_pool_step;
+        parallel_for_chunks(num_windows, num_pool_size * in_c, [&](size_t start, size_t end) {
+            for (size_t m = start; m < end; m++) {
+                const uint32_t j = m * num_pool_step;
+                const uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
+                float *output = ptr_outputs + m * in_c;
+                std::fill_n(output, in_c, sumPoolingOverRide ? 0.0f : std::numeric_limits<float>::lowest());
+                for (uint32_t k = j; k < num_end; k++) {
+                    const float *input = ptr_inputs + k * in_c;
+                    if (sumPoolingOverRide) {
+                        for (uint32_t i = 0; i < in_c; i++) {
+                            output[i] += input[i];
+                        }
+                    } else {
+                        for (uint32_t i = 0; i < in_c; i++) {
+                            output[i] = (std::max)(output[i], input[i]);
+                        }
                     }
-                    ptr_outputs[m * in_c + i] = max;
-                    m++;
                 }
             }
-        }
+        });
     }
 }
 
@@ -137,23 +139,6 @@ T getQubeIndex(T a1, T a2, T a3, T A2, T A3) {
 }
 } // namespace
 
-float MaxPool2D32SingleHWC(const unsigned poolWinH, const unsigned poolWinW,
-    const float* input, const unsigned IH, const unsigned IW, const unsigned IC,
-    const unsigned oh, const unsigned ow, const unsigned oc,
-    const uint32_t poolStrideH,
-    const uint32_t poolStrideW) {
-    float output = std::numeric_limits<float>::lowest();
-    const auto winStartH = oh * poolStrideH;
-    const auto winStartW = ow * poolStrideW;
-    for (unsigned winIdxH = 0; winIdxH < poolWinH && winStartH + winIdxH < IH; winIdxH++) {
-        for (unsigned winIdxW = 0; winIdxW < poolWinW && winStartW + winIdxW < IW; winIdxW++) {
-            const auto inputIndex = getQubeIndex(winStartH + winIdxH, winStartW + winIdxW, oc, IW, IC);
-            output = (std::max)(output, input[inputIndex]);
-        }
-    }
-    return output;
-}
-
 void CNNMaxPool2DFloat(intel_dnn_component_t* component) {
     float* ptr_inputs = reinterpret_cast<float*>(component->ptr_inputs);
     float* ptr_outputs = reinterpret_cast<float*>(component->ptr_outputs);
@@ -170,66 +155,40 @@ void CNNMaxPool2DFloat(intel_dnn_component_t* component) {
     const auto poolStrideW = component->op.maxpool.poolingStrideXY[0];
     const auto poolStrideH = component->op.maxpool.poolingStrideXY[1];
 
-    for (unsigned oc = 0; oc < OC; oc++) {
-        for (unsigned ow = 0; ow < OW; ow++) {
-            for (unsigned oh = 0; oh < OH; oh++) {
-                const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = MaxPool2D32SingleHWC(poolWinH, poolWinW,
-                    ptr_inputs, IH, IW, IC,
-                    oh, ow, oc,
-                    poolStrideH,
-                    poolStrideW);
+    // HWC layout: all channels of a pooling window position are contiguous
+    parallel_for_chunks(OH * OW, poolWinH * poolWinW * OC, [&](size_t start, size_t end) {
+        for (size_t position = start; position < end; position++) {
+            const unsigned oh = position / OW;
+            const unsigned ow = position % OW;
+            float* output = ptr_outputs + getQubeIndex<size_t>(oh, ow, 0, OW, OC);
+            std::fill_n(output, OC, std::numeric_limits<float>::lowest());
+            const auto winStartH = oh * poolStrideH;
+            const auto winStartW = ow * poolStrideW;
+            for (unsigned winIdxH = 0; winIdxH < poolWinH && winStartH + winIdxH < IH; winIdxH++) {
+                for (unsigned winIdxW = 0; winIdxW < poolWinW && winStartW + winIdxW < IW; winIdxW++) {
+                    const float* input = ptr_inputs + getQubeIndex<size_t>(winStartH + winIdxH, winStartW + winIdxW, 0, IW, IC);
+                    for (unsigned oc = 0; oc < OC; oc++) {
+                        output[oc] = (std::max)(output[oc], input[oc]);
+                    }
+                }
             }
         }
-    }
+    });
 }
 
 #if GNA_LIB_VER == 2
 
-bool matchesPaddedArea(unsigned filterIndex, unsigned outputIndex, unsigned inputSize, unsigned paddingSize, unsigned stride) {
-    const auto paddedIndex = stride * outputIndex + filterIndex;
-    if (paddedIndex >= inputSize + 2 * paddingSize) {
-        THROW_GNA_EXCEPTION << "In: isZeroPaddingCase, paddedIndex >= inputSize + 2 * paddingSize";
-    }
-    if (paddedIndex < paddingSize || paddedIndex >= inputSize + paddingSize) {
-        return true;
-    }
-    return false;
-}
-
-float CNN2DFilter32SingleHWC(const float bias, const float* filter, const unsigned KH, const unsigned KW, const unsigned KC,
-    const float* image, const unsigned IH, const unsigned IW, const unsigned IC,
-    const unsigned oh, const unsigned ow, const unsigned oc,
-    const std::array<uint32_t, 2>& convStride,
-    const std::array<uint32_t, 2>& zeroPadding) {
-
-    const auto cSH = convStride[0];
-    const auto cSW = convStride[1];
-
-    const auto zPH = zeroPadding[0];
-    const auto zPW = zeroPadding[1];
-    float output = 0;
-    for (unsigned kh = 0; kh < KH; kh++) {
-        for (unsigned kw = 0; kw < KW; kw++) {
-            for (unsigned kc = 0; kc < KC; kc++) {
-                if (!matchesPaddedArea(kh, oh, IH, zPH, cSH) &&
-                    !matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
-                    const auto ih = (cSH * oh + kh) - zPH;
-                    const auto iw = (cSW * ow + kw) - zPW;
-                    const auto ic = kc;
-                    const auto imageIndex = getQubeIndex(ih, iw, ic, IW, IC);
-                    const auto imageElement = image[imageIndex];
-                    const auto filterIndex = getQubeIndex(kh, kw, kc, KW, KC);
-                    const auto filterElement = filter[filterIndex];
-                    const auto product = imageElement * filterElement;
-                    output += product;
-                }
-            }
-        }
-    }
-    output += bias;
-    return output;
+namespace {
+// range of kernel indices [begin, end) which hit the input and not the zero padding for the given output index
+std::pair<unsigned, unsigned> validKernelRange(unsigned outputIndex, unsigned kernelSize, unsigned inputSize,
+    unsigned paddingSize, unsigned stride) {
+    const int64_t paddedStart = static_cast<int64_t>(stride) * outputIndex;
+    const int64_t begin = (std::max)(int64_t{0}, static_cast<int64_t>(paddingSize) - paddedStart);
+    const int64_t end = (std::min)(static_cast<int64_t>(kernelSize),
+                                   static_cast<int64_t>(inputSize) + paddingSize - paddedStart);
+    return {static_cast<unsigned>(begin), static_cast<unsigned>((std::max)(begin, end))};
 }
+} // namespace
 
 void CNN2DFilter32(intel_dnn_component_t* component) {
     float* ptr_filters = reinterpret_cast<float*>(component->op.conv2D.ptr_filters);
@@ -248,32 +207,55 @@ void CNN2DFilter32(intel_dnn_component_t* component) {
     const auto OW = component->tensors[1].dimensions[2]; // NHWC
     const auto OC = component->tensors[1].dimensions[3]; // NHWC
 
-    const auto kn = component->tensors[2].dimensions[0]; // NHWC
-    const auto kh = component->tensors[2].dimensions[1]; // NHWC
-    const auto kw = component->tensors[2].dimensions[2]; // NHWC
-    const auto kc = component->tensors[2].dimensions[3]; // NHWC
+    const auto KN = component->tensors[2].dimensions[0]; // NHWC
+    const auto KH = component->tensors[2].dimensions[1]; // NHWC
+    const auto KW = component->tensors[2].dimensions[2]; // NHWC
+    const auto KC = component->tensors[2].dimensions[3]; // NHWC
 
-    if (kn != OC) {
+    if (KN != OC) {
         THROW_GNA_EXCEPTION << "Number of filters should be equal to output depth!" << layer_name;
     }
-    if (kc != IC) {
+    if (KC != IC) {
         THROW_GNA_EXCEPTION << "Depth of filter should be equal to input depth!" << layer_name;
     }
-    auto kernelIndex = 0;
-    for (unsigned oc = 0; oc < OC; oc++) {
-        for (unsigned ow = 0; ow < OW; ow++) {
-            for (unsigned oh = 0; oh < OH; oh++) {
-                const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = CNN2DFilter32SingleHWC(*(ptr_biases + oc), ptr_filters + kernelIndex, kh, kw, kc,
-                    ptr_inputs, IH, IW, IC,
-                    oh, ow, oc,
-                    component->op.conv2D.convStride,
-                    component->op.conv2D.zeroPadding);
+
+    const auto cSH = component->op.conv2D.convStride[0];
+    const auto cSW = component->op.conv2D.convStride[1];
+    const auto zPH = component->op.conv2D.zeroPadding[0];
+    const auto zPW = component->op.conv2D.zeroPadding[1];
+    if (OH > 0 && (OH - 1) * cSH + KH > IH + 2 * zPH) {
+        THROW_GNA_EXCEPTION << "Convolution window exceeds padded input height!" << layer_name;
+    }
+    if (OW > 0 && (OW - 1) * cSW + KW > IW + 2 * zPW) {
+        THROW_GNA_EXCEPTION << "Convolution window exceeds padded input width!" << layer_name;
+    }
+
+    // kernel padded to 16B = 4 * sizeof(float)
+    const size_t kernelStride = ALIGN(KH * KW * KC, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
+
+    parallel_for_chunks(OH * OW, OC * KH * KW * KC, [&](size_t start, size_t end) {
+        for (size_t position = start; position < end; position++) {
+            const unsigned oh = position / OW;
+            const unsigned ow = position % OW;
+            const auto rangeH = validKernelRange(oh, KH, IH, zPH, cSH);
+            const auto rangeW = validKernelRange(ow, KW, IW, zPW, cSW);
+            // filter and image share the depth, so the valid part of every kernel row is one contiguous span
+            const size_t span = static_cast<size_t>(rangeW.second - rangeW.first) * KC;
+            float* output = ptr_outputs + getQubeIndex<size_t>(oh, ow, 0, OW, OC);
+            for (unsigned oc = 0; oc < OC; oc++) {
+                const float* filter = ptr_filters + oc * kernelStride;
+                float sum = 0;
+                for (unsigned kh = rangeH.first; kh < rangeH.second; kh++) {
+                    const auto ih = cSH * oh + kh - zPH;
+                    const auto iw = cSW * ow + rangeW.first - zPW;
+                    sum += dot_product(ptr_inputs + getQubeIndex<size_t>(ih, iw, 0, IW, IC),
+                                       filter + getQubeIndex<size_t>(kh, rangeW.first, 0, KW, KC),
+                                       span);
+                }
+                output[oc] = sum + ptr_biases[oc];
             }
         }
-        // kernel padded to 16B = 4 * sizeof(float)
-        kernelIndex += ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
-    }
+    });
 }
 
 #endif
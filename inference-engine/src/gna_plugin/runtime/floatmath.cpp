@@ -1,13 +1,34 @@
 // Copyright (C) 2018-2021 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines of the software emulation mode
 //
 
 #include <cstdint>
 #include <cstdio>
+#include <vector>
 
 #include "floatmath.h"
+#include "parallel.hpp"
+
+using GNAPluginNS::runtime::dot_product;
+using GNAPluginNS::runtime::parallel_for_chunks;
+
+namespace {
+
+// returns B (rows x cols, leading dimension ld) transposed into a dense cols x rows matrix,
+// so the inner products of the NN gemm read both operands contiguously
+std::vector<float> transpose(const float *B, MKL_INT rows, MKL_INT cols, MKL_INT ld) {
+    std::vector<float> Bt(static_cast<size_t>(rows) * cols);
+    for (MKL_INT k = 0; k < rows; k++) {
+        for (MKL_INT j = 0; j < cols; j++) {
+            Bt[static_cast<size_t>(j) * rows + k] = B[k * ld + j];
+        }
+    }
+    return Bt;
+}
+
+}  // namespace
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -19,44 +40,42 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                   const MKL_INT K, const float alpha, const float *A,
                   const MKL_INT lda, const float *B, const MKL_INT ldb,
                   const float beta, float *C, const MKL_INT ldc) {
-    int i, j, k;
-
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_sgemm!\n");
         throw -1;
     }
 
+    const size_t rowCost = static_cast<size_t>(N) * K;
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+        const auto Bt = transpose(B, K, N, ldb);
+        parallel_for_chunks(M, rowCost, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++) {
+                for (MKL_INT j = 0; j < N; j++) {
+                    const float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
+                    C[i * ldc + j] = sum + dot_product(A + i * lda, Bt.data() + static_cast<size_t>(j) * K, K);
                 }
-                C[i * ldc + j] = sum;
             }
-        }
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum;
-                sum = beta * C[i * ldc + j];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
+        parallel_for_chunks(M, rowCost, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++) {
+                for (MKL_INT j = 0; j < N; j++) {
+                    C[i * ldc + j] = beta * C[i * ldc + j] + alpha * dot_product(A + i * lda, B + j * ldb, K);
                 }
-                C[i * ldc + j] = sum;
             }
-        }
+        });
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
+        parallel_for_chunks(M, rowCost, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++) {
+                for (MKL_INT j = 0; j < N; j++) {
+                    float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
+                    for (MKL_INT k = 0; k < K; k++) {
+                        sum += A[k * lda + i] * B[k * ldb + j];
+                    }
+                    C[i * ldc + j] = sum;
                 }
-                C[i * ldc + j] = sum;
             }
-        }
+        });
     } else {
         fprintf(stderr, "Expected A not transposed in cblas_sgemm!\n");
         throw -1;
@@ -97,47 +116,44 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
                         const MKL_INT lda, const float *B, const MKL_INT ldb,
                         const float beta, float *C, const MKL_INT ldc,
                         const uint32_t *OutputList, const MKL_INT L) {
-    int i, j, k, l;
-
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_sgemm_subset!\n");
         throw -1;
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+        const auto Bt = transpose(B, K, N, ldb);
+        parallel_for_chunks(L, static_cast<size_t>(N) * K, [&](size_t start, size_t end) {
+            for (size_t l = start; l < end; l++) {
+                const size_t i = OutputList[l];
+                for (MKL_INT j = 0; j < N; j++) {
+                    const float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
+                    C[l * ldc + j] = sum + dot_product(A + i * lda, Bt.data() + static_cast<size_t>(j) * K, K);
                 }
-                C[l * ldc + j] = sum;
             }
-        }
+        });
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
-        for (i = 0; i < M; i++) {
-            for (l = 0; l < L; l++) {
-                float sum;
-                j = OutputList[l];
-                sum = beta * C[i * ldc + l];
-                for (k = 0; k < K; k++) {
-                    sum += alpha * A[i * lda + k] * B[j * ldb + k];
+        parallel_for_chunks(M, static_cast<size_t>(L) * K, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++) {
+                for (MKL_INT l = 0; l < L; l++) {
+                    const size_t j = OutputList[l];
+                    C[i * ldc + l] = beta * C[i * ldc + l] + alpha * dot_product(A + i * lda, B + j * ldb, K);
                 }
-                C[i * ldc + l] = sum;
             }
-        }
+        });
     } else if ((TransA == CblasTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[k * lda + i] * B[k * ldb + j];
+        parallel_for_chunks(L, static_cast<size_t>(N) * K, [&](size_t start, size_t end) {
+            for (size_t l = start; l < end; l++) {
+                const size_t i = OutputList[l];
+                for (MKL_INT j = 0; j < N; j++) {
+                    float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
+                    for (MKL_INT k = 0; k < K; k++) {
+                        sum += A[k * lda + i] * B[k * ldb + j];
+                    }
+                    C[l * ldc + j] = sum;
                 }
-                C[l * ldc + j] = sum;
             }
-        }
+        });
     } else {
         fprintf(stderr, "Expected A not transposed in cblas_sgemm_subset!\n");
         throw -1;
@@ -153,20 +169,14 @@ void sgemv_split(const uint32_t N,
                  const float *X,
                  const float *B,
                  float *C) {
-    uint32_t num_columns = K1 + K2;
-    uint32_t num_rows = N;
-    uint32_t i, j;
+    const size_t num_columns = K1 + K2;
 
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
+    parallel_for_chunks(N, num_columns, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            const float *Xrow = X + i * num_columns;
+            C[i] = B[i] + dot_product(A1, Xrow, K1) + dot_product(A2, Xrow + K1, K2);
         }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
-        }
-        C[i] = sum;
-    }
+    });
 }
 
 #ifdef __cplusplus
@@ -0,0 +1,63 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include <ie_parallel.hpp>
+
+namespace GNAPluginNS {
+namespace runtime {
+
+/**
+ * @brief Splits [0, work_amount) into contiguous chunks and calls func(start, end) for each of them in parallel.
+ * The number of threads is limited by the total cost, so small primitives run in the calling thread.
+ * @param cost_per_item approximate number of floating point operations required by one item
+ */
+template <typename F>
+void parallel_for_chunks(size_t work_amount, size_t cost_per_item, const F& func) {
+    constexpr size_t min_cost_per_thread = 1 << 15;
+    const size_t max_threads = static_cast<size_t>(parallel_get_max_threads());
+    const size_t nthr = std::min({work_amount * std::max<size_t>(cost_per_item, 1) / min_cost_per_thread,
+                                  work_amount,
+                                  max_threads});
+    if (nthr <= 1) {
+        func(size_t{0}, work_amount);
+        return;
+    }
+    InferenceEngine::parallel_nt(static_cast<int>(nthr), [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(work_amount, nthr, ithr, start, end);
+        if (start < end) {
+            func(start, end);
+        }
+    });
+}
+
+/**
+ * @brief Dot product with several independent partial sums, so the compiler keeps them in vector registers
+ */
+inline float dot_product(const float* a, const float* b, size_t size) {
+    constexpr size_t lanes = 8;
+    float partial[lanes] = {};
+    size_t i = 0;
+    for (; i + lanes <= size; i += lanes) {
+        for (size_t l = 0; l < lanes; l++) {
+            partial[l] += a[i + l] * b[i + l];
+        }
+    }
+    float sum = 0.0f;
+    for (size_t l = 0; l < lanes; l++) {
+        sum += partial[l];
+    }
+    for (; i < size; i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -28,6 +28,7 @@
 #include "gna_plugin_log.hpp"
 #include "gna_slope_scale.h"
 #include "round_float_define.hpp"
+#include "parallel.hpp"
 
 double first_deriv_tanh(const double x) { return(1.0 - tanh(x) * tanh(x)); }
 double first_deriv_exp(const double x) { return(exp(x)); }
@@ -952,11 +953,12 @@ void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     }
 }
 
-void PwlApply32(intel_dnn_component_t *component,
-                uint32_t num_row_start,
-                uint32_t num_row_end,
-                uint32_t num_col_start,
-                uint32_t num_col_end) {
+namespace {
+void PwlApply32Rows(intel_dnn_component_t *component,
+                    uint32_t num_row_start,
+                    uint32_t num_row_end,
+                    uint32_t num_col_start,
+                    uint32_t num_col_end) {
     intel_piecewiselinear_t *transform = reinterpret_cast<intel_piecewiselinear_t *>(&component->op.pwl);
     float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
     float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
@@ -1106,8 +1108,42 @@ void PwlApply32(intel_dnn_component_t *component,
             }
             break;
         }
-        case kActCustom:
         default:
-            THROW_GNA_EXCEPTION << component->original_layer_name << ", Unknown piecewise linear function type: " << transform->func_id.type;
+            break;
+    }
+}
+}  // namespace
+
+void PwlApply32(intel_dnn_component_t *component,
+                uint32_t num_row_start,
+                uint32_t num_row_end,
+                uint32_t num_col_start,
+                uint32_t num_col_end) {
+    // validated up front, so no exception is thrown from the worker threads
+    switch (component->op.pwl.func_id.type) {
+        case kActSigmoid:
+        case kActTanh:
+        case kActSoftSign:
+        case kActRelu:
+        case kActIdentity:
+        case kActKaldiLstmClipping:
+        case kActExp:
+        case kActLog:
+        case kActAbs:
+        case kActSign:
+        case kActNegLog:
+        case kActNegHalfLog:
+        case kActPow:
+        case kActFakeQuantize:
+            break;
+        default:
+            THROW_GNA_EXCEPTION << component->original_layer_name << ", Unknown piecewise linear function type: "
+                                << component->op.pwl.func_id.type;
     }
+    // the rows are independent, activations are roughly 16 flops per element
+    const size_t num_rows = num_row_end - num_row_start + 1;
+    const size_t row_cost = 16 * (num_col_end - num_col_start + 1);
+    GNAPluginNS::runtime::parallel_for_chunks(num_rows, row_cost, [&](size_t start, size_t end) {
+        PwlApply32Rows(component, num_row_start + start, num_row_start + end - 1, num_col_start, num_col_end);
+    });
 }
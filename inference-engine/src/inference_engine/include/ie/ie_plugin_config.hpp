@@ -405,6 +405,34 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
  */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
+/**
+ * @brief This key defines the maximum total size in bytes of compiled blobs stored in CACHE_DIR.
+ *
+ * When the limit is exceeded, least recently used blobs are removed from the cache directory.
+ * If this key is not specified or value is "0", the cache size is not limited.
+ *
+ * @code
+ * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}, {CONFIG_KEY(CACHE_MAX_SIZE), "1073741824"}});
+ * @endcode
+ */
+DECLARE_CONFIG_KEY(CACHE_MAX_SIZE);
+
+/**
+ * @brief The key for the BATCH device: the target device with the batch size in brackets, e.g. "CPU(4)".
+ *
+ * The network is loaded to the target device with the given batch, single-sample requests are collected into
+ * batches. The key is set implicitly when the network is loaded to the "BATCH:CPU(4)" device.
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG);
+
+/**
+ * @brief The key for the BATCH device: the time in milliseconds a request waits for the batch to be collected.
+ *
+ * When the timeout expires, the collected requests are executed one by one by the network with the original batch.
+ * The default value is "1000".
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_TIMEOUT);
+
 }  // namespace PluginConfigParams
 
 /**
@@ -12,13 +12,26 @@
 #endif
 #include <xml_parse_utils.h>
 
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
 #include "file_utils.h"
+#include "ie_data_hash.hpp"
 #include "ie_itt.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/variant.hpp"
-#include "openvino/pass/serialize.hpp"
+#include "openvino/op/loop.hpp"
+#include "openvino/op/util/framework_node.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/op/util/variable.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
@@ -39,27 +52,214 @@ static int32_t as_int32_t(T v) {
     return static_cast<int32_t>(v);
 }
 
-class OstreamHashWrapper final : public std::streambuf {
-    std::size_t m_res = 0;
+// Walks the function once and hashes everything that Serialize would put into IR:
+// op types, versions, names, attributes, port types and shapes, connectivity and constant payloads.
+class FunctionHasher final : public ngraph::AttributeVisitor {
+    std::size_t m_seed;
+
+    template <typename T>
+    void add(const T& value) {
+        m_seed = hash_combine(m_seed, value);
+    }
+
+    template <typename T>
+    void add_vector(const std::vector<T>& values) {
+        add(values.size());
+        for (const auto& v : values) {
+            add(v);
+        }
+    }
+
+    void add_shape(const ngraph::PartialShape& shape) {
+        add(shape.rank().is_dynamic());
+        if (shape.rank().is_static()) {
+            for (const auto& dim : shape) {
+                add(dim.get_min_length());
+                add(dim.get_max_length());
+            }
+        }
+    }
 
 public:
+    explicit FunctionHasher(std::size_t seed) : m_seed(seed) {}
+
     std::size_t getResult() const {
-        return m_res;
+        return m_seed;
     }
-    std::streamsize xsputn(const char* s, std::streamsize n) override {
-        const std::int64_t* intS = (const std::int64_t*)s;
-        std::streamsize n64 = n / sizeof(std::int64_t);
-        std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
+
+    void hash_function(const ngraph::Function& f) {
+        std::unordered_map<const ngraph::Node*, std::size_t> ids;
+        for (const auto& node : f.get_ordered_ops()) {
+            const std::size_t id = ids.size();
+            ids[node.get()] = id;
+
+            const auto& typeInfo = node->get_type_info();
+            add(std::string(typeInfo.name));
+            add(typeInfo.version);
+            add(node->get_friendly_name());
+
+            for (const auto& input : node->inputs()) {
+                const auto source = input.get_source_output();
+                const auto producer = ids.find(source.get_node());
+                IE_ASSERT(producer != ids.end());
+                add(producer->second);
+                add(source.get_index());
+            }
+            for (const auto& output : node->outputs()) {
+                add(output.get_element_type().get_type_name());
+                add_shape(output.get_partial_shape());
+                // names are kept in unordered_set, its iteration order differs between processes
+                const auto& tensorNames = output.get_tensor().get_names();
+                std::vector<std::string> names(tensorNames.begin(), tensorNames.end());
+                std::sort(names.begin(), names.end());
+                add_vector(names);
+            }
+
+            node->visit_attributes(*this);
         }
+        for (const auto& param : f.get_parameters()) {
+            add(ids[param.get()]);
+        }
+        for (const auto& result : f.get_results()) {
+            add(ids[result.get()]);
+        }
+    }
 
-        std::streamsize rest = n % sizeof(std::int64_t);
-        for (i = 0; i < rest; i++) {
-            m_res += s[n - rest + i];
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        using InputDescriptions = std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::InputDescription>>;
+        using OutputDescriptions = std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::OutputDescription>>;
+        add(name);
+        if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+                &adapter)) {
+            const auto& buffer = a->get();
+            add(buffer->size());
+            add(hashData(buffer->get_ptr(), buffer->size()));
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<InputDescriptions>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                add(std::string(desc->get_type_info().name));
+                add(desc->m_input_index);
+                add(desc->m_body_parameter_index);
+                if (auto slice = ov::as_type_ptr<ov::op::util::MultiSubGraphOp::SliceInputDescription>(desc)) {
+                    add_vector(std::vector<int64_t>{slice->m_start,
+                                                    slice->m_stride,
+                                                    slice->m_part_size,
+                                                    slice->m_end,
+                                                    slice->m_axis});
+                } else if (auto merged =
+                               ov::as_type_ptr<ov::op::util::MultiSubGraphOp::MergedInputDescription>(desc)) {
+                    add(merged->m_body_value_index);
+                }
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<OutputDescriptions>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                add(std::string(desc->get_type_info().name));
+                add(desc->m_body_value_index);
+                add(desc->m_output_index);
+                if (auto concat = ov::as_type_ptr<ov::op::util::MultiSubGraphOp::ConcatOutputDescription>(desc)) {
+                    add_vector(std::vector<int64_t>{concat->m_start,
+                                                    concat->m_stride,
+                                                    concat->m_part_size,
+                                                    concat->m_end,
+                                                    concat->m_axis});
+                } else if (auto body = ov::as_type_ptr<ov::op::util::MultiSubGraphOp::BodyOutputDescription>(desc)) {
+                    add(body->m_iteration);
+                }
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ov::op::v5::Loop::SpecialBodyPorts>>(
+                       &adapter)) {
+            add(a->get().current_iteration_input_idx);
+            add(a->get().body_condition_output_idx);
+        } else if (const auto& a =
+                       ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ov::op::util::Variable>>>(&adapter)) {
+            const auto& info = a->get()->get_info();
+            add(info.variable_id);
+            add(info.data_type.get_type_name());
+            add_shape(info.data_shape);
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ov::op::util::FrameworkNodeAttrs>>(
+                       &adapter)) {
+            const auto& attrs = a->get();
+            add(attrs.get_type_name());
+            add(attrs.get_opset_name());
+            for (const auto& attr : attrs) {
+                add(attr.first);
+                add(attr.second);
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::element::TypeVector>>(&adapter)) {
+            for (const auto& type : a->get()) {
+                add(type.get_type_name());
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::set<std::string>>>(&adapter)) {
+            for (const auto& value : a->get()) {
+                add(value);
+            }
+        } else {
+            IE_THROW() << "Unsupported attribute type for model cache hash computation: " << name;
         }
-        return n;
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        add(name);
+        add(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        add(name);
+        add(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        add(name);
+        add(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        add(name);
+        add(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        add(name);
+        add_vector(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        add(name);
+        add_vector(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        add(name);
+        add_vector(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        add(name);
+        add_vector(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        add(name);
+        add_vector(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        add(name);
+        add_vector(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        add(name);
+        add_vector(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        add(name);
+        add_vector(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        add(name);
+        add_vector(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        add(name);
+        add_vector(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        add(name);
+        add_vector(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override {
+        add(name);
+        hash_function(*adapter.get());
     }
 };
 
@@ -88,22 +288,14 @@ std::string NetworkCompilationContext::calculateFileInfo(const std::string& file
 std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
                                                    const std::map<std::string, std::string>& compileOptions) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_LT, "NetworkCompilationContext::computeHash - CNN");
-    OstreamHashWrapper xmlHash;
-    OstreamHashWrapper binHash;
-    std::ostream xml(&xmlHash);
-    std::ostream bin(&binHash);
-
     IE_ASSERT(network.getFunction());
 
-    // 1. Serialize
-    CNNNetwork net(network);
-    ov::pass::Serialize serializer(xml, bin);
-    serializer.run_on_function(net.getFunction());
+    // 1. Compute hash on function structure, attributes and weights
+    FunctionHasher hasher(0);
+    hasher.hash_function(*network.getFunction());
 
-    // 2. Compute hash on serialized data and options
-    size_t seed = 0;
-    seed = hash_combine(seed, xmlHash.getResult());
-    seed = hash_combine(seed, binHash.getResult());
+    // 2. Add compile options
+    size_t seed = hasher.getResult();
 
     for (const auto& kvp : compileOptions) {
         seed = hash_combine(seed, kvp.first + kvp.second);
@@ -178,12 +370,260 @@ std::string NetworkCompilationContext::computeHash(const std::string& modelName,
 
 //////////////////////////////////////////////////
 
+namespace {
+
+// Checksum of compiled blob data. Data is hashed in fixed-size blocks, so the result doesn't depend on
+// how the data is split by writes or reads.
+class BlobChecksum final {
+    static constexpr std::size_t blockSize = 1 << 20;
+    std::vector<char> m_block;
+    std::size_t m_filled = 0;
+    uint64_t m_size = 0;
+    uint64_t m_state = 0;
+
+    void consume(const char* data, std::size_t size) {
+        m_state = hashBytes(data, size, m_state);
+    }
+
+public:
+    BlobChecksum() : m_block(blockSize) {}
+
+    void update(const char* data, std::size_t size) {
+        m_size += size;
+        while (size > 0) {
+            if (m_filled == 0 && size >= blockSize) {
+                consume(data, blockSize);
+                data += blockSize;
+                size -= blockSize;
+                continue;
+            }
+            const auto n = std::min(size, blockSize - m_filled);
+            std::memcpy(m_block.data() + m_filled, data, n);
+            m_filled += n;
+            data += n;
+            size -= n;
+            if (m_filled == blockSize) {
+                consume(m_block.data(), blockSize);
+                m_filled = 0;
+            }
+        }
+    }
+
+    uint64_t size() const {
+        return m_size;
+    }
+
+    uint64_t finish() {
+        if (m_filled > 0) {
+            consume(m_block.data(), m_filled);
+            m_filled = 0;
+        }
+        return hashBytes(&m_size, sizeof(m_size), m_state);
+    }
+};
+
+// Forwards everything to the target stream buffer and computes checksum of the written data
+class ChecksumStreamBuf final : public std::streambuf {
+    std::streambuf* m_target;
+    std::vector<char> m_buffer;
+    BlobChecksum m_checksum;
+
+    bool flushBuffer() {
+        const auto n = pptr() - pbase();
+        if (n > 0) {
+            if (m_target->sputn(pbase(), n) != n) {
+                return false;
+            }
+            m_checksum.update(pbase(), static_cast<std::size_t>(n));
+            setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+        }
+        return true;
+    }
+
+protected:
+    int_type overflow(int_type c) override {
+        if (!flushBuffer()) {
+            return traits_type::eof();
+        }
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(c);
+            pbump(1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        if (n < epptr() - pptr()) {
+            return std::streambuf::xsputn(s, n);
+        }
+        if (!flushBuffer()) {
+            return 0;
+        }
+        const auto written = m_target->sputn(s, n);
+        m_checksum.update(s, static_cast<std::size_t>(written));
+        return written;
+    }
+
+    int sync() override {
+        return flushBuffer() ? m_target->pubsync() : -1;
+    }
+
+public:
+    explicit ChecksumStreamBuf(std::streambuf* target) : m_target(target), m_buffer(64 * 1024) {
+        setp(m_buffer.data(), m_buffer.data() + m_buffer.size());
+    }
+
+    uint64_t dataSize() const {
+        return m_checksum.size();
+    }
+
+    uint64_t checksum() {
+        return m_checksum.finish();
+    }
+};
+
+// Reads the source stream buffer and computes checksum of the data from the initial position to the end.
+// Positions are the ones of the source, so the reader may seek. The data is hashed on the first read only,
+// the part skipped by the reader is read by `finish()`.
+class ChecksumReadStreamBuf final : public std::streambuf {
+    std::streambuf* m_source;
+    std::vector<char> m_buffer;
+    BlobChecksum m_checksum;
+    // source position of the buffer beginning and the end of the hashed data
+    off_type m_bufferPos;
+    off_type m_hashedEnd;
+
+    void hash(off_type pos, const char* data, std::streamsize size) {
+        const auto end = pos + size;
+        if (pos <= m_hashedEnd && end > m_hashedEnd) {
+            const auto skip = m_hashedEnd - pos;
+            m_checksum.update(data + skip, static_cast<std::size_t>(size - skip));
+            m_hashedEnd = end;
+        }
+    }
+
+    pos_type reposition(pos_type pos) {
+        if (pos == pos_type(off_type(-1))) {
+            return pos;
+        }
+        m_bufferPos = off_type(pos);
+        setg(m_buffer.data(), m_buffer.data(), m_buffer.data());
+        return pos;
+    }
+
+protected:
+    int_type underflow() override {
+        const auto pos = m_bufferPos + (egptr() - eback());
+        const auto n = m_source->sgetn(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        if (n <= 0) {
+            return traits_type::eof();
+        }
+        hash(pos, m_buffer.data(), n);
+        m_bufferPos = pos;
+        setg(m_buffer.data(), m_buffer.data(), m_buffer.data() + n);
+        return traits_type::to_int_type(*gptr());
+    }
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        const auto current = m_bufferPos + (gptr() - eback());
+        if (dir == std::ios_base::cur) {
+            if (off == 0) {
+                return pos_type(current);  // tellg()
+            }
+            return reposition(m_source->pubseekpos(pos_type(current + off), which));
+        }
+        return reposition(m_source->pubseekoff(off, dir, which));
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return reposition(m_source->pubseekpos(pos, which));
+    }
+
+public:
+    ChecksumReadStreamBuf(std::streambuf* source, pos_type dataPos)
+        : m_source(source),
+          m_buffer(64 * 1024),
+          m_bufferPos(off_type(dataPos)),
+          m_hashedEnd(off_type(dataPos)) {
+        setg(m_buffer.data(), m_buffer.data(), m_buffer.data());
+    }
+
+    uint64_t dataSize() const {
+        return m_checksum.size();
+    }
+
+    uint64_t finish() {
+        if (reposition(m_source->pubseekpos(pos_type(m_hashedEnd), std::ios_base::in)) != pos_type(off_type(-1))) {
+            while (underflow() != traits_type::eof()) {
+                setg(m_buffer.data(), egptr(), egptr());
+            }
+        }
+        return m_checksum.finish();
+    }
+};
+
+// Fixed width is required to overwrite header in place once checksum is known
+std::string toFixedHex(uint64_t value) {
+    std::stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << value;
+    return ss.str();
+}
+
+uint64_t fromHex(const std::string& value) {
+    return value.empty() ? 0 : std::stoull(value, nullptr, 16);
+}
+
+}  // namespace
+
 CompiledBlobHeader::CompiledBlobHeader() {}
 
 CompiledBlobHeader::CompiledBlobHeader(const std::string& ieVersion, const std::string& fileInfo)
     : m_ieVersion(ieVersion),
       m_fileInfo(fileInfo) {}
 
+void CompiledBlobHeader::writeWithData(std::ostream& stream, const std::function<void(std::ostream&)>& writer) {
+    const auto headerPos = stream.tellp();
+    m_dataSize = 0;
+    m_checksum = 0;
+    stream << *this;
+
+    ChecksumStreamBuf checksumBuf(stream.rdbuf());
+    {
+        std::ostream dataStream(&checksumBuf);
+        writer(dataStream);
+        dataStream.flush();
+        if (!dataStream) {
+            IE_THROW() << "Failed to write compiled blob data";
+        }
+    }
+
+    if (headerPos != std::streampos(-1)) {
+        m_dataSize = checksumBuf.dataSize();
+        m_checksum = checksumBuf.checksum();
+        const auto endPos = stream.tellp();
+        stream.seekp(headerPos);
+        stream << *this;
+        stream.seekp(endPos);
+    }
+}
+
+bool CompiledBlobHeader::readWithData(std::istream& stream, const std::function<void(std::istream&)>& reader) const {
+    const auto dataPos = stream.tellg();
+    if ((m_dataSize == 0 && m_checksum == 0) || dataPos == std::streampos(-1)) {
+        // Header was written to non-seekable stream, nothing to check
+        reader(stream);
+        return true;
+    }
+
+    ChecksumReadStreamBuf checksumBuf(stream.rdbuf(), dataPos);
+    {
+        std::istream dataStream(&checksumBuf);
+        reader(dataStream);
+    }
+    const auto checksum = checksumBuf.finish();
+    return checksumBuf.dataSize() == m_dataSize && checksum == m_checksum;
+}
+
 std::istream& operator>>(std::istream& stream, CompiledBlobHeader& header) {
     std::string xmlStr;
     std::getline(stream, xmlStr);
@@ -198,6 +638,8 @@ std::istream& operator>>(std::istream& stream, CompiledBlobHeader& header) {
     pugi::xml_node compiledBlobNode = document.document_element();
     header.m_ieVersion = XMLParseUtils::GetStrAttr(compiledBlobNode, "ie_version");
     header.m_fileInfo = XMLParseUtils::GetStrAttr(compiledBlobNode, "file_info");
+    header.m_dataSize = fromHex(XMLParseUtils::GetStrAttr(compiledBlobNode, "data_size", ""));
+    header.m_checksum = fromHex(XMLParseUtils::GetStrAttr(compiledBlobNode, "checksum", ""));
 
     return stream;
 }
@@ -207,6 +649,8 @@ std::ostream& operator<<(std::ostream& stream, const CompiledBlobHeader& header)
     auto compiledBlobNode = document.append_child("compiled_blob");
     compiledBlobNode.append_attribute("ie_version").set_value(header.m_ieVersion.c_str());
     compiledBlobNode.append_attribute("file_info").set_value(header.m_fileInfo.c_str());
+    compiledBlobNode.append_attribute("data_size").set_value(toFixedHex(header.m_dataSize).c_str());
+    compiledBlobNode.append_attribute("checksum").set_value(toFixedHex(header.m_checksum).c_str());
 
     document.save(stream, nullptr, pugi::format_raw);
     document.reset();
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <istream>
 #include <map>
 #include <ostream>
@@ -25,6 +27,8 @@ struct NetworkCompilationContext final {
 class CompiledBlobHeader final {
     std::string m_ieVersion;
     std::string m_fileInfo;
+    uint64_t m_dataSize = 0;
+    uint64_t m_checksum = 0;
 
 public:
     CompiledBlobHeader();
@@ -38,6 +42,27 @@ public:
         return m_fileInfo;
     }
 
+    uint64_t getDataSize() const {
+        return m_dataSize;
+    }
+
+    uint64_t getChecksum() const {
+        return m_checksum;
+    }
+
+    /**
+     * @brief Writes the header followed by data produced by `writer`.
+     * Size and checksum of the data are stored in the header if `stream` supports seeking.
+     */
+    void writeWithData(std::ostream& stream, const std::function<void(std::ostream&)>& writer);
+
+    /**
+     * @brief Reads data following the header by `reader` and checks that it matches stored size and checksum.
+     * The data is checked as `reader` reads it, only the part it skipped is read once more.
+     * @return true if data is valid or the header has no checksum
+     */
+    bool readWithData(std::istream& stream, const std::function<void(std::istream&)>& reader) const;
+
     friend std::istream& operator>>(std::istream& stream, CompiledBlobHeader& header);
 
     friend std::ostream& operator<<(std::ostream& stream, const CompiledBlobHeader& header);
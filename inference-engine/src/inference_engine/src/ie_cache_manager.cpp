@@ -0,0 +1,169 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_cache_manager.hpp"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#    include <sys/utime.h>
+#else
+#    include <utime.h>
+#endif
+
+#include "details/ie_exception.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+const std::string blobExt = ".blob";
+const std::string tempExt = ".tmp";
+
+// Temporary files older than this are considered to be left by crashed writers
+constexpr std::time_t staleTempFileAgeSec = 24 * 60 * 60;
+
+bool endsWith(const std::string& str, const std::string& suffix) {
+    return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+struct CacheFileInfo {
+    std::string path;
+    uint64_t size;
+    std::time_t lastAccess;
+};
+
+// The C runtime functions have the underscore prefix on Windows
+bool getFileInfo(const std::string& path, CacheFileInfo& result) {
+#ifdef _WIN32
+    struct _stat info;
+    if (_stat(path.c_str(), &info) != 0) {
+        return false;
+    }
+#else
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0) {
+        return false;
+    }
+#endif
+    result = {path, static_cast<uint64_t>(info.st_size), info.st_mtime};
+    return true;
+}
+
+void touchFile(const std::string& path) {
+#ifdef _WIN32
+    _utime(path.c_str(), nullptr);
+#else
+    utime(path.c_str(), nullptr);
+#endif
+}
+
+}  // namespace
+
+std::string FileStorageCacheManager::getTempFile(const std::string& blobHash) const {
+    // Unique per writer, so concurrent writers (threads or processes) of the same entry don't interfere
+    std::stringstream ss;
+    ss << blobHash << "." << std::hash<std::thread::id>()(std::this_thread::get_id()) << "_"
+       << std::chrono::high_resolution_clock::now().time_since_epoch().count() << tempExt;
+    return FileUtils::makePath(m_cachePath, ss.str());
+}
+
+void FileStorageCacheManager::writeCacheEntry(const std::string& id, StreamWriter writer) {
+    auto tempFileName = getTempFile(id);
+    try {
+        {
+            std::ofstream stream(tempFileName, std::ios_base::binary | std::ofstream::out);
+            writer(stream);
+            stream.close();
+            if (!stream) {
+                IE_THROW() << "Failed to write cache entry to " << tempFileName;
+            }
+        }
+
+        // Publish completely written entry
+        auto blobFileName = getBlobFile(id);
+        if (std::rename(tempFileName.c_str(), blobFileName.c_str()) != 0) {
+            // Some platforms don't allow to rename over existing file
+            std::remove(blobFileName.c_str());
+            if (std::rename(tempFileName.c_str(), blobFileName.c_str()) != 0) {
+                IE_THROW() << "Failed to publish cache entry " << blobFileName;
+            }
+        }
+    } catch (...) {
+        std::remove(tempFileName.c_str());
+        throw;
+    }
+
+    if (m_maxCacheSize > 0) {
+        evict();
+    }
+}
+
+void FileStorageCacheManager::readCacheEntry(const std::string& id, StreamReader reader) {
+    auto blobFileName = getBlobFile(id);
+    if (FileUtils::fileExist(blobFileName)) {
+        // Modification time is used as access time for LRU eviction, as 'atime' is often not updated by OS
+        touchFile(blobFileName);
+        std::ifstream stream(blobFileName, std::ios_base::binary);
+        reader(stream);
+    }
+}
+
+void FileStorageCacheManager::evict() {
+    std::lock_guard<std::mutex> lock(m_evictMutex);
+
+    std::vector<CacheFileInfo> entries;
+    uint64_t totalSize = 0;
+    const auto now = std::time(nullptr);
+    try {
+        ov::util::iterate_files(
+            m_cachePath,
+            [&](const std::string& file, bool isDir) {
+                if (isDir) {
+                    return;
+                }
+                CacheFileInfo info;
+                if (!getFileInfo(file, info)) {
+                    return;
+                }
+                if (endsWith(file, blobExt)) {
+                    entries.push_back(info);
+                    totalSize += info.size;
+                } else if (endsWith(file, tempExt) && now - info.lastAccess > staleTempFileAgeSec) {
+                    std::remove(file.c_str());
+                }
+            },
+            false);
+    } catch (...) {
+        // cache directory can't be listed, leave it as is
+        return;
+    }
+
+    if (totalSize <= m_maxCacheSize) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const CacheFileInfo& a, const CacheFileInfo& b) {
+        return a.lastAccess < b.lastAccess;
+    });
+    for (const auto& entry : entries) {
+        if (totalSize <= m_maxCacheSize) {
+            break;
+        }
+        // Removal may fail if entry is being read by another process, it will be evicted next time
+        if (std::remove(entry.path.c_str()) == 0) {
+            totalSize -= entry.size;
+        }
+    }
+}
+
+}  // namespace InferenceEngine
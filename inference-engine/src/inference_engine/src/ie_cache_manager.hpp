@@ -12,6 +12,7 @@
 #include <fstream>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "file_utils.h"
@@ -76,21 +77,33 @@ public:
  * @brief File storage-based Implementation of ICacheManager
  *
  * Uses simple file for read/write cached models.
+ * Entries are written to a temporary file first and then renamed, so readers never observe partially written
+ * blobs. If maximum cache size is set, least recently used entries are removed after each write.
  *
  */
 class FileStorageCacheManager final : public ICacheManager {
     std::string m_cachePath;
+    uint64_t m_maxCacheSize;
+    std::mutex m_evictMutex;
 
     std::string getBlobFile(const std::string& blobHash) const {
         return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
 
+    std::string getTempFile(const std::string& blobHash) const;
+
+    void evict();
+
 public:
     /**
      * @brief Constructor
      *
+     * @param cachePath Directory to store cached blobs
+     * @param maxCacheSize Maximum total size of cached blobs in bytes, 0 means no limit
      */
-    FileStorageCacheManager(std::string&& cachePath) : m_cachePath(std::move(cachePath)) {}
+    FileStorageCacheManager(std::string&& cachePath, uint64_t maxCacheSize = 0)
+        : m_cachePath(std::move(cachePath)),
+          m_maxCacheSize(maxCacheSize) {}
 
     /**
      * @brief Destructor
@@ -99,18 +112,9 @@ public:
     ~FileStorageCacheManager() override = default;
 
 private:
-    void writeCacheEntry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
-    }
+    void writeCacheEntry(const std::string& id, StreamWriter writer) override;
 
-    void readCacheEntry(const std::string& id, StreamReader reader) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
-        }
-    }
+    void readCacheEntry(const std::string& id, StreamReader reader) override;
 
     void removeCacheEntry(const std::string& id) override {
         auto blobFileName = getBlobFile(id);
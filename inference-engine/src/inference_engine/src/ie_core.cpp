@@ -74,6 +74,9 @@ Parsed<T> parseDeviceNameIntoConfig(const std::string& deviceName, const std::ma
     } else if (deviceName_.find("MULTI:") == 0) {
         deviceName_ = "MULTI";
         config_[ie::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = deviceName.substr(6);
+    } else if (deviceName_.find("BATCH:") == 0) {
+        deviceName_ = "BATCH";
+        config_[CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG)] = deviceName.substr(6);
     } else if (deviceName.find("AUTO") == 0) {
         deviceName_ = "AUTO";
         if (deviceName.find("AUTO:") == 0) {
@@ -140,23 +143,40 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
     public:
         struct CacheConfig {
             std::string _cacheDir;
+            uint64_t _cacheMaxSize = 0;
             std::shared_ptr<ie::ICacheManager> _cacheManager;
         };
 
         void setAndUpdate(std::map<std::string, std::string>& config) {
             auto it = config.find(CONFIG_KEY(CACHE_DIR));
+            auto sizeIt = config.find(CONFIG_KEY(CACHE_MAX_SIZE));
+            if (it == config.end() && sizeIt == config.end()) {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+            if (sizeIt != config.end()) {
+                try {
+                    _cacheConfig._cacheMaxSize = std::stoull(sizeIt->second);
+                } catch (...) {
+                    IE_THROW() << "Wrong value " << sizeIt->second << " for property key "
+                               << CONFIG_KEY(CACHE_MAX_SIZE) << ". Expected non-negative integer";
+                }
+                config.erase(sizeIt);
+            }
             if (it != config.end()) {
-                std::lock_guard<std::mutex> lock(_cacheConfigMutex);
                 _cacheConfig._cacheDir = it->second;
-                if (!it->second.empty()) {
-                    FileUtils::createDirectoryRecursive(it->second);
-                    _cacheConfig._cacheManager = std::make_shared<ie::FileStorageCacheManager>(std::move(it->second));
-                } else {
-                    _cacheConfig._cacheManager = nullptr;
-                }
-
                 config.erase(it);
             }
+
+            if (!_cacheConfig._cacheDir.empty()) {
+                FileUtils::createDirectoryRecursive(_cacheConfig._cacheDir);
+                _cacheConfig._cacheManager =
+                    std::make_shared<ie::FileStorageCacheManager>(std::string(_cacheConfig._cacheDir),
+                                                                  _cacheConfig._cacheMaxSize);
+            } else {
+                _cacheConfig._cacheManager = nullptr;
+            }
         }
 
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
@@ -240,10 +260,11 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                 // need to export network for further import from "cache"
                 OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "Core::LoadNetwork::Export");
                 cacheManager->writeCacheEntry(blobID, [&](std::ostream& networkStream) {
-                    networkStream << ie::CompiledBlobHeader(
-                        ie::GetInferenceEngineVersion()->buildNumber,
-                        ie::NetworkCompilationContext::calculateFileInfo(modelPath));
-                    execNetwork->Export(networkStream);
+                    ie::CompiledBlobHeader header(ie::GetInferenceEngineVersion()->buildNumber,
+                                                  ie::NetworkCompilationContext::calculateFileInfo(modelPath));
+                    header.writeWithData(networkStream, [&](std::ostream& dataStream) {
+                        execNetwork->Export(dataStream);
+                    });
                 });
             } catch (...) {
                 cacheManager->removeCacheEntry(blobID);
@@ -270,8 +291,8 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                 OV_ITT_SCOPE(FIRST_INFERENCE,
                              ie::itt::domains::IE_LT,
                              "Core::LoadNetworkFromCache::ReadStreamAndImport");
+                ie::CompiledBlobHeader header;
                 try {
-                    ie::CompiledBlobHeader header;
                     networkStream >> header;
                     if (header.getIeVersion() != ie::GetInferenceEngineVersion()->buildNumber) {
                         // Build number mismatch, don't use this cache
@@ -285,8 +306,15 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                     throw HeaderException();
                 }
 
-                execNetwork = context ? plugin.import_model(networkStream, context, config)
-                                      : plugin.import_model(networkStream, config);
+                const bool dataIsValid = header.readWithData(networkStream, [&](std::istream& dataStream) {
+                    execNetwork = context ? plugin.import_model(dataStream, context, config)
+                                          : plugin.import_model(dataStream, config);
+                });
+                if (!dataIsValid) {
+                    // Blob is truncated or corrupted, the network imported from it is not used
+                    execNetwork = {};
+                    throw HeaderException();
+                }
                 networkIsImported = true;
             });
         } catch (const HeaderException&) {
@@ -592,6 +620,15 @@ public:
             }
         }
 
+        // BATCH case
+        {
+            if (deviceName.find("BATCH:") == 0) {
+                IE_THROW()
+                    << "You can get specific metrics with the GetMetric only for the BATCH itself (without devices). "
+                       "To get individual devices's metrics call GetMetric for each device separately";
+            }
+        }
+
         // AUTO case
         {
             if (deviceName.find("AUTO:") == 0) {
@@ -921,6 +958,13 @@ public:
                     deviceNames = ie::DeviceIDParser::getMultiDevices(deviceName.substr(pos + 1));
                 }
                 deviceNames.emplace_back("AUTO");
+            } else if (deviceName.find("BATCH") == 0) {
+                auto pos = deviceName.find_first_of(":");
+                if (pos != std::string::npos) {
+                    // the target device is followed by the batch size in brackets
+                    deviceNames.push_back(deviceName.substr(pos + 1, deviceName.find_first_of("(") - pos - 1));
+                }
+                deviceNames.emplace_back("BATCH");
             } else {
                 deviceNames.push_back(deviceName);
             }
@@ -1095,6 +1139,9 @@ RemoteContext::Ptr Core::CreateContext(const std::string& deviceName, const Para
     if (deviceName.find("AUTO") == 0) {
         IE_THROW() << "AUTO device does not support remote context";
     }
+    if (deviceName.find("BATCH") == 0) {
+        IE_THROW() << "BATCH device does not support remote context";
+    }
 
     auto parsed = ov::runtime::parseDeviceNameIntoConfig(deviceName, params);
     return _impl->GetCPPPluginByName(parsed._deviceName).create_context(parsed._config)._ptr;
@@ -1110,6 +1157,9 @@ RemoteContext::Ptr Core::GetDefaultContext(const std::string& deviceName) {
     if (deviceName.find("AUTO") == 0) {
         IE_THROW() << "AUTO device does not support remote context";
     }
+    if (deviceName.find("BATCH") == 0) {
+        IE_THROW() << "BATCH device does not support remote context";
+    }
 
     auto parsed = ov::runtime::parseDeviceNameIntoConfig(deviceName, ParamMap());
     return _impl->GetCPPPluginByName(parsed._deviceName).get_default_context(parsed._config)._ptr;
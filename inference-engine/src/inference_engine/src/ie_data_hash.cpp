@@ -0,0 +1,120 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_data_hash.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "ie_parallel.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+const uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+const uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+const uint64_t prime3 = 0x165667B19E3779F9ULL;
+const uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+const uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const unsigned char* p) {
+    uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint32_t read32(const unsigned char* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint64_t hashRound(uint64_t acc, uint64_t input) {
+    acc += input * prime2;
+    acc = rotl(acc, 31);
+    return acc * prime1;
+}
+
+inline uint64_t mergeRound(uint64_t acc, uint64_t value) {
+    acc ^= hashRound(0, value);
+    return acc * prime1 + prime4;
+}
+
+}  // namespace
+
+uint64_t hashBytes(const void* data, std::size_t size, uint64_t seed) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    const unsigned char* const end = p + size;
+    uint64_t h;
+
+    if (size >= 32) {
+        // lanes are independent, so compiler can keep them in flight simultaneously
+        uint64_t v1 = seed + prime1 + prime2;
+        uint64_t v2 = seed + prime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - prime1;
+        const unsigned char* const limit = end - 32;
+        do {
+            v1 = hashRound(v1, read64(p));
+            v2 = hashRound(v2, read64(p + 8));
+            v3 = hashRound(v3, read64(p + 16));
+            v4 = hashRound(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = mergeRound(h, v1);
+        h = mergeRound(h, v2);
+        h = mergeRound(h, v3);
+        h = mergeRound(h, v4);
+    } else {
+        h = seed + prime5;
+    }
+
+    h += static_cast<uint64_t>(size);
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= hashRound(0, read64(p));
+        h = rotl(h, 27) * prime1 + prime4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read32(p)) * prime1;
+        h = rotl(h, 23) * prime2 + prime3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h ^= (*p) * prime5;
+        h = rotl(h, 11) * prime1;
+    }
+
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+}
+
+uint64_t hashData(const void* data, std::size_t size) {
+    if (size <= dataHashChunkSize)
+        return hashBytes(data, size, 0);
+
+    const auto bytes = static_cast<const unsigned char*>(data);
+    const std::size_t chunksNum = (size + dataHashChunkSize - 1) / dataHashChunkSize;
+    std::vector<uint64_t> chunkHashes(chunksNum);
+    parallel_for(chunksNum, [&](std::size_t i) {
+        const std::size_t offset = i * dataHashChunkSize;
+        chunkHashes[i] = hashBytes(bytes + offset, std::min(dataHashChunkSize, size - offset), i);
+    });
+
+    return hashBytes(chunkHashes.data(), chunkHashes.size() * sizeof(uint64_t), size);
+}
+
+}  // namespace InferenceEngine
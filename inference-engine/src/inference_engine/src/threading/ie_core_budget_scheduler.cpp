@@ -0,0 +1,275 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "threading/ie_core_budget_scheduler.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "ie_common.h"
+#include "ie_system_conf.h"
+
+namespace InferenceEngine {
+
+struct CoreBudgetScheduler::Impl : public std::enable_shared_from_this<CoreBudgetScheduler::Impl> {
+    using Clock = std::chrono::steady_clock;
+
+    struct Network;
+
+    // Returns the cores of the task to the budget once the task is finished
+    struct TaskGuard {
+        TaskGuard(std::shared_ptr<Impl> impl, std::shared_ptr<Network> network, int fromReserved, int fromPool)
+            : _impl{std::move(impl)},
+              _network{std::move(network)},
+              _fromReserved{fromReserved},
+              _fromPool{fromPool} {}
+        ~TaskGuard() {
+            _impl->Release(*_network, _fromReserved, _fromPool);
+        }
+        std::shared_ptr<Impl> _impl;
+        std::shared_ptr<Network> _network;
+        int _fromReserved;
+        int _fromPool;
+    };
+
+    // The cores of a task run by the waiting thread itself are handed over to it, nullptr means out of the budget
+    using Grant = std::promise<std::shared_ptr<TaskGuard>>;
+
+    struct QueuedTask {
+        Task _task;
+        std::shared_ptr<Grant> _grant;
+        Clock::time_point _submitted;
+        size_t _order;
+    };
+
+    struct Network {
+        NetworkConfig _config;
+        // Reset on unregistration, so a finished task never holds the last reference to the executor
+        IStreamsExecutor::Ptr _executor;
+        int _reserved = 0;
+        int _reservedUsed = 0;
+        std::deque<QueuedTask> _queue;
+        Statistics _statistics;
+    };
+
+    using ReadyTasks = std::vector<std::pair<IStreamsExecutor::Ptr, Task>>;
+
+    struct Executor : public ScheduledExecutor {
+        Executor(std::shared_ptr<Impl> impl, std::shared_ptr<Network> network, IStreamsExecutor::Ptr executor)
+            : _impl{std::move(impl)},
+              _network{std::move(network)},
+              _executor{std::move(executor)} {}
+
+        ~Executor() override {
+            _impl->Unregister(_network);
+        }
+
+        void run(Task task) override {
+            _impl->Submit(_network, std::move(task));
+        }
+
+        void Execute(Task task) override {
+            auto guard = _impl->Acquire(_network);
+            _executor->Execute(std::move(task));
+        }
+
+        int GetStreamId() override {
+            return _executor->GetStreamId();
+        }
+
+        int GetNumaNodeId() override {
+            return _executor->GetNumaNodeId();
+        }
+
+        Statistics GetStatistics() const override {
+            return _impl->GetStatistics(*_network);
+        }
+
+        std::shared_ptr<Impl> _impl;
+        std::shared_ptr<Network> _network;
+        IStreamsExecutor::Ptr _executor;
+    };
+
+    explicit Impl(int cores) : _cores{cores > 0 ? cores : std::max(1, getNumberOfCPUCores())} {}
+
+    int PoolCores() const {
+        return _cores - _reservedTotal;
+    }
+
+    // A task never needs more cores than its network can get, so it is dispatched eventually
+    int TaskCores(const Network& network) const {
+        return std::max(1, std::min(network._config._coresPerTask, network._reserved + PoolCores()));
+    }
+
+    void Register(const std::shared_ptr<Network>& network) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        // at least one core is left in the pool, so the networks without a reservation make progress
+        network->_reserved = std::max(0, std::min(network->_config._minCores, _cores - 1 - _reservedTotal));
+        _reservedTotal += network->_reserved;
+        _networks.push_back(network);
+    }
+
+    void Unregister(const std::shared_ptr<Network>& network) {
+        ReadyTasks ready;
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _networks.erase(std::remove(_networks.begin(), _networks.end(), network), _networks.end());
+            _reservedTotal -= network->_reserved;
+            // tasks left in the queue are not lost, they are started out of the budget
+            for (auto& queued : network->_queue) {
+                if (queued._grant)
+                    queued._grant->set_value(nullptr);
+                else
+                    ready.emplace_back(network->_executor, std::move(queued._task));
+            }
+            network->_queue.clear();
+            network->_executor.reset();
+            Dispatch(ready);
+        }
+        Run(ready);
+    }
+
+    void Submit(const std::shared_ptr<Network>& network, Task task) {
+        ReadyTasks ready;
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            network->_queue.push_back({std::move(task), nullptr, Clock::now(), _nextOrder++});
+            Dispatch(ready);
+        }
+        Run(ready);
+    }
+
+    // Waits in the queue as a task submitted by `Submit()`, the cores are released when the guard is destroyed
+    std::shared_ptr<TaskGuard> Acquire(const std::shared_ptr<Network>& network) {
+        auto grant = std::make_shared<Grant>();
+        auto granted = grant->get_future();
+        ReadyTasks ready;
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            network->_queue.push_back({Task{}, grant, Clock::now(), _nextOrder++});
+            Dispatch(ready);
+        }
+        Run(ready);
+        return granted.get();
+    }
+
+    void Release(Network& network, int fromReserved, int fromPool) {
+        ReadyTasks ready;
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            network._reservedUsed -= fromReserved;
+            _poolUsed -= fromPool;
+            Dispatch(ready);
+        }
+        Run(ready);
+    }
+
+    // Must be called under the lock, the ready tasks are started after the lock is released
+    void Dispatch(ReadyTasks& ready) {
+        std::vector<bool> waiting(_networks.size(), false);
+        bool poolBlocked = false;
+        for (;;) {
+            // the next task is the earliest submitted one of the networks with the highest priority
+            int next = -1;
+            for (size_t i = 0; i < _networks.size(); i++) {
+                const auto& network = *_networks[i];
+                if (network._queue.empty() || waiting[i])
+                    continue;
+                if (next < 0)
+                    next = static_cast<int>(i);
+                const auto& nextNetwork = *_networks[next];
+                if (network._config._priority > nextNetwork._config._priority ||
+                    (network._config._priority == nextNetwork._config._priority &&
+                     network._queue.front()._order < nextNetwork._queue.front()._order))
+                    next = static_cast<int>(i);
+            }
+            if (next < 0)
+                break;
+
+            auto& network = _networks[next];
+            const int cores = TaskCores(*network);
+            const int fromReserved = std::min(cores, network->_reserved - network->_reservedUsed);
+            const int fromPool = cores - fromReserved;
+            // networks are visited in the priority order, so a network waiting for the pool keeps it
+            // from the networks of the same or lower priority, which still may use their reserved cores
+            if (fromPool > 0 && (poolBlocked || fromPool > PoolCores() - _poolUsed)) {
+                poolBlocked = true;
+                waiting[next] = true;
+                continue;
+            }
+
+            auto queued = std::move(network->_queue.front());
+            network->_queue.pop_front();
+            network->_reservedUsed += fromReserved;
+            _poolUsed += fromPool;
+
+            const auto delay = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - queued._submitted);
+            auto& statistics = network->_statistics;
+            statistics._dispatchedTasks++;
+            statistics._totalDelay += delay;
+            statistics._maxDelay = std::max(statistics._maxDelay, delay);
+
+            auto guard = std::make_shared<TaskGuard>(shared_from_this(), network, fromReserved, fromPool);
+            if (queued._grant) {
+                queued._grant->set_value(std::move(guard));
+                continue;
+            }
+            auto task = std::move(queued._task);
+            ready.emplace_back(network->_executor, [guard, task]() mutable {
+                task();
+                guard.reset();
+            });
+        }
+    }
+
+    void Run(ReadyTasks& ready) {
+        for (auto& executorAndTask : ready) {
+            executorAndTask.first->run(std::move(executorAndTask.second));
+        }
+        ready.clear();
+    }
+
+    Statistics GetStatistics(const Network& network) {
+        std::lock_guard<std::mutex> lock{_mutex};
+        auto statistics = network._statistics;
+        statistics._waitingTasks = network._queue.size();
+        return statistics;
+    }
+
+    const int _cores;
+    mutable std::mutex _mutex;
+    int _reservedTotal = 0;
+    int _poolUsed = 0;
+    size_t _nextOrder = 0;
+    std::vector<std::shared_ptr<Network>> _networks;
+};
+
+CoreBudgetScheduler::CoreBudgetScheduler(int cores) : _impl{std::make_shared<Impl>(cores)} {}
+
+CoreBudgetScheduler::ScheduledExecutor::Ptr CoreBudgetScheduler::registerNetwork(const NetworkConfig& config,
+                                                                                const IStreamsExecutor::Ptr& executor) {
+    if (!executor)
+        IE_THROW() << "CoreBudgetScheduler: network " << config._name << " is registered without an executor";
+    auto network = std::make_shared<Impl::Network>();
+    network->_config = config;
+    network->_executor = executor;
+    _impl->Register(network);
+    return std::make_shared<Impl::Executor>(_impl, network, executor);
+}
+
+int CoreBudgetScheduler::getCores() const {
+    return _impl->_cores;
+}
+
+size_t CoreBudgetScheduler::getNetworksNumber() const {
+    std::lock_guard<std::mutex> lock{_impl->_mutex};
+    return _impl->_networks.size();
+}
+
+}  // namespace InferenceEngine
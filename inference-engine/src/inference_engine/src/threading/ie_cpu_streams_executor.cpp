@@ -25,6 +25,81 @@
 using namespace openvino;
 
 namespace InferenceEngine {
+namespace {
+/**
+ * @brief Bounded multi-producer multi-consumer lock-free queue of tasks (D. Vyukov's ring buffer algorithm).
+ * Each cell has a sequence number telling producers and consumers whether the cell is free or filled
+ * for the current lap, so only one CAS on the head or tail index is needed per operation.
+ */
+class BoundedTaskQueue {
+    struct Cell {
+        std::atomic<std::size_t> _sequence;
+        Task _task;
+    };
+    // Padding keeps producer and consumer indices on different cache lines
+    static constexpr std::size_t cacheLineSize = 64;
+    struct Index {
+        std::atomic<std::size_t> _value{0};
+        char _padding[cacheLineSize - sizeof(std::atomic<std::size_t>)];
+    };
+
+    std::vector<Cell> _cells;
+    const std::size_t _mask;
+    char _padding[cacheLineSize];
+    Index _enqueuePos;
+    Index _dequeuePos;
+
+public:
+    explicit BoundedTaskQueue(std::size_t capacity) : _cells(capacity), _mask(capacity - 1) {
+        assert(capacity >= 2 && (capacity & (capacity - 1)) == 0);
+        for (std::size_t i = 0; i < capacity; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool TryPush(Task& task) {
+        auto pos = _enqueuePos._value.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = _cells[pos & _mask];
+            const auto seq = cell._sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos._value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell._task = std::move(task);
+                    cell._sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // queue is full
+            } else {
+                pos = _enqueuePos._value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool TryPop(Task& task) {
+        auto pos = _dequeuePos._value.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = _cells[pos & _mask];
+            const auto seq = cell._sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos._value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    task = std::move(cell._task);
+                    cell._task = nullptr;
+                    cell._sequence.store(pos + _mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // queue is empty
+            } else {
+                pos = _dequeuePos._value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+};
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -67,11 +142,7 @@ struct CPUStreamsExecutor::Impl {
                     _impl->_streamIdQueue.pop();
                 }
             }
-            _numaNodeId = _impl->_config._streams
-                              ? _impl->_usedNumaNodes.at((_streamId % _impl->_config._streams) /
-                                                         ((_impl->_config._streams + _impl->_usedNumaNodes.size() - 1) /
-                                                          _impl->_usedNumaNodes.size()))
-                              : _impl->_usedNumaNodes.at(_streamId % _impl->_usedNumaNodes.size());
+            _numaNodeId = _impl->GetNumaNodeId(_streamId);
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
             const auto concurrency = (0 == _impl->_config._threadsPerStream) ? custom::task_arena::automatic
                                                                              : _impl->_config._threadsPerStream;
@@ -215,6 +286,31 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        if (_config._workStealing && _config._streams > 0) {
+            for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+                _streamQueues.emplace_back(new BoundedTaskQueue{streamQueueCapacity});
+            }
+            // Tasks are stolen only from streams on the same NUMA node to keep the data local. The queue of a stream
+            // is the one of its id modulo the number of streams, which has the same NUMA node by GetNumaNodeId()
+            _stealOrder.resize(_config._streams);
+            for (auto queueId = 0; queueId < _config._streams; ++queueId) {
+                for (auto offset = 1; offset < _config._streams; ++offset) {
+                    const auto victimId = (queueId + offset) % _config._streams;
+                    if (GetNumaNodeId(victimId) == GetNumaNodeId(queueId)) {
+                        _stealOrder[queueId].push_back(victimId);
+                    }
+                }
+            }
+            for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+                _threads.emplace_back([this, streamId] {
+                    openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                    // The stream id and the NUMA binding are given to threads in the order they arrive,
+                    // so the stream is created before the thread picks its queue
+                    RunWorkStealing(*(_streams.local()));
+                });
+            }
+            return;
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
@@ -238,7 +334,18 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
+    int GetNumaNodeId(int streamId) const {
+        return _config._streams ? _usedNumaNodes.at((streamId % _config._streams) /
+                                                    ((_config._streams + _usedNumaNodes.size() - 1) /
+                                                     _usedNumaNodes.size()))
+                                : _usedNumaNodes.at(streamId % _usedNumaNodes.size());
+    }
+
     void Enqueue(Task task) {
+        if (!_streamQueues.empty()) {
+            EnqueueWorkStealing(std::move(task));
+            return;
+        }
         {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
@@ -246,6 +353,83 @@ struct CPUStreamsExecutor::Impl {
         _queueCondVar.notify_one();
     }
 
+    void EnqueueWorkStealing(Task task) {
+        const auto streams = static_cast<unsigned>(_streamQueues.size());
+        const auto first = _nextQueue.fetch_add(1, std::memory_order_relaxed);
+        bool pushed = false;
+        for (unsigned i = 0; i < streams && !pushed; ++i) {
+            pushed = _streamQueues[(first + i) % streams]->TryPush(task);
+        }
+        if (!pushed) {
+            // All stream queues are full, keep the task in the unbounded shared queue
+            std::lock_guard<std::mutex> lock(_mutex);
+            _taskQueue.emplace(std::move(task));
+        }
+        // Pairs with the fence in RunWorkStealing: either the sleeping thread sees the task or we see the sleeper
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_numSleeping.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _queueCondVar.notify_one();
+        }
+    }
+
+    int GetQueueId(const Stream& stream) const {
+        return stream._streamId % static_cast<int>(_streamQueues.size());
+    }
+
+    bool TryGetTask(int queueId, Task& task) {
+        if (_streamQueues[queueId]->TryPop(task)) {
+            return true;
+        }
+        for (auto victimId : _stealOrder[queueId]) {
+            if (_streamQueues[victimId]->TryPop(task)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool TryGetTaskFromAnyQueue(int queueId, Task& task) {
+        if (TryGetTask(queueId, task)) {
+            return true;
+        }
+        // Overflow queue and queues of other NUMA nodes are checked before going to sleep only,
+        // so that a task is never left unprocessed while some stream is idle
+        if (!_taskQueue.empty()) {
+            task = std::move(_taskQueue.front());
+            _taskQueue.pop();
+            return true;
+        }
+        for (std::size_t victimId = 0; victimId < _streamQueues.size(); ++victimId) {
+            if (_streamQueues[victimId]->TryPop(task)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void RunWorkStealing(Stream& stream) {
+        const auto queueId = GetQueueId(stream);
+        assert(GetNumaNodeId(queueId) == stream._numaNodeId);
+        for (;;) {
+            Task task;
+            if (!TryGetTask(queueId, task)) {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _numSleeping.fetch_add(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                bool stopped = false;
+                _queueCondVar.wait(lock, [&] {
+                    return TryGetTaskFromAnyQueue(queueId, task) || (stopped = _isStopped);
+                });
+                _numSleeping.fetch_sub(1, std::memory_order_relaxed);
+                if (stopped && !task) {
+                    return;
+                }
+            }
+            Execute(task, stream);
+        }
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         auto& arena = stream._taskArena;
@@ -284,6 +468,12 @@ struct CPUStreamsExecutor::Impl {
     std::condition_variable _queueCondVar;
     std::queue<Task> _taskQueue;
     bool _isStopped = false;
+    // Work stealing mode
+    static constexpr std::size_t streamQueueCapacity = 1024;
+    std::vector<std::unique_ptr<BoundedTaskQueue>> _streamQueues;
+    std::vector<std::vector<int>> _stealOrder;
+    std::atomic<unsigned> _nextQueue{0};
+    std::atomic<int> _numSleeping{0};
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
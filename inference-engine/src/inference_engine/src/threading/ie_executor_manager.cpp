@@ -35,7 +35,8 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
             executorConfig._threadsPerStream == config._threadsPerStream &&
             executorConfig._threadBindingType == config._threadBindingType &&
             executorConfig._threadBindingStep == config._threadBindingStep &&
-            executorConfig._threadBindingOffset == config._threadBindingOffset)
+            executorConfig._threadBindingOffset == config._threadBindingOffset &&
+            executorConfig._workStealing == config._workStealing)
             if (executorConfig._threadBindingType != IStreamsExecutor::ThreadBindingType::HYBRID_AWARE ||
                 executorConfig._threadPreferredCoreType == config._threadPreferredCoreType)
                 return executor;
@@ -45,6 +46,14 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
     return newExec;
 }
 
+CoreBudgetScheduler::Ptr ExecutorManagerImpl::getCoreBudgetScheduler() {
+    std::lock_guard<std::mutex> guard(streamExecutorMutex);
+    if (!coreBudgetScheduler) {
+        coreBudgetScheduler = std::make_shared<CoreBudgetScheduler>();
+    }
+    return coreBudgetScheduler;
+}
+
 // for tests purposes
 size_t ExecutorManagerImpl::getExecutorsNumber() {
     return executors.size();
@@ -134,4 +143,8 @@ IStreamsExecutor::Ptr ExecutorManager::getIdleCPUStreamsExecutor(const IStreamsE
     return _impl.getIdleCPUStreamsExecutor(config);
 }
 
+CoreBudgetScheduler::Ptr ExecutorManager::getCoreBudgetScheduler() {
+    return _impl.getCoreBudgetScheduler();
+}
+
 }  // namespace InferenceEngine
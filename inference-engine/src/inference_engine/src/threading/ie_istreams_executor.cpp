@@ -25,6 +25,7 @@ std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
         CONFIG_KEY(CPU_BIND_THREAD),
         CONFIG_KEY(CPU_THREADS_NUM),
         CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM),
+        CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING),
     };
 }
 int IStreamsExecutor::Config::GetDefaultNumStreams() {
@@ -106,6 +107,15 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                        << ". Expected only non negative numbers (#threads)";
         }
         _threadsPerStream = val_i;
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING)) {
+        if (value == CONFIG_VALUE(YES)) {
+            _workStealing = true;
+        } else if (value == CONFIG_VALUE(NO)) {
+            _workStealing = false;
+        } else {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING)
+                       << ". Expected only YES/NO";
+        }
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
@@ -133,6 +143,8 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) {
         return {std::to_string(_threads)};
     } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
         return {std::to_string(_threadsPerStream)};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAMS_WORK_STEALING)) {
+        return {_workStealing ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
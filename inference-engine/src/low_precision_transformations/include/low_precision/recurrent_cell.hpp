@@ -0,0 +1,32 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "layer_transformation.hpp"
+
+namespace ngraph {
+namespace pass {
+namespace low_precision {
+
+/**
+ * @brief Removes the per-tensor u8 dequantization from the data and the hidden state inputs of LSTM and GRU cells and
+ * sequences and keeps it as DataDequantization attribute, the plugin applies it in the recurrent primitive.
+ * The primitive requantizes the hidden state of each step with the input quantization, so both inputs are required
+ * to have the same dequantization.
+ * W and R are required to be quantized to signed values with the same per output channel scales, by FakeQuantize
+ * or by dequantization of i8 constants. The quantization is folded and its scales are kept in the attribute as well.
+ */
+class LP_TRANSFORMATIONS_API RecurrentCellTransformation : public LayerTransformation {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    RecurrentCellTransformation(const Params& params = Params());
+    bool transform(TransformationContext &context, ngraph::pattern::Matcher &m) override;
+    bool canBeTransformed(const TransformationContext& context, std::shared_ptr<Node> layer) const override;
+    bool isPrecisionPreserved(std::shared_ptr<Node> layer) const noexcept override;
+};
+
+}  // namespace low_precision
+}  // namespace pass
+}  // namespace ngraph
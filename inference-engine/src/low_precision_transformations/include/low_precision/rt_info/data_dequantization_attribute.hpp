@@ -0,0 +1,47 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/node.hpp>
+#include <ngraph/variant.hpp>
+#include "low_precision/lpt_visibility.hpp"
+
+namespace ngraph {
+
+/**
+ * @brief Per-tensor dequantization of the low precision data inputs which is applied by the operation itself:
+ * dequantized = scale * (input - shift)
+ * and the scales of the signed quantization of the weights per output channel: weights = weightsScales[channel] * quantized
+ */
+struct DataDequantization {
+    float scale = 1.f;
+    float shift = 0.f;
+    std::vector<float> weightsScales;
+};
+
+} // namespace ngraph
+
+namespace ov {
+
+class LP_TRANSFORMATIONS_API DataDequantizationAttribute : public VariantImpl<ngraph::DataDequantization> {
+public:
+    OPENVINO_RTTI("LowPrecision::DataDequantization", "0");
+
+    DataDequantizationAttribute() = default;
+
+    DataDequantizationAttribute(const value_type& value) : VariantImpl<value_type>(value) {}
+
+    std::string to_string() override;
+};
+
+LP_TRANSFORMATIONS_API bool has_data_dequantization(const std::shared_ptr<const ngraph::Node>& node);
+LP_TRANSFORMATIONS_API ngraph::DataDequantization get_data_dequantization(const std::shared_ptr<const ngraph::Node>& node);
+LP_TRANSFORMATIONS_API void set_data_dequantization(const std::shared_ptr<ngraph::Node>& node, const ngraph::DataDequantization& dequantization);
+
+}  // namespace ov
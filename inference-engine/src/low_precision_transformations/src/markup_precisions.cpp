@@ -10,6 +10,9 @@
 #include <vector>
 
 #include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset5.hpp>
 #include <ngraph/opsets/opset6.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <ngraph/pattern/op/or.hpp>
@@ -186,9 +189,13 @@ bool ngraph::pass::low_precision::MarkupPrecisions::isSupported(const std::share
         { name<opset1::ConvolutionBackpropData>() },
         { name<opset1::DepthToSpace>() },
         { name<opset1::FakeQuantize>() },
+        { name<opset3::GRUCell>() },
+        { name<opset5::GRUSequence>() },
         { name<opset1::Interpolate>() },
         { name<opset4::Interpolate>() },
         { name<opset1::GroupConvolution>() },
+        { name<opset4::LSTMCell>() },
+        { name<opset5::LSTMSequence>() },
         { name<opset1::MatMul>() },
         { name<opset1::MaxPool>() },
         { name<opset1::Multiply>() },
@@ -0,0 +1,226 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "low_precision/recurrent_cell.hpp"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+#include "low_precision/network_helper.hpp"
+#include "low_precision/rt_info/data_dequantization_attribute.hpp"
+
+using namespace ngraph;
+using namespace ngraph::pass;
+using namespace ngraph::pass::low_precision;
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::low_precision::RecurrentCellTransformation, "RecurrentCellTransformation", 0);
+
+namespace recurrent_cell {
+
+constexpr size_t dataIndex = 0ul;
+constexpr size_t hiddenStateIndex = 1ul;
+
+bool getDataDequantization(const FakeQuantizeDequantization& dequantization, DataDequantization& values) {
+    if (dequantization.empty() || (dequantization.convert == nullptr) || (dequantization.data.get_element_type() != element::u8)) {
+        return false;
+    }
+
+    values = DataDequantization();
+    if (dequantization.multiply != nullptr) {
+        if (!NetworkHelper::isScalarLike(dequantization.multiplyConstant) || dequantization.multiplyHasZeroOrDenormal()) {
+            return false;
+        }
+        values.scale = dequantization.multiplyConstant->cast_vector<float>()[0];
+    }
+    if (dequantization.subtract != nullptr) {
+        if (!NetworkHelper::isScalarLike(dequantization.subtractConstant)) {
+            return false;
+        }
+        values.shift = dequantization.subtractConstant->cast_vector<float>()[0];
+    }
+    return true;
+}
+
+// W, R and B are the last inputs of the cells and the sequences
+size_t getWeightsIndex(const std::shared_ptr<const Node>& cell) {
+    return cell->get_input_size() - 3ul;
+}
+
+size_t getRecurrenceWeightsIndex(const std::shared_ptr<const Node>& cell) {
+    return cell->get_input_size() - 2ul;
+}
+
+// Values of the constant, which is broadcasted to the weights along the output channels (gates and hidden units) only
+bool getPerChannelValues(const std::shared_ptr<opset1::Constant>& constant, const Shape& weightsShape, std::vector<float>& values) {
+    if (constant == nullptr) {
+        return false;
+    }
+
+    const auto& shape = constant->get_shape();
+    const size_t channels = weightsShape[weightsShape.size() - 2ul];
+    if (shape.size() > weightsShape.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < shape.size(); ++i) {
+        const bool channelsAxis = (i == shape.size() - 2ul);
+        if ((shape[i] != 1ul) && (!channelsAxis || (shape[i] != channels))) {
+            return false;
+        }
+    }
+
+    values = constant->cast_vector<float>();
+    if (values.size() == 1ul) {
+        values.resize(channels, values[0]);
+    }
+    return true;
+}
+
+// Dequantization scales per output channel of the symmetric signed quantization of the W or R constant
+bool getWeightsScales(const std::shared_ptr<const Node>& cell, const size_t index, std::vector<float>& scales) {
+    const auto weightsShape = cell->get_input_partial_shape(index);
+    if (weightsShape.is_dynamic() || (weightsShape.rank().get_length() < 2)) {
+        return false;
+    }
+
+    const auto fakeQuantize = ov::as_type_ptr<opset1::FakeQuantize>(cell->get_input_node_shared_ptr(index));
+    if (fakeQuantize != nullptr) {
+        const size_t levels = fakeQuantize->get_levels();
+        std::vector<float> outputLow;
+        std::vector<float> outputHigh;
+        if (((levels != 255ul) && (levels != 256ul)) ||
+            !ov::is_type<opset1::Constant>(fakeQuantize->get_input_node_ptr(0)) ||
+            !getPerChannelValues(ov::as_type_ptr<opset1::Constant>(fakeQuantize->get_input_node_shared_ptr(3)), weightsShape.to_shape(), outputLow) ||
+            !getPerChannelValues(ov::as_type_ptr<opset1::Constant>(fakeQuantize->get_input_node_shared_ptr(4)), weightsShape.to_shape(), outputHigh)) {
+            return false;
+        }
+
+        scales.resize(outputLow.size());
+        for (size_t i = 0; i < scales.size(); ++i) {
+            scales[i] = (outputHigh[i] - outputLow[i]) / static_cast<float>(levels - 1ul);
+            // the quantized values are signed without zero point: [-128, 127] or [-127, 127]
+            if ((scales[i] <= 0.f) || (std::fabs(outputLow[i] / scales[i] + static_cast<float>(levels / 2ul)) > 1.e-3f)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const auto dequantization = NetworkHelper::getDequantization(cell, index);
+    return
+        !dequantization.empty() &&
+        (dequantization.convert != nullptr) &&
+        (dequantization.subtract == nullptr) &&
+        (dequantization.multiply != nullptr) &&
+        ov::is_type<opset1::Constant>(dequantization.data.get_node()) &&
+        (dequantization.data.get_element_type() == element::i8) &&
+        getPerChannelValues(dequantization.multiplyConstant, weightsShape.to_shape(), scales);
+}
+
+// Folds the quantization of the W or R constant checked by getWeightsScales
+std::shared_ptr<Node> foldWeights(const std::shared_ptr<Node>& cell, const size_t index) {
+    const auto fakeQuantize = ov::as_type_ptr<opset1::FakeQuantize>(cell->get_input_node_shared_ptr(index));
+    if (fakeQuantize != nullptr) {
+        return fold<opset1::FakeQuantize>(
+            fakeQuantize->input_value(0),
+            fakeQuantize->input_value(1),
+            fakeQuantize->input_value(2),
+            fakeQuantize->input_value(3),
+            fakeQuantize->input_value(4),
+            fakeQuantize->get_levels());
+    }
+
+    const auto dequantization = NetworkHelper::getDequantization(cell, index);
+    return fold<opset1::Multiply>(
+        foldConvert(dequantization.data, dequantization.multiply->get_output_element_type(0)),
+        dequantization.multiplyConstant);
+}
+
+} // namespace recurrent_cell
+
+RecurrentCellTransformation::RecurrentCellTransformation(const Params& params) : LayerTransformation(params) {
+    auto matcher = std::make_shared<pattern::op::Or>(OutputVector{
+        pattern::wrap_type<opset4::LSTMCell>(),
+        pattern::wrap_type<opset5::LSTMSequence>(),
+        pattern::wrap_type<opset3::GRUCell>(),
+        pattern::wrap_type<opset5::GRUSequence>()
+    });
+
+    ngraph::graph_rewrite_callback callback = [this](pattern::Matcher& m) {
+        auto op = m.get_match_root();
+        if (transformation_callback(op)) {
+            return false;
+        }
+        return transform(*context, m);
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matcher, "RecurrentCellTransformation");
+    this->register_matcher(m, callback);
+}
+
+bool RecurrentCellTransformation::canBeTransformed(const TransformationContext& context, std::shared_ptr<Node> operation) const {
+    if (!LayerTransformation::canBeTransformed(context, operation)) {
+        return false;
+    }
+
+    DataDequantization data;
+    DataDequantization hiddenState;
+    if (!recurrent_cell::getDataDequantization(NetworkHelper::getDequantization(operation, recurrent_cell::dataIndex), data) ||
+        !recurrent_cell::getDataDequantization(NetworkHelper::getDequantization(operation, recurrent_cell::hiddenStateIndex), hiddenState)) {
+        return false;
+    }
+
+    if ((data.scale != hiddenState.scale) || (data.shift != hiddenState.shift)) {
+        return false;
+    }
+
+    // the primitive quantizes W and R with the same scales, without them the weights stay in fp32
+    std::vector<float> weightsScales;
+    std::vector<float> recurrenceWeightsScales;
+    return
+        recurrent_cell::getWeightsScales(operation, recurrent_cell::getWeightsIndex(operation), weightsScales) &&
+        recurrent_cell::getWeightsScales(operation, recurrent_cell::getRecurrenceWeightsIndex(operation), recurrenceWeightsScales) &&
+        (weightsScales == recurrenceWeightsScales);
+}
+
+bool RecurrentCellTransformation::transform(TransformationContext& context, ngraph::pattern::Matcher& m) {
+    std::shared_ptr<Node> cell = m.get_match_root();
+    if (!canBeTransformed(context, cell)) {
+        return false;
+    }
+
+    const auto dataDequantization = NetworkHelper::getDequantization(cell, recurrent_cell::dataIndex);
+    const auto hiddenStateDequantization = NetworkHelper::getDequantization(cell, recurrent_cell::hiddenStateIndex);
+    DataDequantization values;
+    recurrent_cell::getDataDequantization(dataDequantization, values);
+
+    const size_t weightsIndex = recurrent_cell::getWeightsIndex(cell);
+    const size_t recurrenceWeightsIndex = recurrent_cell::getRecurrenceWeightsIndex(cell);
+    recurrent_cell::getWeightsScales(cell, weightsIndex, values.weightsScales);
+    const auto weights = recurrent_cell::foldWeights(cell, weightsIndex);
+    const auto recurrenceWeights = recurrent_cell::foldWeights(cell, recurrenceWeightsIndex);
+
+    OutputVector inputs = cell->input_values();
+    inputs[recurrent_cell::dataIndex] = dataDequantization.data;
+    inputs[recurrent_cell::hiddenStateIndex] = hiddenStateDequantization.data;
+    inputs[weightsIndex] = weights;
+    inputs[recurrenceWeightsIndex] = recurrenceWeights;
+
+    const auto newCell = cell->copy_with_new_inputs(inputs);
+    NetworkHelper::copyInfo(cell, newCell);
+    ov::set_data_dequantization(newCell, values);
+
+    replace_node(cell, newCell);
+    return true;
+}
+
+bool RecurrentCellTransformation::isPrecisionPreserved(std::shared_ptr<Node> layer) const noexcept {
+    return false;
+}
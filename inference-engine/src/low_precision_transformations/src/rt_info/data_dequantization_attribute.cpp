@@ -0,0 +1,38 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "low_precision/rt_info/data_dequantization_attribute.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+using namespace ngraph;
+using namespace ov;
+
+std::string DataDequantizationAttribute::to_string() {
+    std::stringstream ss;
+    ss << "scale: " << m_value.scale << ", shift: " << m_value.shift << ", weights scales: {";
+    for (size_t i = 0; i < m_value.weightsScales.size(); ++i) {
+        ss << (i == 0ul ? "" : ", ") << m_value.weightsScales[i];
+    }
+    ss << "}";
+    return ss.str();
+}
+
+bool ov::has_data_dequantization(const std::shared_ptr<const ngraph::Node>& node) {
+    const auto& rt_map = node->get_rt_info();
+    return rt_map.count(DataDequantizationAttribute::get_type_info_static());
+}
+
+ngraph::DataDequantization ov::get_data_dequantization(const std::shared_ptr<const ngraph::Node>& node) {
+    const auto& rt_map = node->get_rt_info();
+    const auto& var = rt_map.at(DataDequantizationAttribute::get_type_info_static());
+    return ngraph::as_type_ptr<DataDequantizationAttribute>(var)->get();
+}
+
+void ov::set_data_dequantization(const std::shared_ptr<ngraph::Node>& node, const ngraph::DataDequantization& dequantization) {
+    auto& rt_map = node->get_rt_info();
+    rt_map[DataDequantizationAttribute::get_type_info_static()] = std::make_shared<DataDequantizationAttribute>(dequantization);
+}
@@ -100,6 +100,50 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 lpTransformsMode = LPTransformsMode::On;
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
+        } else if (key == PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLELISM) {
+            if (val == PluginConfigParams::YES) interOpParallelism = true;
+            else if (val == PluginConfigParams::NO) interOpParallelism = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLELISM
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY
+                                   << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_CAPACITY
+                                   << ". Expected only non-negative integer numbers";
+            rtCacheCapacity = static_cast<size_t>(val_i);
+        } else if (key == PluginConfigInternalParams::KEY_CPU_SNIPPETS_MODE) {
+            if (val == PluginConfigParams::YES) enableSnippets = true;
+            else if (val == PluginConfigParams::NO) enableSnippets = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SNIPPETS_MODE
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION) {
+            if (val == PluginConfigParams::YES) globalLayoutSelection = true;
+            else if (val == PluginConfigParams::NO) globalLayoutSelection = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_NETWORK_PRIORITY ||
+                   key == PluginConfigInternalParams::KEY_CPU_NETWORK_MIN_CORES) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << key << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << key << ". Expected only non-negative integer numbers";
+            if (key == PluginConfigInternalParams::KEY_CPU_NETWORK_PRIORITY)
+                networkPriority = val_i;
+            else
+                networkMinCores = val_i;
         } else if (key == PluginConfigParams::KEY_ENFORCE_BF16) {
             if (val == PluginConfigParams::YES) {
                 if (with_cpu_x86_avx512_core()) {
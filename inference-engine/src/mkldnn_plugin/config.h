@@ -24,6 +24,13 @@ struct Config {
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool interOpParallelism = false;
+    bool enableSnippets = false;
+    bool globalLayoutSelection = false;
+    // priority in the core budget scheduler, negative if the network is not scheduled
+    int networkPriority = -1;
+    int networkMinCores = 0;
+    size_t rtCacheCapacity = 5000ul;
     std::string dumpToDot = "";
     int batchLimit = 0;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
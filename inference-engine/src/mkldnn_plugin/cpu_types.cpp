@@ -179,6 +179,8 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "NonMaxSuppressionIEInternal", NonMaxSuppression},
         { "MatrixNms", MatrixNms},
         { "MulticlassNms", MulticlassNms},
+        { "Subgraph", Subgraph},
+        { "MultiHeadAttention", MultiHeadAttention},
         { "Reference", Reference},
 };
 
@@ -355,6 +357,10 @@ std::string NameFromType(const Type type) {
             return "MatrixNms";
         case MulticlassNms:
             return "MulticlassNms";
+        case Subgraph:
+            return "Subgraph";
+        case MultiHeadAttention:
+            return "MultiHeadAttention";
         case Reference:
             return "Reference";
         default:
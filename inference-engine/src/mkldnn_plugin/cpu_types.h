@@ -97,7 +97,9 @@ enum Type {
     ExtractImagePatches,
     NonMaxSuppression,
     MatrixNms,
-    MulticlassNms
+    MulticlassNms,
+    Subgraph,
+    MultiHeadAttention
 };
 
 enum Algorithm {
@@ -0,0 +1,50 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/jit_generator.hpp>
+#include "snippets/generator.hpp"
+
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+class jit_snippet : public mkldnn::impl::cpu::x64::jit_generator {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_snippet)
+
+    ~jit_snippet() = default;
+
+    jit_snippet() : jit_generator() {
+    }
+
+    // the code is emitted by the snippets generator directly, so there is nothing to generate on kernel creation
+    void generate() override {
+    }
+};
+
+/**
+ * @brief Target machine which lowers snippets operations to the CPU plugin JIT emitters
+ */
+class CPUTargetMachine : public ngraph::snippets::TargetMachine {
+public:
+    explicit CPUTargetMachine(mkldnn::impl::cpu::x64::cpu_isa_t host_isa);
+
+    bool is_supported() const override;
+    ngraph::snippets::code get_snippet() const override;
+    size_t get_lanes() const override;
+
+private:
+    std::unique_ptr<jit_snippet> h;
+    mkldnn::impl::cpu::x64::cpu_isa_t isa;
+};
+
+class CPUGenerator : public ngraph::snippets::Generator {
+public:
+    explicit CPUGenerator(mkldnn::impl::cpu::x64::cpu_isa_t isa);
+    ~CPUGenerator() = default;
+};
+
+} // namespace MKLDNNPlugin
@@ -0,0 +1,283 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_snippets_emitters.hpp"
+#include "snippets/op/scalar.hpp"
+
+#include <cpu/x64/jit_generator.hpp>
+
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// data pointers are kept in r8..r14 as assigned by the snippets generator, loop counter is kept in r15
+const Reg64 reg_work_amount = Reg64(Operand::R15);
+
+#define GET_OFF(field) offsetof(jit_snippets_call_args, field)
+
+}   // namespace
+
+/// KERNEL ///
+KernelEmitter::KernelEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    const auto kernel = ngraph::as_type_ptr<ngraph::snippets::op::Kernel>(n);
+    if (!kernel)
+        IE_THROW() << "KernelEmitter expects Kernel operation, got " << n->get_type_name();
+    code = kernel->region;
+}
+
+void KernelEmitter::emit_code(const std::vector<size_t> &in, const std::vector<size_t> &out,
+                              const std::vector<size_t> &pool, const std::vector<size_t> &gpr) const {
+    if (in.size() != 2)
+        IE_THROW() << "KernelEmitter expects numbers of inputs and outputs";
+    if (in[0] + in[1] > SNIPPETS_MAX_SNIPPETS_PTRS)
+        IE_THROW() << "KernelEmitter supports only up to " << SNIPPETS_MAX_SNIPPETS_PTRS << " inputs and outputs in total";
+
+    emit_impl(in, out, pool, gpr, nullptr);
+}
+
+void KernelEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                              const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                              const MKLDNNPlugin::emitter_context *emit_context) const {
+    const size_t num_ptrs = in[0] + in[1];
+
+    h->preamble();
+
+    const Reg64 reg_params = abi_param1;
+    for (size_t i = 0; i < num_ptrs; i++)
+        h->mov(Reg64(Operand::R8 + i), h->ptr[reg_params + GET_OFF(ptrs) + i * sizeof(void*)]);
+    h->mov(reg_work_amount, h->ptr[reg_params + GET_OFF(work_amount)]);
+
+    for (const auto& c : code)
+        c.first->emit_code(c.second.first, c.second.second, pool, gpr);
+
+    h->postamble();
+}
+
+/// TILE ///
+TileEmitter::TileEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    const auto tile = ngraph::as_type_ptr<ngraph::snippets::op::Tile>(n);
+    if (!tile)
+        IE_THROW() << "TileEmitter expects Tile operation, got " << n->get_type_name();
+    code = tile->region;
+}
+
+void TileEmitter::emit_code(const std::vector<size_t> &in, const std::vector<size_t> &out,
+                            const std::vector<size_t> &pool, const std::vector<size_t> &gpr) const {
+    if (in.size() != 2)
+        IE_THROW() << "TileEmitter expects increment and number of data pointers";
+
+    emit_impl(in, out, pool, gpr, nullptr);
+}
+
+void TileEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                            const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                            const MKLDNNPlugin::emitter_context *emit_context) const {
+    const size_t inc = in[0];
+
+    Label for_body;
+    Label for_end;
+
+    h->L(for_body);
+    {
+        h->cmp(reg_work_amount, inc);
+        h->jl(for_end, jit_generator::T_NEAR);
+
+        for (const auto& c : code)
+            c.first->emit_code(c.second.first, c.second.second, pool, gpr);
+
+        h->sub(reg_work_amount, inc);
+        h->jmp(for_body, jit_generator::T_NEAR);
+    }
+    h->L(for_end);
+}
+
+/// FAKE BROADCAST ///
+FakeBroadcastEmitter::FakeBroadcastEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    if (n->get_input_shape(0).empty() || n->get_input_shape(0).back() != 1)
+        IE_THROW() << "FakeBroadcastEmitter supports only broadcasting along the innermost dimension";
+}
+
+void FakeBroadcastEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                     const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                     const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        IE_THROW() << host_isa_ << " is not supported by FakeBroadcastEmitter";
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void FakeBroadcastEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_dst = Vmm(out[0]);
+
+    h->uni_vbroadcastss(vmm_dst, Xmm(in[0]));
+}
+
+/// SCALAR ///
+ScalarEmitter::ScalarEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    const auto scalar = ngraph::as_type_ptr<ngraph::snippets::op::Scalar>(n);
+    if (!scalar)
+        IE_THROW() << "ScalarEmitter expects Scalar operation, got " << n->get_type_name();
+    const float fvalue = scalar->cast_vector<float>()[0];
+    value = bit_cast<int32_t>(fvalue);
+
+    prepare_table();
+}
+
+void ScalarEmitter::register_table_entries() {
+    push_arg_entry_of("scalar", value, true);
+}
+
+void ScalarEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                              const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                              const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        IE_THROW() << host_isa_ << " is not supported by ScalarEmitter";
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void ScalarEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_dst = Vmm(out[0]);
+
+    h->uni_vmovups(vmm_dst, table_val("scalar"));
+}
+
+/// MEMORY ///
+MemoryEmitter::MemoryEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {
+    const auto& rt = n->get_rt_info();
+    const auto it = rt.find("effectiveAddress");
+    if (it == rt.end())
+        IE_THROW() << "Memory access operation " << n->get_friendly_name() << " has no register assigned";
+    ea = ngraph::as_type_ptr<ngraph::VariantWrapper<int64_t>>(it->second)->get();
+
+    // tensor which is broadcasted along the innermost dimension keeps the same pointer for all the iterations
+    const auto& shape = n->get_input_shape(0);
+    shouldPostIncrement = !shape.empty() && shape.back() != 1;
+}
+
+/// STORE ///
+void StoreEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                             const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                             const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        IE_THROW() << host_isa_ << " is not supported by StoreEmitter";
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void StoreEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 out_reg(static_cast<int>(ea));
+    Vmm vmm_src = Vmm(in[0]);
+
+    h->uni_vmovups(h->ptr[out_reg], vmm_src);
+    if (shouldPostIncrement)
+        h->add(out_reg, cpu_isa_traits<isa>::vlen);
+}
+
+void ScalarStoreEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                   const MKLDNNPlugin::emitter_context *emit_context) const {
+    Reg64 out_reg(static_cast<int>(ea));
+
+    h->uni_vmovss(h->ptr[out_reg], Xmm(in[0]));
+    if (shouldPostIncrement)
+        h->add(out_reg, sizeof(float));
+}
+
+/// LOAD ///
+void LoadEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                            const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                            const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        IE_THROW() << host_isa_ << " is not supported by LoadEmitter";
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void LoadEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 in_reg(static_cast<int>(ea));
+    Vmm vmm_dst = Vmm(out[0]);
+
+    if (shouldPostIncrement) {
+        h->uni_vmovups(vmm_dst, h->ptr[in_reg]);
+        h->add(in_reg, cpu_isa_traits<isa>::vlen);
+    } else {
+        // the only element is loaded to all the lanes, so the following broadcast doesn't read out of bounds
+        h->uni_vbroadcastss(vmm_dst, h->ptr[in_reg]);
+    }
+}
+
+void BroadcastLoadEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                     const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                     const MKLDNNPlugin::emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        IE_THROW() << host_isa_ << " is not supported by BroadcastLoadEmitter";
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void BroadcastLoadEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 in_reg(static_cast<int>(ea));
+    Vmm vmm_dst = Vmm(out[0]);
+
+    h->uni_vbroadcastss(vmm_dst, h->ptr[in_reg]);
+}
+
+void ScalarLoadEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                  const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                  const MKLDNNPlugin::emitter_context *emit_context) const {
+    Reg64 in_reg(static_cast<int>(ea));
+
+    h->uni_vmovss(Xmm(out[0]), h->ptr[in_reg]);
+    if (shouldPostIncrement)
+        h->add(in_reg, sizeof(float));
+}
+
+} // namespace MKLDNNPlugin
@@ -0,0 +1,215 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "jit_emitter.hpp"
+#include "snippets/op/tile.hpp"
+#include "snippets/op/kernel.hpp"
+
+#include <vector>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+#define SNIPPETS_MAX_SNIPPETS_PTRS 7
+
+/**
+ * @brief Arguments of the kernel generated for a snippet: pointers to the inputs followed by pointers to the outputs
+ * and number of elements along the innermost dimension which the kernel processes in one call
+ */
+struct jit_snippets_call_args {
+    const void* ptrs[SNIPPETS_MAX_SNIPPETS_PTRS] = {};
+    size_t work_amount = 0;
+};
+
+/**
+ * @brief Emits prologue of the snippet kernel: loads data pointers to the registers assigned by the generator and
+ * the work amount to the loop counter, then emits all the tiles
+ */
+class KernelEmitter : public jit_emitter {
+public:
+    KernelEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+    void emit_code(const std::vector<size_t> &in, const std::vector<size_t> &out,
+                   const std::vector<size_t> &pool = {}, const std::vector<size_t> &gpr = {}) const override;
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>> code;
+};
+
+/**
+ * @brief Emits loop over the work amount with a step defined by in[0]. The vector tile processes the main part
+ * and the scalar tile which follows it processes the tail
+ */
+class TileEmitter : public jit_emitter {
+public:
+    TileEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+    void emit_code(const std::vector<size_t> &in, const std::vector<size_t> &out,
+                   const std::vector<size_t> &pool = {}, const std::vector<size_t> &gpr = {}) const override;
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>> code;
+};
+
+class NopEmitter : public jit_emitter {
+public:
+    NopEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+        : jit_emitter(h, isa, n) {}
+
+    size_t get_inputs_num() const override { return 0; }
+
+    void emit_data() const override {}
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override {}
+};
+
+/**
+ * @brief Broadcasts the lowest element of the input vector register to all the lanes
+ */
+class FakeBroadcastEmitter : public jit_emitter {
+public:
+    FakeBroadcastEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 1; }
+
+    void emit_data() const override {}
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+};
+
+/**
+ * @brief Broadcasts scalar constant to all the lanes of the output vector register
+ */
+class ScalarEmitter : public jit_emitter {
+public:
+    ScalarEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+
+    void register_table_entries() override;
+
+    int32_t value;
+};
+
+/**
+ * @brief Base class for the emitters which access memory through the pointer register assigned by the generator.
+ * The pointer is advanced after each access unless the tensor is broadcasted along the innermost dimension
+ */
+class MemoryEmitter : public jit_emitter {
+public:
+    MemoryEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    void emit_data() const override {}
+
+protected:
+    int64_t ea;
+    bool shouldPostIncrement;
+};
+
+class StoreEmitter : public MemoryEmitter {
+public:
+    StoreEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+        : MemoryEmitter(h, isa, n) {}
+
+    size_t get_inputs_num() const override { return 1; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+};
+
+class ScalarStoreEmitter : public MemoryEmitter {
+public:
+    ScalarStoreEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+        : MemoryEmitter(h, isa, n) {}
+
+    size_t get_inputs_num() const override { return 1; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+};
+
+class LoadEmitter : public MemoryEmitter {
+public:
+    LoadEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+        : MemoryEmitter(h, isa, n) {}
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+};
+
+class BroadcastLoadEmitter : public MemoryEmitter {
+public:
+    BroadcastLoadEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+        : MemoryEmitter(h, isa, n) {}
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+};
+
+class ScalarLoadEmitter : public MemoryEmitter {
+public:
+    ScalarLoadEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+        : MemoryEmitter(h, isa, n) {}
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+};
+
+} // namespace MKLDNNPlugin
@@ -18,6 +18,7 @@
 #include <threading/ie_tbb_streams_executor.hpp>
 #endif
 #include <threading/ie_cpu_streams_executor.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <ie_system_conf.h>
 #include <algorithm>
 #include <unordered_set>
@@ -60,6 +61,10 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     }
     bool isFloatModel = !ngraph::op::util::has_op_with_type<ngraph::op::FakeQuantize>(function);
 
+    if (_cfg.rtCacheCapacity > 0) {
+        _rtParamsCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity);
+    }
+
     if (_cfg.batchLimit > 1) {
         // check topology for applicability
         if (!CanProcessDynBatch(_network)) {
@@ -67,12 +72,15 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
     }
 
+    // number of cores an inference request occupies
+    int coresPerRequest = getNumberOfCPUCores();
     if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
     } else {
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig, isFloatModel);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
+        coresPerRequest = streamsExecutorConfig._threadsPerStream;
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         _taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
 #else
@@ -94,6 +102,8 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
+    // Every stream builds its own graph: nodes can't be cloned and the optimizer rewrites them in place, so a compiled
+    // graph can't be instantiated per stream. Only the constant data are shared, through the weights cache
     if (_cfg.streamExecutorConfig._streams != 0) {
         for (auto&& task : tasks) {
             task = [this] {
@@ -124,6 +134,18 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
             }
         }
     }
+
+    // The graphs are compiled out of the budget, the inference requests are scheduled with the other networks
+    auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(_taskExecutor);
+    if (_cfg.networkPriority >= 0 && streamsExecutor) {
+        CoreBudgetScheduler::NetworkConfig schedulerConfig;
+        schedulerConfig._name = _name;
+        schedulerConfig._priority = _cfg.networkPriority;
+        schedulerConfig._minCores = _cfg.networkMinCores;
+        schedulerConfig._coresPerTask = coresPerRequest;
+        _scheduledExecutor = ExecutorManager::getInstance()->getCoreBudgetScheduler()->registerNetwork(schedulerConfig, streamsExecutor);
+        _taskExecutor = _scheduledExecutor;
+    }
 }
 
 MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
@@ -143,6 +165,7 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
+                graphLock._graph.setRuntimeCache(_rtParamsCache);
                 graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
             } catch(...) {
                 exception = std::current_exception();
@@ -207,6 +230,10 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        if (_scheduledExecutor)
+            metrics.push_back(METRIC_KEY(CPU_QUEUEING_DELAY));
+        if (GetGraph()._graph.getProperty().globalLayoutSelection)
+            metrics.push_back(METRIC_KEY(CPU_LAYOUT_SELECTION_REORDERS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -221,6 +248,16 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(CPU_QUEUEING_DELAY) && _scheduledExecutor) {
+        const auto statistics = _scheduledExecutor->GetStatistics();
+        const auto tasks = static_cast<unsigned int>(statistics._dispatchedTasks);
+        const float totalMs = statistics._totalDelay.count() / 1000.f;
+        const float maxMs = statistics._maxDelay.count() / 1000.f;
+        IE_SET_METRIC_RETURN(CPU_QUEUEING_DELAY, std::make_tuple(tasks, tasks ? totalMs / tasks : 0.f, maxMs));
+    } else if (name == METRIC_KEY(CPU_LAYOUT_SELECTION_REORDERS) && GetGraph()._graph.getProperty().globalLayoutSelection) {
+        const auto reorders = GetGraph()._graph.GetLayoutSelectionReorders();
+        IE_SET_METRIC_RETURN(CPU_LAYOUT_SELECTION_REORDERS, std::make_tuple(static_cast<unsigned int>(reorders.first),
+                                                                            static_cast<unsigned int>(reorders.second)));
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
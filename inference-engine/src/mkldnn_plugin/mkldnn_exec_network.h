@@ -9,7 +9,9 @@
 
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
+#include "utils/lru_cache.h"
 #include <threading/ie_thread_local.hpp>
+#include <threading/ie_core_budget_scheduler.hpp>
 
 #include <vector>
 #include <memory>
@@ -65,6 +67,10 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<Graph>                   _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    // Executors prepared by dynamic shape nodes, shared by graphs of all streams
+    MultiCache::Ptr                             _rtParamsCache;
+    // Not null if the network is registered in the core budget scheduler, the same as _taskExecutor then
+    InferenceEngine::CoreBudgetScheduler::ScheduledExecutor::Ptr _scheduledExecutor;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -11,6 +11,7 @@
 #include <ngraph/ngraph.hpp>
 #include <ngraph_ops/type_relaxed.hpp>
 #include <ngraph_ops/nms_ie_internal.hpp>
+#include <ngraph_ops/multi_head_attention.hpp>
 #include <ngraph_ops/nms_static_shape_ie.hpp>
 
 #include <mutex>
@@ -102,6 +103,7 @@ std::map<std::string, ngraph::OpSet> MKLDNNExtension::getOpSets() {
 
 #define NGRAPH_OP(NAME, NAMESPACE) opset.insert<NAMESPACE::NAME>();
         NGRAPH_OP(NonMaxSuppressionIEInternal, ngraph::op::internal)
+        NGRAPH_OP(MultiHeadAttention, ngraph::op::internal)
         NGRAPH_OP(NmsStaticShapeIE<ov::op::v8::MulticlassNms>, ngraph::op::internal)
         NGRAPH_OP(NmsStaticShapeIE<ov::op::v8::MatrixNms>, ngraph::op::internal)
 #undef NGRAPH_OP
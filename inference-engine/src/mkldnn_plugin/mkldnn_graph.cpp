@@ -17,6 +17,7 @@
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
 #include "mkldnn_graph_optimizer.h"
+#include "mkldnn_layout_optimizer.h"
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
 #include "memory_solver.hpp"
@@ -27,6 +28,7 @@
 #include <nodes/mkldnn_convert_node.h>
 
 #include <ie_algorithm.hpp>
+#include <ie_parallel.hpp>
 #include <blob_factory.hpp>
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -326,6 +328,10 @@ void MKLDNNGraph::InitGraph() {
     InitDescriptors();
     RemoveDroppedEdges();
 
+    layoutSelectionReorders = {0, 0};
+    if (config.globalLayoutSelection && !graphHasDynamicInput)
+        layoutSelectionReorders = MKLDNNLayoutOptimizer().SelectLayouts(*this);
+
     InitOptimalPrimitiveDescriptors();
 
     InitEdges();
@@ -333,6 +339,10 @@ void MKLDNNGraph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    execLevels.clear();
+    if (config.interOpParallelism && CanExecuteInParallel())
+        InitExecLevels();
+
     Allocate();
 
     CreatePrimitives();
@@ -350,6 +360,7 @@ void MKLDNNGraph::InitGraph() {
 void MKLDNNGraph::InitNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::InitNodes");
     for (auto &node : graphNodes) {
+        node->setRuntimeCache(rtParamsCache);
         node->init();
     }
 }
@@ -387,8 +398,35 @@ void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
     }
 }
 
+bool MKLDNNGraph::CanExecuteInParallel() const {
+    if (graphHasDynamicInput)
+        return false;
+    for (const auto& node : graphNodes) {
+        // Memory nodes pass the state to each other out of graph edges, so their execution order matters
+        if (one_of(node->getType(), MemoryInput, MemoryOutput) || node->isDynamicNode())
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNGraph::InitExecLevels() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::InitExecLevels");
+    // graphNodes are sorted topologically, so all the parents already have the level assigned
+    execLevels.assign(graphNodes.size(), 0);
+    for (const auto& node : graphNodes) {
+        int level = 0;
+        for (const auto& parentEdge : node->getParentEdges()) {
+            auto edge = parentEdge.lock();
+            if (edge)
+                level = std::max(level, execLevels[edge->getParent()->execIndex] + 1);
+        }
+        execLevels[node->execIndex] = level;
+    }
+}
+
 void MKLDNNGraph::ExtractConstantAndExecutableNodes() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ExtractConstantAndExecutableNodes");
+    executableGraphLevels.clear();
     for (const auto& graphNode : graphNodes) {
         if (graphNode->isConstant())
             constantGraphNodes.emplace_back(graphNode);
@@ -400,6 +438,18 @@ void MKLDNNGraph::ExtractConstantAndExecutableNodes() {
              */
             executableGraphNodes.emplace_back(graphNode);
     }
+
+    if (!execLevels.empty()) {
+        for (const auto& node : executableGraphNodes) {
+            const auto level = static_cast<size_t>(execLevels[node->execIndex]);
+            if (executableGraphLevels.size() <= level)
+                executableGraphLevels.resize(level + 1);
+            executableGraphLevels[level].push_back(node);
+        }
+        executableGraphLevels.erase(std::remove_if(executableGraphLevels.begin(), executableGraphLevels.end(),
+                                                   [](const std::vector<MKLDNNNodePtr>& level) { return level.empty(); }),
+                                    executableGraphLevels.end());
+    }
 }
 
 void MKLDNNGraph::ExecuteConstantNodesOnly() const {
@@ -605,13 +655,19 @@ void MKLDNNGraph::AllocateWithReuse() {
 
     const int64_t alignment = 32;  // 32 bytes
 
+    // In inter-op parallel mode all nodes of one level are executed at the same time,
+    // so the level is used as a timestamp to keep their tensors from sharing memory
+    auto execTimestamp = [this](const MKLDNNNodePtr& node) {
+        return execLevels.empty() ? node->execIndex : execLevels[node->execIndex];
+    };
+
     std::vector<MemorySolver::Box> boxes(edge_clusters.size());
     for (int i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = execTimestamp(edge->getParent());
+            int e_finish = execTimestamp(edge->getChild());
 
             if (!edge->hasDefinedMaxSize()) {
                 IE_THROW() << "Can not allocate memory since the size is undefined.";
@@ -679,6 +735,67 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
 }
 
+void MKLDNNGraph::AllocateDynamicMemoryBlocks(const std::vector<MKLDNNEdgePtr>& dynamicEdges) {
+    dynamicMemoryBlocks.clear();
+    if (dynamicEdges.empty())
+        return;
+
+    auto execTimestamp = [this](const MKLDNNNodePtr& node) {
+        return execLevels.empty() ? node->execIndex : execLevels[node->execIndex];
+    };
+
+    // All edges of one output port share the memory of one of them (see MKLDNNNode::redefineOutputMemory),
+    // so the port is alive until the last of its consumers is executed
+    std::map<std::pair<MKLDNNNode*, int>, size_t> portIndices;
+    std::vector<std::vector<MKLDNNEdgePtr>> ports;
+    std::vector<MemorySolver::Box> boxes;
+    std::vector<bool> pinned;
+    for (const auto& edge : dynamicEdges) {
+        auto parent = edge->getParent();
+        auto child = edge->getChild();
+        auto key = std::make_pair(parent.get(), edge->getInputNum());
+        auto found = portIndices.find(key);
+        if (found == portIndices.end()) {
+            found = portIndices.emplace(key, ports.size()).first;
+            ports.emplace_back();
+            int id = static_cast<int>(boxes.size());
+            boxes.push_back({execTimestamp(parent), execTimestamp(parent), 1, id});
+            pinned.push_back(false);
+        }
+        const auto idx = found->second;
+        ports[idx].push_back(edge);
+        boxes[idx].finish = std::max(boxes[idx].finish, execTimestamp(child));
+        // Graph inputs, outputs and constants must not be overwritten by other tensors
+        pinned[idx] = pinned[idx] || parent->getType() == Input || child->getType() == Output || parent->isConstant();
+    }
+    for (size_t i = 0; i < boxes.size(); i++) {
+        if (pinned[i]) {
+            boxes[i].start = 0;
+            boxes[i].finish = -1;
+        }
+    }
+
+    // With unit sizes the offset found by the solver is the index of a block
+    // shared by ports with non-overlapping lifetimes
+    MemorySolver memSolver(boxes);
+    dynamicMemoryBlocks.resize(static_cast<size_t>(memSolver.solve()));
+    for (auto& block : dynamicMemoryBlocks)
+        block = std::make_shared<MKLDNNDynamicMemoryBlock>();
+
+    for (size_t i = 0; i < ports.size(); i++) {
+        const auto& block = dynamicMemoryBlocks[static_cast<size_t>(memSolver.getOffset(static_cast<int>(i)))];
+        for (auto& edge : ports[i])
+            edge->getMemoryPtr()->setDynamicMemoryBlock(block);
+    }
+}
+
+size_t MKLDNNGraph::GetDynamicMemoryReallocations() const {
+    size_t reallocations = 0;
+    for (const auto& block : dynamicMemoryBlocks)
+        reallocations += block->getReallocationsCount();
+    return reallocations;
+}
+
 void MKLDNNGraph::Allocate() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::Allocate");
 
@@ -693,9 +810,18 @@ void MKLDNNGraph::Allocate() {
     // Resolve all other edges with status NotAllocated and in-place
     for (auto& node : graphNodes) node->resolveInPlaceEdges();
 
+    // Tensors with unknown upper bound are allocated on inference, when their shapes are known
+    std::vector<MKLDNNEdgePtr> dynamicEdges;
+    for (auto& edge : graphEdges) {
+        if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation && !edge->hasDefinedMaxSize())
+            dynamicEdges.push_back(edge);
+    }
+
     // Create dummy memory with undefined desc for edges that are not allocated on the previous stages (memory solver and inPlace resolving)
     for (auto& edge : graphEdges) edge->allocate();
 
+    AllocateDynamicMemoryBlocks(dynamicEdges);
+
     // Check all getters. Should work.
     for (auto& edge : graphEdges) edge->validate();
 }
@@ -704,6 +830,8 @@ void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
     for (auto& node : graphNodes) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.createPrimitive);
+        // nodes inserted by the graph optimizer (e.g. reorders) don't have the cache yet
+        node->setRuntimeCache(rtParamsCache);
         node->createPrimitive();
     }
 }
@@ -829,23 +957,53 @@ inline void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::st
         node->execute(stream);
 }
 
+void MKLDNNGraph::InferParallel(MKLDNNInferRequest* request) {
+    size_t maxLevelSize = 0;
+    for (const auto& level : executableGraphLevels)
+        maxLevelSize = std::max(maxLevelSize, level.size());
+    // oneDNN stream objects are not thread safe, so every concurrently executed node gets its own one
+    std::vector<mkldnn::stream> streams;
+    for (size_t i = 0; i < maxLevelSize; i++)
+        streams.emplace_back(eng);
+
+    for (const auto& level : executableGraphLevels) {
+        if (request)
+            request->ThrowIfCanceled();
+
+        parallel_for(level.size(), [&](size_t i) {
+            const auto& node = level[i];
+            VERBOSE(node, config.debugCaps.verbose);
+            PERF(node, config.collectPerfCounters);
+            ExecuteNode(node, streams[i]);
+        });
+    }
+}
+
 void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
     if (!IsReady()) {
         IE_THROW() << "Wrong state. Topology is not ready.";
     }
 
-    mkldnn::stream stream(eng);
+    const auto reallocationsBefore = GetDynamicMemoryReallocations();
+
+    if (!executableGraphLevels.empty()) {
+        InferParallel(request);
+    } else {
+        mkldnn::stream stream(eng);
 
-    for (const auto& node : executableGraphNodes) {
-        VERBOSE(node, config.debugCaps.verbose);
-        PERF(node, config.collectPerfCounters);
+        for (const auto& node : executableGraphNodes) {
+            VERBOSE(node, config.debugCaps.verbose);
+            PERF(node, config.collectPerfCounters);
 
-        if (request)
-            request->ThrowIfCanceled();
+            if (request)
+                request->ThrowIfCanceled();
 
-        ExecuteNode(node, stream);
+            ExecuteNode(node, stream);
+        }
     }
 
+    lastInferMemoryReallocations = GetDynamicMemoryReallocations() - reallocationsBefore;
+
     if (infer_count != -1) infer_count++;
 }
 
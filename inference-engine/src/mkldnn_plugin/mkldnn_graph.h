@@ -10,6 +10,7 @@
 #include "normalize_preprocess.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "utils/lru_cache.h"
 #include <map>
 #include <string>
 #include <vector>
@@ -41,6 +42,10 @@ public:
     void setConfig(const Config &cfg);
     const Config& getConfig() const;
 
+    void setRuntimeCache(const MultiCache::Ptr& cache) {
+        rtParamsCache = cache;
+    }
+
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
@@ -190,6 +195,23 @@ public:
         return graphHasDynamicInput;
     }
 
+    /**
+     * @brief Number of buffer reallocations of dynamic shape tensors during the last Infer() call.
+     * Tensors which upper bound is unknown take memory from grow-only blocks, so it is expected to be zero
+     * once the largest shapes have been seen.
+     */
+    size_t GetLastInferMemoryReallocations() const {
+        return lastInferMemoryReallocations;
+    }
+
+    /**
+     * @brief Number of edges which needed a reorder before and after the whole-graph layout selection.
+     * Both are zero if the selection is disabled.
+     */
+    std::pair<size_t, size_t> GetLayoutSelectionReorders() const {
+        return layoutSelectionReorders;
+    }
+
 protected:
     void VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes);
 
@@ -202,6 +224,8 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _normalizePreprocMap.clear();
+        execLevels.clear();
+        dynamicMemoryBlocks.clear();
     }
     Status status { NotReady };
     Config config;
@@ -220,9 +244,23 @@ protected:
     std::map<std::string, NormalizePreprocess> _normalizePreprocMap;
     std::string _name;
 
+    // Cache of node executors prepared for particular shapes, may be shared between graphs
+    MultiCache::Ptr rtParamsCache;
+
     bool isQuantizedFlag = false;
     bool graphHasDynamicInput = false;
 
+    // Level of each node (indexed by execIndex) in inter-op parallel mode: the longest path from graph inputs.
+    // Nodes of the same level don't depend on each other and are executed concurrently.
+    // Empty if nodes are executed sequentially.
+    std::vector<int> execLevels;
+
+    // Grow-only memory blocks shared by dynamic tensors with unknown upper bound
+    std::vector<MKLDNNDynamicMemoryBlock::Ptr> dynamicMemoryBlocks;
+    size_t lastInferMemoryReallocations = 0;
+
+    std::pair<size_t, size_t> layoutSelectionReorders = {0, 0};
+
     static mkldnn::engine eng;
 
     void Replicate(const InferenceEngine::CNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
@@ -234,9 +272,14 @@ protected:
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
+    void AllocateDynamicMemoryBlocks(const std::vector<MKLDNNEdgePtr>& dynamicEdges);
+    size_t GetDynamicMemoryReallocations() const;
     void CreatePrimitives();
+    bool CanExecuteInParallel() const;
+    void InitExecLevels();
     void ExtractConstantAndExecutableNodes();
     void ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream) const;
+    void InferParallel(MKLDNNInferRequest* request);
     void ExecuteConstantNodesOnly() const;
 
     friend class MKLDNNInferRequest;
@@ -253,6 +296,8 @@ private:
     // non-executable (optimized out) nodes, such as Input, Reshape, etc.
     std::vector<MKLDNNNodePtr> constantGraphNodes;
     std::vector<MKLDNNNodePtr> executableGraphNodes;
+    // executable nodes grouped by execution level, used in inter-op parallel mode only
+    std::vector<std::vector<MKLDNNNodePtr>> executableGraphLevels;
 
     void EnforceBF16();
 };
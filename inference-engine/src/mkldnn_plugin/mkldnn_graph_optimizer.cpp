@@ -11,6 +11,7 @@
 #include "nodes/mkldnn_concat_node.h"
 #include "nodes/mkldnn_reorder_node.h"
 #include "nodes/mkldnn_conv_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
 #include "nodes/mkldnn_bin_conv_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
 #include "nodes/mkldnn_mvn_node.h"
@@ -53,7 +54,11 @@ using namespace InferenceEngine;
 MKLDNNGraphOptimizer::MKLDNNGraphOptimizer() {}
 
 void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::MKLDNN_LT, "ApplyCommonGraphOptimizations", "FuseConvolutionAndBias");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::MKLDNN_LT, "ApplyCommonGraphOptimizations", "FuseFullyConnectedAndWeightsDecompression");
+    FuseFullyConnectedAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionAndBias(graph);
     graph.RemoveDroppedNodes();
 
@@ -606,6 +611,95 @@ static bool BF16QuantizeNodeFusing(MKLDNNNodePtr parentNode, MKLDNNNodePtr child
             childNode->getOriginalOutputPrecisionAtPort(0));
 }
 
+void MKLDNNGraphOptimizer::FuseFullyConnectedAndWeightsDecompression(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // Only a few rows are processed by the decompressing kernel: the bigger inputs are compute bound and are faster
+    // with the oneDNN inner product over the weights decompressed once by the constant subgraph.
+    const size_t maxRowsNum = 8;
+
+    auto isSuitableFullyConnected = [&](const MKLDNNNodePtr& node) {
+        if (node->getType() != FullyConnected || !node->getFusedWith().empty() ||
+            node->getOriginalInputPrecisionAtPort(0) != Precision::FP32)
+            return false;
+        const auto& inDims = node->getInputShapeAtPort(0).getDims();
+        if (!one_of(inDims.size(), 2, 3) || !node->getInputShapeAtPort(0).isStatic())
+            return false;
+        size_t rowsNum = 1;
+        for (size_t i = 0; i < inDims.size() - 1; i++)
+            rowsNum *= inDims[i];
+        return rowsNum <= maxRowsNum;
+    };
+
+    auto isConstantInput = [](const MKLDNNNodePtr& node, Precision prc) {
+        return node->getType() == Input && node->isConstant() && node->getOriginalOutputPrecisionAtPort(0) == prc;
+    };
+
+    auto isSuitableEltwise = [&](const MKLDNNNodePtr& node, Algorithm alg, size_t N) {
+        if (node->getType() != Eltwise || node->getAlgorithm() != alg || node->getParentEdges().size() != 2 ||
+            node->getChildEdges().size() != 1 || !node->getFusedWith().empty())
+            return false;
+        auto constant = node->getParentEdgesAtPort(1)[0]->getParent();
+        const auto& constDims = node->getInputShapeAtPort(1).getDims();
+        return isConstantInput(constant, Precision::FP32) && constDims.size() == 2 &&
+               constDims[0] == N && constDims[1] == 1;
+    };
+
+    auto getConstantData = [](const MKLDNNNodePtr& node, size_t N) {
+        auto constant = dynamic_cast<MKLDNNInputNode*>(node->getParentEdgesAtPort(1)[0]->getParent().get());
+        if (constant == nullptr)
+            IE_THROW() << "Cannot cast " << node->getName() << " input to Input node";
+        auto data = static_cast<const float*>(constant->getMemoryPtr()->GetPtr());
+        if (data == nullptr)
+            IE_THROW() << "Constant input of " << node->getName() << " has not allocated buffer";
+        return std::vector<float>(data, data + N);
+    };
+
+    for (auto& node : graphNodes) {
+        if (!isSuitableFullyConnected(node))
+            continue;
+        auto fcNode = std::dynamic_pointer_cast<MKLDNNFullyConnectedNode>(node);
+        if (!fcNode)
+            continue;
+
+        const auto& outDims = node->getOutputShapeAtPort(0).getDims();
+        const size_t N = outDims.back();
+
+        auto multiply = node->getParentEdgesAtPort(1)[0]->getParent();
+        if (!isSuitableEltwise(multiply, Algorithm::EltwiseMultiply, N))
+            continue;
+        auto convert = multiply->getParentEdgesAtPort(0)[0]->getParent();
+        MKLDNNNodePtr subtract;
+        if (isSuitableEltwise(convert, Algorithm::EltwiseSubtract, N)) {
+            subtract = convert;
+            convert = subtract->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        if (convert->getType() != Convert || convert->getChildEdges().size() != 1)
+            continue;
+
+        auto weights = convert->getParentEdgesAtPort(0)[0]->getParent();
+        Precision weightsPrc = weights->getOriginalOutputPrecisionAtPort(0);
+        if (!one_of(weightsPrc, Precision::U8, Precision::I8) || !isConstantInput(weights, weightsPrc) ||
+            weights->getOutputShapeAtPort(0).getRank() != 2 || weights->getOutputShapeAtPort(0).getDims()[0] != N)
+            continue;
+
+        fcNode->decompressionMultiply = getConstantData(multiply, N);
+        if (subtract)
+            fcNode->decompressionSubtract = getConstantData(subtract, N);
+
+        for (auto& eltwise : {multiply, subtract}) {
+            if (!eltwise)
+                continue;
+            auto constEdge = eltwise->getParentEdgesAtPort(1)[0];
+            graph.RemoveEdge(constEdge);
+            graph.DropNode(eltwise);
+        }
+        graph.DropNode(convert);
+
+        node->setOriginalInputPrecisionAtPort(1, weightsPrc);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
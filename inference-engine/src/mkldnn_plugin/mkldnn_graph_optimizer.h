@@ -20,6 +20,7 @@ public:
 
 private:
     void FuseConvolutionAndBias(MKLDNNGraph &graph);
+    void FuseFullyConnectedAndWeightsDecompression(MKLDNNGraph &graph);
     void FuseDeconvolutionAndSimpleOperation(MKLDNNGraph &graph);
     void FuseMultiplyAndAdd(MKLDNNGraph &graph);
     void FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &graph);
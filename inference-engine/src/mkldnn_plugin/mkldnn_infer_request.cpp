@@ -24,6 +24,14 @@
 #include "utils/cpu_utils.hpp"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 
+static std::string getVariableName(const std::string& memoryNodeId) {
+    // Remove suffix with pair ID. Internal information.
+    auto suffix_idx = memoryNodeId.find("/id=");
+    if (suffix_idx != std::string::npos)
+        return memoryNodeId.substr(0, suffix_idx);
+    return memoryNodeId;
+}
+
 MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsDataMap     networkInputs,
                                                      InferenceEngine::OutputsDataMap    networkOutputs,
                                                      MKLDNNExecNetwork::Ptr             execNetwork_)
@@ -54,12 +62,7 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
             if (node->getType() == MemoryInput) {
                 auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
                 auto state_store = memoryNode->getStore();
-                auto state_name = memoryNode->getId();
-
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
+                auto state_name = getVariableName(memoryNode->getId());
 
                 memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
            }
@@ -127,38 +130,35 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
     }
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
+void MKLDNNPlugin::MKLDNNInferRequest::BindStates() {
+    // The graph may be shared by several requests, so the buffers of this request are bound before each inference.
+    // It redirects the graph edges only, the state data isn't copied.
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
             auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            auto cur_id = cur_node->getId();
+            auto cur_id = getVariableName(cur_node->getId());
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<MKLDNNVariableState>(state);
+                    IE_ASSERT(cur_state != nullptr);
+                    cur_node->setStateBuffers(cur_state->getActive(), cur_state->getInactive());
                 }
             }
         }
     }
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
+void MKLDNNPlugin::MKLDNNInferRequest::SwapStates() {
+    // the new state is written to the inactive buffer, it becomes the active one for the next inference
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
             auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            auto cur_id = cur_node->getId();
+            auto cur_id = getVariableName(cur_node->getId());
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                    auto cur_state = std::dynamic_pointer_cast<MKLDNNVariableState>(state);
+                    IE_ASSERT(cur_state != nullptr);
+                    cur_state->swapBuffers();
                 }
             }
         }
@@ -197,13 +197,13 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     PushInputData();
 
     if (memoryStates.size() != 0) {
-        PushStates();
+        BindStates();
     }
 
     graph->Infer(this, m_curBatch);
 
     if (memoryStates.size() != 0) {
-        PullStates();
+        SwapStates();
     }
 
     ThrowIfCanceled();
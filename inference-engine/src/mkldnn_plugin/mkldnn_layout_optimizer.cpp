@@ -0,0 +1,168 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_layout_optimizer.h"
+
+#include "utils/general_utils.h"
+#include "utils/layout_assignment.h"
+#include "memory_desc/blocked_memory_desc.h"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+// Fixed cost of a reorder primitive execution in terms of memory traffic, so that a reorder of a tiny tensor
+// is not considered free
+constexpr float reorderOverhead = 4096.f;
+
+bool isLayoutFixed(MKLDNNNode& node) {
+    // oneDNN based nodes choose the layout using their own knowledge of the compute efficiency, memory nodes and
+    // nodes with the custom selection logic (in-place Concat and Split) depend on the layouts of their neighbours
+    return node.isDynamicNode() ||
+           one_of(node.getType(), Input, Output, MemoryInput, MemoryOutput, Reorder, Concatenation, Split,
+                  Convolution, Deconvolution, BinaryConvolution, FullyConnected, MatMul,
+                  RNNCell, RNNSeq, TensorIterator, If);
+}
+
+float descBytes(const MemoryDescPtr& desc) {
+    if (!desc)
+        return 0.f;
+    if (desc->isDefined())
+        return static_cast<float>(desc->getCurrentMemSize());
+    const auto& shape = desc->getShape();
+    if (!shape.isStatic())
+        return 0.f;
+    const auto prcSize = static_cast<float>(desc->getPrecision().size());
+    // strides may be undefined yet, the blocked dims still show the padding
+    if (desc->getType() & Blocked) {
+        const auto& blockDims = desc->as<BlockedMemoryDesc>()->getBlockDims();
+        if (std::none_of(blockDims.begin(), blockDims.end(), [](size_t dim) { return dim == Shape::UNDEFINED_DIM; }))
+            return prcSize * std::accumulate(blockDims.begin(), blockDims.end(), 1.f, std::multiplies<float>());
+    }
+    return prcSize * static_cast<float>(shape.getElementsCount());
+}
+
+float kernelCost(const NodeDesc& pd) {
+    float cost = 0.f;
+    for (const auto& conf : pd.getConfig().inConfs)
+        cost += descBytes(conf.desc);
+    for (const auto& conf : pd.getConfig().outConfs)
+        cost += descBytes(conf.desc);
+    return cost;
+}
+
+float reorderCost(const MKLDNNEdgePtr& edge, const NodeDesc& parentPd, const NodeDesc& childPd) {
+    // reorders of constant inputs are executed only once, on the network loading
+    if (edge->getParent()->isConstant() && !edge->getChild()->isConstant())
+        return 0.f;
+
+    const auto& outConfs = parentPd.getConfig().outConfs;
+    const auto& inConfs = childPd.getConfig().inConfs;
+    int inNum = edge->getInputNum();
+    const int outNum = edge->getOutputNum();
+    if (outConfs.empty() || outNum < 0 || outNum >= inConfs.size())
+        return 0.f;
+    if (inNum < 0 || inNum >= outConfs.size())
+        inNum = 0;
+
+    const auto& parentDesc = outConfs[inNum].desc;
+    const auto& childDesc = inConfs[outNum].desc;
+    if (!parentDesc || !childDesc || childDesc->isCompatible(*parentDesc))
+        return 0.f;
+    return descBytes(parentDesc) + descBytes(childDesc) + reorderOverhead;
+}
+
+size_t countReorders(const std::vector<MKLDNNEdgePtr>& edges) {
+    size_t count = 0;
+    for (const auto& edge : edges) {
+        const auto parentPd = edge->getParent()->getSelectedPrimitiveDescriptor();
+        const auto childPd = edge->getChild()->getSelectedPrimitiveDescriptor();
+        if (parentPd && childPd && reorderCost(edge, *parentPd, *childPd) > 0.f)
+            count++;
+    }
+    return count;
+}
+
+}  // namespace
+
+std::pair<size_t, size_t> MKLDNNLayoutOptimizer::SelectLayouts(MKLDNNGraph& graph) {
+    const auto& graphNodes = graph.GetNodes();
+    const auto& graphEdges = graph.GetEdges();
+    const size_t reordersBefore = countReorders(graphEdges);
+    if (reordersBefore == 0)
+        return {0, 0};
+
+    LayoutAssignment assignment;
+    // indices of the candidate primitive descriptors of every node
+    std::vector<std::vector<int>> candidates(graphNodes.size());
+    std::unordered_map<const MKLDNNNode*, size_t> nodeIds;
+    bool hasChoice = false;
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto& node = graphNodes[i];
+        const auto& supportedPds = node->getSupportedPrimitiveDescriptors();
+        const auto selectedPd = node->getSelectedPrimitiveDescriptor();
+        if (!selectedPd)
+            return {reordersBefore, reordersBefore};
+        const int selected = static_cast<int>(selectedPd - supportedPds.data());
+
+        std::vector<float> costs;
+        size_t initial = 0;
+        if (isLayoutFixed(*node)) {
+            candidates[i] = {selected};
+            costs = {0.f};
+        } else {
+            // layouts are selected among the implementations of the same type only, the type itself is chosen
+            // by the node priorities
+            for (size_t j = 0; j < supportedPds.size(); j++) {
+                if (static_cast<int>(j) != selected &&
+                    (supportedPds[j].getImplementationType() != selectedPd->getImplementationType() ||
+                     supportedPds[j].getConfig().inConfs.size() > node->getParentEdges().size()))
+                    continue;
+                if (static_cast<int>(j) == selected)
+                    initial = candidates[i].size();
+                candidates[i].push_back(static_cast<int>(j));
+                costs.push_back(kernelCost(supportedPds[j]));
+            }
+            hasChoice |= candidates[i].size() > 1;
+        }
+        nodeIds[node.get()] = assignment.addNode(std::move(costs), initial);
+    }
+    if (!hasChoice)
+        return {reordersBefore, reordersBefore};
+
+    for (const auto& edge : graphEdges) {
+        const auto parent = edge->getParent();
+        const auto child = edge->getChild();
+        const size_t parentId = nodeIds.at(parent.get());
+        const size_t childId = nodeIds.at(child.get());
+        if (parentId >= childId)
+            continue;
+
+        const auto& parentPds = parent->getSupportedPrimitiveDescriptors();
+        const auto& childPds = child->getSupportedPrimitiveDescriptors();
+        std::vector<float> costs;
+        costs.reserve(candidates[parentId].size() * candidates[childId].size());
+        for (auto p : candidates[parentId]) {
+            for (auto c : candidates[childId])
+                costs.push_back(reorderCost(edge, parentPds[p], childPds[c]));
+        }
+        assignment.addEdge(parentId, childId, std::move(costs));
+    }
+
+    assignment.solve();
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        if (candidates[i].size() > 1)
+            graphNodes[i]->selectPrimitiveDescriptorByIndex(candidates[i][assignment.getSelected(i)]);
+    }
+
+    return {reordersBefore, countReorders(graphEdges)};
+}
@@ -0,0 +1,30 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_graph.h"
+
+#include <utility>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Whole-graph selection of the primitive descriptors layouts.
+ *
+ * Primitive descriptors are selected node by node in the topological order, so a node doesn't know which layout
+ * its consumers prefer and a reorder is inserted on every edge where the neighbours disagree. This pass revisits
+ * the layouts chosen for the nodes with several candidates of the same implementation type and minimizes
+ * the estimated memory traffic of the kernels and the reorders over the whole graph.
+ */
+class MKLDNNLayoutOptimizer {
+public:
+    /**
+     * @brief Must be called after the primitive descriptors are selected and before they are initialized
+     * @return number of the edges which needed a reorder before and after the selection
+     */
+    std::pair<size_t, size_t> SelectLayouts(MKLDNNGraph& graph);
+};
+
+}  // namespace MKLDNNPlugin
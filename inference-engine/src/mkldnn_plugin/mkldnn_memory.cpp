@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstdint>
 #include <vector>
 #include <algorithm>
 #include <numeric>
@@ -38,6 +39,19 @@ namespace {
     }
 }   // namespace
 
+std::shared_ptr<void> MKLDNNDynamicMemoryBlock::acquire(size_t size) {
+    if (size > bufferSize) {
+        constexpr size_t alignment = 64;
+        std::shared_ptr<uint8_t> storage(new uint8_t[size + alignment], std::default_delete<uint8_t[]>());
+        auto address = reinterpret_cast<uintptr_t>(storage.get());
+        auto aligned = reinterpret_cast<void*>((address + alignment - 1) / alignment * alignment);
+        buffer = std::shared_ptr<void>(storage, aligned);
+        bufferSize = size;
+        reallocations++;
+    }
+    return buffer;
+}
+
 MKLDNNMemory::MKLDNNMemory(const mkldnn::engine& eng) : eng(eng) {}
 
 size_t MKLDNNMemory::GetSize() const {
@@ -161,6 +175,11 @@ void MKLDNNMemory::redefineDesc(MemoryDescPtr desc, void *data) {
         } else {
             this->Create(std::move(desc), nullptr, false);
         }
+    } else if (dynamicMemoryBlock && desc->isDefined() && desc->getCurrentMemSize() > 0) {
+        dynamicBuffer = dynamicMemoryBlock->acquire(desc->getCurrentMemSize());
+        this->Create(std::move(desc), dynamicBuffer.get(), false);
+        // the buffer is owned by the memory object, not provided from outside
+        useExternalStorage = false;
     } else {
         this->Create(std::move(desc), nullptr, false);
     }
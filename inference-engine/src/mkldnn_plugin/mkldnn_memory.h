@@ -31,6 +31,38 @@
 
 namespace MKLDNNPlugin {
 
+/**
+ * Grow-only buffer for tensors with dynamic shapes which upper bound is unknown at compile time.
+ * Tensors with non-overlapping lifetimes may share one block. A larger request replaces the block buffer with
+ * a new one, while tensors still using the previous buffer keep it alive until they are redefined.
+ * So data pointer of a tensor is changed only by redefinition of this very tensor.
+ */
+class MKLDNNDynamicMemoryBlock {
+public:
+    typedef std::shared_ptr<MKLDNNDynamicMemoryBlock> Ptr;
+
+    /**
+     * Returns the block buffer if it fits the size or allocates a bigger one
+     * @param size
+     * requested size in bytes
+     * @return buffer of at least size bytes
+     */
+    std::shared_ptr<void> acquire(size_t size);
+
+    size_t getSize() const noexcept {
+        return bufferSize;
+    }
+
+    size_t getReallocationsCount() const noexcept {
+        return reallocations;
+    }
+
+private:
+    std::shared_ptr<void> buffer;
+    size_t bufferSize = 0;
+    size_t reallocations = 0;
+};
+
 class MKLDNNMemory {
 public:
     explicit MKLDNNMemory(const mkldnn::engine& eng);
@@ -114,6 +146,11 @@ public:
         return useExternalStorage;
     }
 
+    // Makes redefineDesc() take the memory from the grow-only block instead of allocating a new buffer
+    void setDynamicMemoryBlock(MKLDNNDynamicMemoryBlock::Ptr block) {
+        dynamicMemoryBlock = std::move(block);
+    }
+
 private:
     void Create(const mkldnn::memory::dims& dims, mkldnn::memory::data_type data_type, mkldnn::memory::format_tag format,
                 const void* data = nullptr);
@@ -126,6 +163,8 @@ private:
     mkldnn::engine eng;
     bool useExternalStorage = false;
     size_t memUpperBound = 0ul;
+    MKLDNNDynamicMemoryBlock::Ptr dynamicMemoryBlock;
+    std::shared_ptr<void> dynamicBuffer;
 };
 
 using MKLDNNMemoryPtr = std::shared_ptr<MKLDNNMemory>;
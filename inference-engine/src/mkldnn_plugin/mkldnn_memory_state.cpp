@@ -10,8 +10,36 @@ using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
 
+MKLDNNVariableState::MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
+        InferenceEngine::IVariableStateInternal{name} {
+    for (size_t i = 0; i < buffers.size(); i++) {
+        buffers[i] = std::make_shared<MKLDNNMemory>(storage->getEngine());
+        buffers[i]->Create(storage->getDesc());
+    }
+    cpu_memcpy(buffers[active]->GetPtr(), storage->GetPtr(), storage->GetSize());
+    // the buffers are swapped on every inference, so a blob held by the user is a separate copy
+    state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
+    state->allocate();
+}
+
 void  MKLDNNVariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    std::memset(getActive()->GetPtr(), 0, getActive()->GetSize());
+}
+
+void MKLDNNVariableState::SetState(const Blob::Ptr& newState) {
+    if (!newState || newState->byteSize() != state->byteSize())
+        IE_THROW() << "Cannot set state '" << name << "': blob size doesn't match the variable size";
+    // the buffers stay bound to the graph, so the new value is copied instead of replacing the blob
+    cpu_memcpy(getActive()->GetPtr(), newState->cbuffer().as<const void*>(), state->byteSize());
+}
+
+Blob::CPtr MKLDNNVariableState::GetState() const {
+    cpu_memcpy(state->buffer(), getActive()->GetPtr(), state->byteSize());
+    return state;
+}
+
+void MKLDNNVariableState::swapBuffers() {
+    active ^= 1;
 }
 
 }  // namespace MKLDNNPlugin
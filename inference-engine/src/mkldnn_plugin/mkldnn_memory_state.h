@@ -10,20 +10,36 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
+#include <array>
 #include <string>
 
 namespace MKLDNNPlugin {
 
+/**
+ * @brief Variable state which owns a pair of ping-pong buffers. ReadValue reads the active buffer
+ * while Assign writes the inactive one, the buffers are swapped after the inference step.
+ * The buffers are bound to the graph memory nodes by pointer, so the state is not copied in and out of the graph.
+ * GetState() returns the same blob all the time, the active buffer is copied to it on every call.
+ */
 class MKLDNNVariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
-            InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
-    }
+    MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage);
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    const MKLDNNMemoryPtr& getActive() const {
+        return buffers[active];
+    }
+    const MKLDNNMemoryPtr& getInactive() const {
+        return buffers[active ^ 1];
+    }
+    void swapBuffers();
+
+private:
+    std::array<MKLDNNMemoryPtr, 2> buffers;
+    size_t active = 0;
 };
 
-}  // namespace MKLDNNPlugin
\ No newline at end of file
+}  // namespace MKLDNNPlugin
@@ -19,6 +19,7 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_primitive.h"
 #include "mkldnn_weights_cache.hpp"
+#include "utils/lru_cache.h"
 #include "mkldnn.hpp"
 #include <openvino/itt.hpp>
 #include "utils/ngraph_utils.hpp"
@@ -376,6 +377,14 @@ public:
      */
     virtual void init() {}
 
+    /**
+     * @brief Sets the cache of runtime parameters (e.g. JIT executors) which the node prepares for particular shapes.
+     * The cache may be shared between nodes of several graphs, nullptr disables caching
+     */
+    void setRuntimeCache(const MultiCache::Ptr& cache) {
+        rtParamsCache = cache;
+    }
+
     template <class PD, class D, typename FPD = bool>
     PD createPrimitiveDescriptor(const mkldnn::primitive_attr &attr = mkldnn::primitive_attr()) {
         auto descsCompatible = [](const std::vector<MemoryDescPtr>& srcDescs,
@@ -618,6 +627,7 @@ protected:
     std::vector<MKLDNNDescriptor> descs;
 
     MKLDNNWeightsSharing::Ptr weightCache;
+    MultiCache::Ptr rtParamsCache;
 
     Algorithm algorithm = Algorithm::Default;
 
@@ -29,6 +29,7 @@
 #include <transformations/common_optimizations/weights_dequantize_to_fake_quantize.hpp>
 #include "transformations/common_optimizations/convert_quantize_dequantize.hpp"
 #include <transformations/common_optimizations/nop_elimination.hpp>
+#include <transformations/common_optimizations/mha_fusion.hpp>
 #include <transformations/op_conversions/convert_depth_to_space.hpp>
 #include <transformations/op_conversions/convert_shuffle_channels3.hpp>
 #include <transformations/op_conversions/convert_space_to_depth.hpp>
@@ -67,6 +68,7 @@
 #include <transformations/convert_precision.hpp>
 #include <transformations/init_node_info.hpp>
 #include <transformations/rt_info/fused_names_attribute.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 #include <transformations/op_conversions/fq_decomposition.hpp>
 #include <transformations/utils/utils.hpp>
 
@@ -74,6 +76,7 @@
 #include <ngraph/opsets/opset2.hpp>
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset5.hpp>
 #include <ngraph/opsets/opset6.hpp>
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/pass/manager.hpp>
@@ -99,7 +102,9 @@
 #include "nodes/mkldnn_fake_quantize_node.h"
 #include "nodes/mkldnn_normalize_node.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
+#include "ngraph_transformations/mark_weights_decompression.hpp"
 #include "transformations/smart_reshape/smart_reshape.hpp"
+#include "snippets/pass/collapse_subgraph.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 # ifdef _WIN32
@@ -134,6 +139,9 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     if (useLpt) {
         manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(
             std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8, ngraph::element::i4, ngraph::element::u4 });
+    } else {
+        // u8/i8 MatMul weights are decompressed by the FullyConnected node instead of being folded to fp32
+        manager.register_pass<MarkWeightsDecompression>();
     }
 
     auto get_convert_precisions = []() {
@@ -333,6 +341,9 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     pass_config->enable<ngraph::pass::ConvertInterpolate1ToInterpolate4>();
     pass_config->enable<ngraph::pass::ConvertGather1ToGather7>();
     pass_config->enable<ngraph::pass::ConvertGather8ToGather7>();
+    // the attention MatMuls of the quantized models are left to LPT
+    if (!useLpt)
+        pass_config->enable<ngraph::pass::MultiHeadAttentionFusion>();
 
     if (useLpt) {
         pass_config->set_callback<ngraph::pass::ConvertQuantizeDequantize>([](const_node_ptr &node) -> bool {
@@ -342,6 +353,12 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
         pass_config->set_callback<ngraph::pass::ConvertSubtract>([](const_node_ptr &node) -> bool {
             return ngraph::pass::low_precision::NetworkHelper::areQuantizeAndDequantizeSupportedForSubtract(node);
         });
+    } else {
+        // zero points of the compressed weights are subtracted by the FullyConnected node as is
+        pass_config->set_callback<ngraph::pass::ConvertSubtract>([](const_node_ptr &node) -> bool {
+            const auto convert = node->get_input_node_shared_ptr(0);
+            return ngraph::is_type<ngraph::opset1::Convert>(convert) && ov::constant_folding_is_disabled(convert);
+        });
     }
 
     manager.run_passes(nGraphFunc);
@@ -371,8 +388,26 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
                 {0, {ngraph::element::u8, ngraph::element::i8}},
                 {1, {ngraph::element::i8}}
             }),
+            // int8 recurrent primitive is used for LSTM only
+            OperationPrecisionRestriction::create<ngraph::opset3::GRUCell>({}),
+            OperationPrecisionRestriction::create<ngraph::opset5::GRUSequence>({}),
         });
 
+        // int8 LSTM is faster than fp32 one only if the gemm uses int8 dot products
+        if (with_cpu_x86_avx512_core()) {
+            supportedPrecisions.push_back(OperationPrecisionRestriction::create<ngraph::opset4::LSTMCell>({
+                {0, {ngraph::element::u8}},
+                {1, {ngraph::element::u8}}
+            }));
+            supportedPrecisions.push_back(OperationPrecisionRestriction::create<ngraph::opset5::LSTMSequence>({
+                {0, {ngraph::element::u8}},
+                {1, {ngraph::element::u8}}
+            }));
+        } else {
+            supportedPrecisions.push_back(OperationPrecisionRestriction::create<ngraph::opset4::LSTMCell>({}));
+            supportedPrecisions.push_back(OperationPrecisionRestriction::create<ngraph::opset5::LSTMSequence>({}));
+        }
+
         auto perTensorQuantization = std::vector<OperationPerTensorQuantizationRestriction>({
             OperationPerTensorQuantizationRestriction::create<ngraph::opset1::Convolution>({0}),
             OperationPerTensorQuantizationRestriction::create<ngraph::opset1::ConvolutionBackpropData>({0})
@@ -434,6 +469,12 @@ static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT) {
     ConvertToCPUSpecificOpset(nGraphFunc);
 }
 
+static void TokenizeSnippets(std::shared_ptr<ngraph::Function> nGraphFunc) {
+    ngraph::pass::Manager tokenizationManager;
+    tokenizationManager.register_pass<ngraph::snippets::pass::TokenizeSnippets>();
+    tokenizationManager.run_passes(nGraphFunc);
+}
+
 InferenceEngine::IExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &orig_config) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::LoadExeNetworkImpl");
@@ -545,6 +586,10 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     if (conf.enableDynamicBatch) {
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
+    // snippets kernels are generated for AVX2 and newer, on older hosts the elementwise nodes are kept as is
+    if (conf.enableSnippets && with_cpu_x86_avx2()) {
+        TokenizeSnippets(nGraphFunc);
+    }
 
     return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
 }
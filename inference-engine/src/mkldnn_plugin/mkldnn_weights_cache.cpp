@@ -9,6 +9,12 @@
 
 namespace MKLDNNPlugin {
 
+constexpr size_t SimpleDataHash::chunkSize;
+
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size) const {
+    return InferenceEngine::hashData(data, size);
+}
+
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::MKLDNNSharedMemory(
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <mkldnn_memory.h>
+#include <ie_data_hash.hpp>
 
 #include <unordered_map>
 #include <functional>
@@ -24,26 +25,15 @@ namespace MKLDNNPlugin {
 
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
-
-protected:
-    static const int kTableSize = 256;
-    uint64_t table[kTableSize];
+    /**
+     * Computes 64-bit non-cryptographic hash of the data (xxHash64 scheme processing 8 bytes per step in 4 independent lanes).
+     * Large buffers are split into fixed size chunks hashed in parallel, so the result doesn't depend on the number of threads.
+     * Hash values are only meaningful within the process, they are not stored anywhere
+     */
+    uint64_t hash(const unsigned char* data, size_t size) const;
+
+    // Size of the chunks hashed in parallel
+    static constexpr size_t chunkSize = InferenceEngine::dataHashChunkSize;
 };
 
 /**
@@ -8,12 +8,30 @@
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <transformations/utils/utils.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 
 NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::ConvertMatMulToFC, "ConvertMatMulToFC", 0);
 
+namespace {
+
+// Constant -> Convert -> [Subtract] -> Multiply subgraph left by MarkWeightsDecompression
+bool isWeightsDecompression(const std::shared_ptr<ngraph::Node>& node) {
+    if (!ngraph::is_type<ngraph::opset1::Multiply>(node)) {
+        return false;
+    }
+    auto parent = node->get_input_node_shared_ptr(0);
+    if (ngraph::is_type<ngraph::opset1::Subtract>(parent)) {
+        parent = parent->get_input_node_shared_ptr(0);
+    }
+    return ngraph::is_type<ngraph::opset1::Convert>(parent) && ov::constant_folding_is_disabled(parent) &&
+           ngraph::is_type<ngraph::opset1::Constant>(parent->get_input_node_shared_ptr(0));
+}
+
+}  // namespace
+
 MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
     auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
-    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto weights_m = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
     auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m }, ngraph::pattern::has_static_rank());
 
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
@@ -43,7 +61,8 @@ MKLDNNPlugin::ConvertMatMulToFC::ConvertMatMulToFC() {
 
         // Check that if second inputs is Constant path and it's shape without ones dimensions has length <= 2
         // we replace MatMul with FullyConnected operation.
-        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
+        if ((!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) &&
+             !isWeightsDecompression(fc_input_b.get_node_shared_ptr())) ||
             std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
             return false;
         }
@@ -0,0 +1,140 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_weights_decompression.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/pattern/op/or.hpp>
+
+#include "transformations/utils/utils.hpp"
+#include "transformations/rt_info/disable_constant_folding.hpp"
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::MarkWeightsDecompression, "MarkWeightsDecompression", 0);
+
+MKLDNNPlugin::MarkWeightsDecompression::MarkWeightsDecompression() {
+    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(
+        ngraph::pattern::type_matches_any({ ngraph::element::u8, ngraph::element::i8 }));
+    auto convert_m = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({ weights_m }, ngraph::pattern::consumers_count(1));
+    auto zero_points_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto subtract_m = ngraph::pattern::wrap_type<ngraph::opset1::Subtract>({ convert_m, zero_points_m }, ngraph::pattern::consumers_count(1));
+    auto subtract_or_convert_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{ convert_m, subtract_m });
+    auto scales_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto multiply_m = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({ subtract_or_convert_m, scales_m }, ngraph::pattern::consumers_count(1));
+    auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, multiply_m });
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+
+        auto matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_map.at(matmul_m).get_node_shared_ptr());
+        if (!matmul || transformation_callback(matmul)) {
+            return false;
+        }
+
+        auto weights = std::dynamic_pointer_cast<ngraph::opset1::Constant>(pattern_map.at(weights_m).get_node_shared_ptr());
+        auto convert = pattern_map.at(convert_m).get_node_shared_ptr();
+        auto multiply = pattern_map.at(multiply_m).get_node_shared_ptr();
+        auto scales = std::dynamic_pointer_cast<ngraph::opset1::Constant>(pattern_map.at(scales_m).get_node_shared_ptr());
+        const bool with_zero_points = pattern_map.count(subtract_m) != 0;
+        if (!weights || !scales || ov::constant_folding_is_disabled(convert) ||
+            convert->get_output_element_type(0) != ngraph::element::f32) {
+            return false;
+        }
+
+        // FullyConnected weights are [N, K], the output channels are the rows after the transposition
+        const auto& weights_shape = weights->get_shape();
+        if (weights_shape.size() != 2) {
+            return false;
+        }
+        const bool transpose_b = matmul->get_transpose_b();
+        const size_t N = transpose_b ? weights_shape[0] : weights_shape[1];
+        if (N == 1) {
+            return false;
+        }
+
+        // only scalar and per output channel scales and zero points are kept in the decompression subgraph
+        auto to_per_channel = [&](const std::shared_ptr<ngraph::opset1::Constant>& constant) -> std::shared_ptr<ngraph::Node> {
+            if (!constant) {
+                return nullptr;
+            }
+            auto shape = constant->get_shape();
+            if (shape.size() > 2) {
+                return nullptr;
+            }
+            auto values = constant->cast_vector<float>();
+            if (values.size() == 1) {
+                values.resize(N, values[0]);
+            } else {
+                shape.insert(shape.begin(), 2 - shape.size(), 1);
+                const size_t channel_axis = transpose_b ? 0 : 1;
+                if (shape[channel_axis] != N || shape[1 - channel_axis] != 1) {
+                    return nullptr;
+                }
+            }
+            return ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ N, 1 }, values);
+        };
+
+        ngraph::NodeVector new_ops;
+        auto new_scales = to_per_channel(scales);
+        std::shared_ptr<ngraph::Node> new_zero_points;
+        if (with_zero_points) {
+            new_zero_points = to_per_channel(std::dynamic_pointer_cast<ngraph::opset1::Constant>(
+                pattern_map.at(zero_points_m).get_node_shared_ptr()));
+            if (!new_zero_points) {
+                return false;
+            }
+        }
+        if (!new_scales) {
+            return false;
+        }
+
+        std::shared_ptr<ngraph::Node> new_weights = weights;
+        if (!transpose_b) {
+            auto transpose_const = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { 1, 0 });
+            new_weights = ngraph::op::util::make_try_fold<ngraph::opset1::Transpose>(weights, transpose_const);
+            if (!ngraph::is_type<ngraph::opset1::Constant>(new_weights)) {
+                return false;
+            }
+            new_weights->set_friendly_name(weights->get_friendly_name() + "/transpose_b");
+            new_ops.push_back(new_weights);
+        }
+
+        auto new_convert = std::make_shared<ngraph::opset1::Convert>(new_weights, ngraph::element::f32);
+        new_convert->set_friendly_name(convert->get_friendly_name());
+        new_ops.push_back(new_convert);
+
+        std::shared_ptr<ngraph::Node> decompressed = new_convert;
+        if (with_zero_points) {
+            auto subtract = pattern_map.at(subtract_m).get_node_shared_ptr();
+            decompressed = std::make_shared<ngraph::opset1::Subtract>(decompressed, new_zero_points);
+            decompressed->set_friendly_name(subtract->get_friendly_name());
+            new_ops.push_back(new_zero_points);
+            new_ops.push_back(decompressed);
+        }
+
+        auto new_multiply = std::make_shared<ngraph::opset1::Multiply>(decompressed, new_scales);
+        new_multiply->set_friendly_name(multiply->get_friendly_name());
+        new_ops.push_back(new_scales);
+        new_ops.push_back(new_multiply);
+
+        auto new_matmul = std::make_shared<ngraph::opset1::MatMul>(matmul->input_value(0), new_multiply, matmul->get_transpose_a(), true);
+        new_matmul->set_friendly_name(matmul->get_friendly_name());
+        new_ops.push_back(new_matmul);
+
+        ngraph::NodeVector old_ops{ weights, convert, scales, multiply, matmul };
+        if (with_zero_points) {
+            old_ops.push_back(pattern_map.at(zero_points_m).get_node_shared_ptr());
+            old_ops.push_back(pattern_map.at(subtract_m).get_node_shared_ptr());
+        }
+        ngraph::copy_runtime_info(old_ops, new_ops);
+        // the attribute is set after the runtime info is copied, otherwise it would be overwritten
+        ov::disable_constant_folding(new_convert);
+        ngraph::replace_node(matmul, new_matmul);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_m, "MarkWeightsDecompression");
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,34 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Keeps u8/i8 MatMul weights compressed so the FullyConnected node can dequantize them on the fly:
+ *
+ *   Constant(u8/i8)                                  Constant(u8/i8) [N, K]
+ *        |                                                |
+ *     Convert    Constant                              Convert    Constant [N, 1]
+ *        \       /                                        \       /
+ *        Subtract     Constant          =>                Subtract     Constant [N, 1]
+ *            \        /                                       \        /
+ *            Multiply                                         Multiply
+ *               |                                                |
+ *   MatMul(transpose_b = any)                        MatMul(transpose_b = true)
+ *
+ * Constant folding is disabled for the Convert, the weights are transposed to [N, K] and the zero points and
+ * scales are broadcast to per output channel constants, which is the layout the FullyConnected node consumes.
+ * The Subtract is optional.
+ */
+class MarkWeightsDecompression : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MarkWeightsDecompression();
+};
+
+}  // namespace MKLDNNPlugin
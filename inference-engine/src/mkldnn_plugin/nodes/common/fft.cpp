@@ -0,0 +1,340 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fft.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "ie_parallel.hpp"
+#include "cpu_memcpy.h"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+namespace {
+
+constexpr double PI = 3.141592653589793238462643;
+// Larger prime factors are computed by Bluestein's algorithm, the generic butterfly is O(radix^2)
+constexpr size_t maxGenericRadix = 13;
+// Number of sub-transforms processed by one task when a single transform is parallelized
+constexpr size_t parallelBlock = 64;
+
+inline size_t nextPowerOfTwo(size_t n) {
+    size_t result = 1;
+    while (result < n)
+        result <<= 1;
+    return result;
+}
+
+inline void complexMultiply(float lhsReal, float lhsImag, float rhsReal, float rhsImag, float& real, float& imag) {
+    real = lhsReal * rhsReal - lhsImag * rhsImag;
+    imag = lhsReal * rhsImag + lhsImag * rhsReal;
+}
+
+inline void storeTwiddled(float* y, size_t q, const float* w, float real, float imag) {
+    complexMultiply(real, imag, w[0], w[1], y[2 * q], y[2 * q + 1]);
+}
+
+/*
+    Butterflies of one Stockham stage for the sub-transform element 'i':
+        x[r] = src[q + stride * (i + r * m)], r = 0..radix-1
+        dst[q + stride * (radix * i + k)] = w^k * sum_r(x[r] * root^(r * k))
+    'x' and 'y' point to the first input and output of the element, 'inStep' and 'outStep' are distances in floats
+    between the inputs and the outputs, 'w' are the twiddles w^1, ..., w^(radix-1), 'sign' is the sign of the exponent
+    (the roots of unity of order 2 don't depend on it).
+    The loops over 'q' access contiguous memory.
+*/
+void butterfly2(const float* x, float* y, const float* w, size_t inStep, size_t outStep, size_t qBegin, size_t qEnd) {
+    const float* x0 = x;
+    const float* x1 = x + inStep;
+    float* y0 = y;
+    float* y1 = y + outStep;
+    for (size_t q = qBegin; q < qEnd; ++q) {
+        const float aReal = x0[2 * q], aImag = x0[2 * q + 1];
+        const float bReal = x1[2 * q], bImag = x1[2 * q + 1];
+        y0[2 * q] = aReal + bReal;
+        y0[2 * q + 1] = aImag + bImag;
+        storeTwiddled(y1, q, w, aReal - bReal, aImag - bImag);
+    }
+}
+
+void butterfly3(const float* x, float* y, const float* w, size_t inStep, size_t outStep, size_t qBegin, size_t qEnd, float sign) {
+    const float sinPart = sign * 0.86602540378443864676f;
+    for (size_t q = qBegin; q < qEnd; ++q) {
+        const float aReal = x[2 * q], aImag = x[2 * q + 1];
+        const float bReal = x[inStep + 2 * q], bImag = x[inStep + 2 * q + 1];
+        const float cReal = x[2 * inStep + 2 * q], cImag = x[2 * inStep + 2 * q + 1];
+
+        const float sumReal = bReal + cReal, sumImag = bImag + cImag;
+        const float midReal = aReal - 0.5f * sumReal, midImag = aImag - 0.5f * sumImag;
+        const float rotReal = -sinPart * (bImag - cImag), rotImag = sinPart * (bReal - cReal);
+
+        y[2 * q] = aReal + sumReal;
+        y[2 * q + 1] = aImag + sumImag;
+        storeTwiddled(y + outStep, q, w, midReal + rotReal, midImag + rotImag);
+        storeTwiddled(y + 2 * outStep, q, w + 2, midReal - rotReal, midImag - rotImag);
+    }
+}
+
+void butterfly4(const float* x, float* y, const float* w, size_t inStep, size_t outStep, size_t qBegin, size_t qEnd, float sign) {
+    for (size_t q = qBegin; q < qEnd; ++q) {
+        const float aReal = x[2 * q], aImag = x[2 * q + 1];
+        const float bReal = x[inStep + 2 * q], bImag = x[inStep + 2 * q + 1];
+        const float cReal = x[2 * inStep + 2 * q], cImag = x[2 * inStep + 2 * q + 1];
+        const float dReal = x[3 * inStep + 2 * q], dImag = x[3 * inStep + 2 * q + 1];
+
+        const float acSumReal = aReal + cReal, acSumImag = aImag + cImag;
+        const float acDiffReal = aReal - cReal, acDiffImag = aImag - cImag;
+        const float bdSumReal = bReal + dReal, bdSumImag = bImag + dImag;
+        // (b - d) multiplied by the root of unity of order 4: sign * i
+        const float bdRotReal = -sign * (bImag - dImag), bdRotImag = sign * (bReal - dReal);
+
+        y[2 * q] = acSumReal + bdSumReal;
+        y[2 * q + 1] = acSumImag + bdSumImag;
+        storeTwiddled(y + outStep, q, w, acDiffReal + bdRotReal, acDiffImag + bdRotImag);
+        storeTwiddled(y + 2 * outStep, q, w + 2, acSumReal - bdSumReal, acSumImag - bdSumImag);
+        storeTwiddled(y + 3 * outStep, q, w + 4, acDiffReal - bdRotReal, acDiffImag - bdRotImag);
+    }
+}
+
+void butterfly5(const float* x, float* y, const float* w, size_t inStep, size_t outStep, size_t qBegin, size_t qEnd, float sign) {
+    const float cos1 = 0.30901699437494742410f;
+    const float cos2 = -0.80901699437494742410f;
+    const float sin1 = sign * 0.95105651629515357212f;
+    const float sin2 = sign * 0.58778525229247312917f;
+    for (size_t q = qBegin; q < qEnd; ++q) {
+        const float aReal = x[2 * q], aImag = x[2 * q + 1];
+        const float bReal = x[inStep + 2 * q], bImag = x[inStep + 2 * q + 1];
+        const float cReal = x[2 * inStep + 2 * q], cImag = x[2 * inStep + 2 * q + 1];
+        const float dReal = x[3 * inStep + 2 * q], dImag = x[3 * inStep + 2 * q + 1];
+        const float eReal = x[4 * inStep + 2 * q], eImag = x[4 * inStep + 2 * q + 1];
+
+        const float beSumReal = bReal + eReal, beSumImag = bImag + eImag;
+        const float cdSumReal = cReal + dReal, cdSumImag = cImag + dImag;
+        const float beDiffReal = bReal - eReal, beDiffImag = bImag - eImag;
+        const float cdDiffReal = cReal - dReal, cdDiffImag = cImag - dImag;
+
+        const float mid1Real = aReal + cos1 * beSumReal + cos2 * cdSumReal;
+        const float mid1Imag = aImag + cos1 * beSumImag + cos2 * cdSumImag;
+        const float mid2Real = aReal + cos2 * beSumReal + cos1 * cdSumReal;
+        const float mid2Imag = aImag + cos2 * beSumImag + cos1 * cdSumImag;
+        // i * (sin1 * (b - e) + sin2 * (c - d)) and i * (sin2 * (b - e) - sin1 * (c - d))
+        const float rot1Real = -(sin1 * beDiffImag + sin2 * cdDiffImag), rot1Imag = sin1 * beDiffReal + sin2 * cdDiffReal;
+        const float rot2Real = -(sin2 * beDiffImag - sin1 * cdDiffImag), rot2Imag = sin2 * beDiffReal - sin1 * cdDiffReal;
+
+        y[2 * q] = aReal + beSumReal + cdSumReal;
+        y[2 * q + 1] = aImag + beSumImag + cdSumImag;
+        storeTwiddled(y + outStep, q, w, mid1Real + rot1Real, mid1Imag + rot1Imag);
+        storeTwiddled(y + 2 * outStep, q, w + 2, mid2Real + rot2Real, mid2Imag + rot2Imag);
+        storeTwiddled(y + 3 * outStep, q, w + 4, mid2Real - rot2Real, mid2Imag - rot2Imag);
+        storeTwiddled(y + 4 * outStep, q, w + 6, mid1Real - rot1Real, mid1Imag - rot1Imag);
+    }
+}
+
+void butterflyGeneric(const float* x, float* y, const float* w, const float* roots, size_t radix,
+                      size_t inStep, size_t outStep, size_t qBegin, size_t qEnd) {
+    for (size_t q = qBegin; q < qEnd; ++q) {
+        for (size_t k = 0; k < radix; ++k) {
+            float sumReal = 0.f;
+            float sumImag = 0.f;
+            for (size_t r = 0; r < radix; ++r) {
+                const float* root = roots + 2 * ((r * k) % radix);
+                float real, imag;
+                complexMultiply(x[r * inStep + 2 * q], x[r * inStep + 2 * q + 1], root[0], root[1], real, imag);
+                sumReal += real;
+                sumImag += imag;
+            }
+            if (k == 0) {
+                y[2 * q] = sumReal;
+                y[2 * q + 1] = sumImag;
+            } else {
+                storeTwiddled(y + k * outStep, q, w + 2 * (k - 1), sumReal, sumImag);
+            }
+        }
+    }
+}
+
+std::vector<size_t> factorize(size_t n) {
+    std::vector<size_t> factors;
+    while (n % 4 == 0) {
+        factors.push_back(4);
+        n /= 4;
+    }
+    for (size_t factor = 2; n > 1; ++factor) {
+        if (factor * factor > n)
+            factor = n;
+        while (n % factor == 0) {
+            factors.push_back(factor);
+            n /= factor;
+        }
+    }
+    return factors;
+}
+
+} // namespace
+
+FFTPlan::FFTPlan(size_t nComplex, bool inverse) : nComplex(nComplex), inverse(inverse) {
+    // the transforms of empty and single element signals are identities
+    if (nComplex <= 1)
+        return;
+
+    const double sign = inverse ? 1.0 : -1.0;
+    const auto factors = factorize(nComplex);
+    bool useBluestein = false;
+    for (auto factor : factors) {
+        useBluestein = useBluestein || factor > maxGenericRadix;
+    }
+
+    if (useBluestein) {
+        const size_t convolutionSize = nextPowerOfTwo(2 * nComplex - 1);
+        convolutionPlan = std::make_shared<FFTPlan>(convolutionSize, false);
+
+        chirp.resize(2 * nComplex);
+        for (size_t k = 0; k < nComplex; ++k) {
+            // k^2 is reduced modulo 2N to keep the precision of the angle for the large lengths
+            const uint64_t squared = (static_cast<uint64_t>(k) * k) % (2 * nComplex);
+            const double angle = sign * PI * static_cast<double>(squared) / static_cast<double>(nComplex);
+            chirp[2 * k] = static_cast<float>(std::cos(angle));
+            chirp[2 * k + 1] = static_cast<float>(std::sin(angle));
+        }
+
+        kernelSpectrum.assign(2 * convolutionSize, 0.f);
+        for (size_t k = 0; k < nComplex; ++k) {
+            const size_t indexes[] = {k, (convolutionSize - k) % convolutionSize};
+            for (auto index : indexes) {
+                kernelSpectrum[2 * index] = chirp[2 * k];
+                kernelSpectrum[2 * index + 1] = -chirp[2 * k + 1];
+            }
+        }
+        std::vector<float> scratch(convolutionPlan->bufferSize());
+        convolutionPlan->execute(kernelSpectrum.data(), scratch.data());
+        // the inverse transform of the convolution is not normalized
+        for (auto& value : kernelSpectrum) {
+            value /= static_cast<float>(convolutionSize);
+        }
+        return;
+    }
+
+    size_t length = nComplex;
+    size_t stride = 1;
+    for (auto radix : factors) {
+        const size_t subLength = length / radix;
+        Stage stage = {radix, length, stride, twiddles.size() / 2, genericRoots.size() / 2};
+        for (size_t i = 0; i < subLength; ++i) {
+            for (size_t k = 1; k < radix; ++k) {
+                const double angle = sign * 2.0 * PI * static_cast<double>(i * k) / static_cast<double>(length);
+                twiddles.push_back(static_cast<float>(std::cos(angle)));
+                twiddles.push_back(static_cast<float>(std::sin(angle)));
+            }
+        }
+        if (radix > 5) {
+            for (size_t r = 0; r < radix; ++r) {
+                const double angle = sign * 2.0 * PI * static_cast<double>(r) / static_cast<double>(radix);
+                genericRoots.push_back(static_cast<float>(std::cos(angle)));
+                genericRoots.push_back(static_cast<float>(std::sin(angle)));
+            }
+        }
+        stages.push_back(stage);
+        length = subLength;
+        stride *= radix;
+    }
+}
+
+size_t FFTPlan::bufferSize() const {
+    if (convolutionPlan)
+        return 2 * convolutionPlan->size() + convolutionPlan->bufferSize();
+    return 2 * nComplex;
+}
+
+void FFTPlan::execute(float* data, float* buffer, bool parallelize) const {
+    if (convolutionPlan) {
+        executeBluestein(data, buffer, parallelize);
+    } else {
+        executeStockham(data, buffer, parallelize);
+    }
+    if (inverse) {
+        scale(data);
+    }
+}
+
+void FFTPlan::executeStockham(float* data, float* buffer, bool parallelize) const {
+    float* src = data;
+    float* dst = buffer;
+    for (const auto& stage : stages) {
+        executeStage(stage, src, dst, parallelize);
+        std::swap(src, dst);
+    }
+    if (src != data) {
+        cpu_memcpy(data, src, 2 * nComplex * sizeof(float));
+    }
+}
+
+void FFTPlan::executeStage(const Stage& stage, const float* src, float* dst, bool parallelize) const {
+    const size_t radix = stage.radix;
+    const size_t stride = stage.stride;
+    const size_t subLength = stage.length / radix;
+    const size_t inStep = 2 * stride * subLength;
+    const size_t outStep = 2 * stride;
+    const float sign = inverse ? 1.f : -1.f;
+    const float* stageTwiddles = twiddles.data() + 2 * stage.twiddlesOffset;
+    const float* roots = genericRoots.data() + 2 * stage.rootsOffset;
+
+    auto body = [&](size_t i, size_t qBegin, size_t qEnd) {
+        const float* x = src + 2 * stride * i;
+        float* y = dst + 2 * stride * radix * i;
+        const float* w = stageTwiddles + 2 * (radix - 1) * i;
+        switch (radix) {
+            case 2: butterfly2(x, y, w, inStep, outStep, qBegin, qEnd); break;
+            case 3: butterfly3(x, y, w, inStep, outStep, qBegin, qEnd, sign); break;
+            case 4: butterfly4(x, y, w, inStep, outStep, qBegin, qEnd, sign); break;
+            case 5: butterfly5(x, y, w, inStep, outStep, qBegin, qEnd, sign); break;
+            default: butterflyGeneric(x, y, w, roots, radix, inStep, outStep, qBegin, qEnd); break;
+        }
+    };
+
+    if (parallelize) {
+        const size_t blocks = (stride + parallelBlock - 1) / parallelBlock;
+        parallel_for2d(subLength, blocks, [&](size_t i, size_t block) {
+            body(i, block * parallelBlock, std::min(stride, (block + 1) * parallelBlock));
+        });
+    } else {
+        for (size_t i = 0; i < subLength; ++i) {
+            body(i, 0, stride);
+        }
+    }
+}
+
+void FFTPlan::executeBluestein(float* data, float* buffer, bool parallelize) const {
+    const size_t convolutionSize = convolutionPlan->size();
+    float* sequence = buffer;
+    float* scratch = buffer + 2 * convolutionSize;
+
+    for (size_t k = 0; k < nComplex; ++k) {
+        complexMultiply(data[2 * k], data[2 * k + 1], chirp[2 * k], chirp[2 * k + 1], sequence[2 * k], sequence[2 * k + 1]);
+    }
+    std::fill(sequence + 2 * nComplex, sequence + 2 * convolutionSize, 0.f);
+    convolutionPlan->execute(sequence, scratch, parallelize);
+
+    // the inverse transform is computed by the forward one as conj(FFT(conj(x)))
+    for (size_t k = 0; k < convolutionSize; ++k) {
+        float real, imag;
+        complexMultiply(sequence[2 * k], sequence[2 * k + 1], kernelSpectrum[2 * k], kernelSpectrum[2 * k + 1], real, imag);
+        sequence[2 * k] = real;
+        sequence[2 * k + 1] = -imag;
+    }
+    convolutionPlan->execute(sequence, scratch, parallelize);
+
+    for (size_t k = 0; k < nComplex; ++k) {
+        complexMultiply(sequence[2 * k], -sequence[2 * k + 1], chirp[2 * k], chirp[2 * k + 1], data[2 * k], data[2 * k + 1]);
+    }
+}
+
+void FFTPlan::scale(float* data) const {
+    const float factor = 1.f / static_cast<float>(nComplex);
+    for (size_t k = 0; k < 2 * nComplex; ++k) {
+        data[k] *= factor;
+    }
+}
@@ -0,0 +1,72 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Precomputed FFT of a fixed length and direction over interleaved complex float data (re, im, re, im, ...).
+ * Lengths which are products of 2, 3, 4, 5 and other small primes are computed by the mixed-radix Stockham
+ * algorithm, the inner loops run over contiguous sub-transforms so they are vectorized by the compiler.
+ * Lengths with a large prime factor are computed by Bluestein's algorithm on top of a power of two transform.
+ * The inverse transform is scaled by 1/N.
+ */
+class FFTPlan {
+public:
+    using Ptr = std::shared_ptr<FFTPlan>;
+
+    FFTPlan(size_t nComplex, bool inverse);
+
+    size_t size() const {
+        return nComplex;
+    }
+
+    /**
+     * Number of floats of the scratch buffer required by execute().
+     */
+    size_t bufferSize() const;
+
+    /**
+     * Transforms nComplex complex values in place.
+     * @param data interleaved complex values
+     * @param buffer scratch of bufferSize() floats, must not overlap with data
+     * @param parallelize splits the butterflies of each stage between threads, worth for large single transforms only
+     */
+    void execute(float* data, float* buffer, bool parallelize = false) const;
+
+private:
+    struct Stage {
+        size_t radix;
+        // length of the sub-transforms and their count, the latter is also the distance between their elements
+        size_t length;
+        size_t stride;
+        size_t twiddlesOffset;
+        size_t rootsOffset;
+    };
+
+    void executeStockham(float* data, float* buffer, bool parallelize) const;
+    void executeBluestein(float* data, float* buffer, bool parallelize) const;
+    void executeStage(const Stage& stage, const float* src, float* dst, bool parallelize) const;
+    void scale(float* data) const;
+
+    size_t nComplex;
+    bool inverse;
+
+    std::vector<Stage> stages;
+    std::vector<float> twiddles;
+    // roots of unity of the stages with radix which has no specialized butterfly
+    std::vector<float> genericRoots;
+
+    // Bluestein's algorithm: x * chirp convolved with conj(chirp) via a power of two transform
+    std::shared_ptr<FFTPlan> convolutionPlan;
+    std::vector<float> chirp;
+    std::vector<float> kernelSpectrum;
+};
+
+}  // namespace MKLDNNPlugin
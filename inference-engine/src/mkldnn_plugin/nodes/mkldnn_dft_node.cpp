@@ -2,9 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <cmath>
+#include <numeric>
 #include <mkldnn_extension_utils.h>
 
 #include "mkldnn_dft_node.h"
@@ -106,42 +108,6 @@ void MKLDNNDFTNode::initSupportedPrimitiveDescriptors() {
 }
 
 namespace {
-inline float getRealFromComplexProd(float lhsReal, float lhsImag, float rhsReal, float rhsImag) {
-    return lhsReal * rhsReal - lhsImag * rhsImag;
-}
-
-inline float getImaginaryFromComplexProd(float lhsReal, float lhsImag, float rhsReal, float rhsImag) {
-    return lhsReal * rhsImag + lhsImag * rhsReal;
-}
-
-/*
-    Returns true while we can iterate
-    Specified axis is skipped in counters   
-*/
-inline bool nextIterationStep(std::vector<size_t>& counters, const std::vector<size_t>& iterationRange, size_t axis) {
-    auto itCounter = counters.rbegin();
-    auto itWork = iterationRange.rbegin();
-
-    while (itCounter != counters.rend() && itWork != iterationRange.rend()) {
-        if (std::distance(itCounter, counters.rend()) == axis + 1) {
-            ++itCounter;
-            ++itWork;
-            continue;
-        }
-        *itCounter = (*itCounter + 1) % *itWork;
-        if (*itCounter != 0) {
-            return true;
-        }
-        ++itCounter;
-        ++itWork;
-    }
-    return false;
-}
-
-inline bool IsPowerOfTwo(size_t n) {
-    return (n != 0) && (n & (n - 1)) == 0;
-}
-
 inline bool copyStep(std::vector<size_t>& counters, const std::vector<size_t>& iterationRange) {
     auto itCounter = counters.rbegin();
     auto itWork = iterationRange.rbegin();
@@ -165,27 +131,19 @@ size_t calculateOffsetFromStrides(const std::vector<size_t>& coords, const std::
     return offset;
 }
 
-void gatherToBufferND(float* buffer, const float* data, size_t axis, const std::vector<size_t>& dimIndexes,
-                                     const std::vector<size_t>& shape, const std::vector<size_t>& strides) {
-    size_t numberOfComplex = shape[axis];
-    size_t offset = calculateOffsetFromStrides(dimIndexes, strides);
-
+void gatherToBuffer(float* buffer, const float* data, size_t numberOfComplex, size_t stride) {
     for (size_t bufferIndex = 0; bufferIndex < 2 * numberOfComplex; bufferIndex += 2) {
-        buffer[bufferIndex] = data[offset];
-        buffer[bufferIndex + 1] = data[offset + 1];
-        offset += strides[axis];
+        buffer[bufferIndex] = data[0];
+        buffer[bufferIndex + 1] = data[1];
+        data += stride;
     }
 }
 
-void applyBufferND(const float* buffer, float* output, size_t axis, const std::vector<size_t>& dimIndexes,
-                                  const std::vector<size_t>& shape, const std::vector<size_t>& strides) {
-    size_t numberOfComplex = shape[axis];
-    size_t offset = calculateOffsetFromStrides(dimIndexes, strides);
-
+void applyBuffer(const float* buffer, float* output, size_t numberOfComplex, size_t stride) {
     for (size_t bufferIndex = 0; bufferIndex < 2 * numberOfComplex; bufferIndex += 2) {
-        output[offset] = buffer[bufferIndex];
-        output[offset + 1] = buffer[bufferIndex + 1];
-        offset += strides[axis];
+        output[0] = buffer[bufferIndex];
+        output[1] = buffer[bufferIndex + 1];
+        output += stride;
     }
 }
 
@@ -194,6 +152,10 @@ void copyDataToOutputWithSignalSize(const float* input, const std::vector<size_t
     auto totalInput = std::accumulate(inputShape.begin(), inputShape.end(), 1, std::multiplies<size_t>());
     auto totalOutput = std::accumulate(outputShape.begin(), outputShape.end(), 1, std::multiplies<size_t>());
     std::fill_n(output, totalOutput, 0);
+    // an empty signal is padded with zeros only
+    if (totalInput == 0)
+        return;
+
     size_t lastChangedDim = 0;
     for (size_t index = inputShape.size() - 1; index > 0; --index) {
         if (inputShape[index] != outputShape[index]) {
@@ -238,12 +200,11 @@ void MKLDNNDFTNode::execute(mkldnn::stream strm) {
     std::sort(axes.begin(), axes.end());
 
     outputShape = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
+    if (std::find(outputShape.begin(), outputShape.end(), 0) != outputShape.end())
+        return;
+
     for (size_t axis : axes) {
-        size_t nComplex = outputShape[axis];
-        // FFT uses different twiddle factors
-        if (twiddlesMap.find(nComplex) == twiddlesMap.end() && !IsPowerOfTwo(nComplex)) {
-            twiddlesMap[nComplex] = generateTwiddles(nComplex);
-        }
+        getPlan(outputShape[axis]);
     }
 
     auto inputDataEdge = getParentEdgeAt(DATA_INDEX);
@@ -260,158 +221,69 @@ void MKLDNNDFTNode::execute(mkldnn::stream strm) {
         cpu_memcpy(output, input, totalElements * sizeof(float));
     }
 
-    // 1d case
-    if (inputDataEdge->getMemory().GetShape().getRank() == 2) {
-        size_t nComplex = outputShape[0];
-        if (IsPowerOfTwo(nComplex)) {
-            fft(output, nComplex * 2, true);
-        } else {
-            naiveDFT(output, nComplex * 2);
-        }
-    } else {
-        dftNd(output, outputStrides);
-    }
+    dftNd(output, outputStrides);
 }
 
-void MKLDNNDFTNode::dftNd(float* output, const std::vector<size_t>& outputStrides) const {
-    const std::vector<size_t> iterationRange(outputShape.begin(), outputShape.end() - 1);
-    const size_t lastDimIndex = iterationRange.size() - 1;
-    for (size_t axisIndex = 0; axisIndex < axes.size(); ++axisIndex) {
-        const size_t currentAxis = axes[axisIndex];
-        const size_t outputComplexLen = outputShape[currentAxis];
-        const size_t outputLen = outputComplexLen * 2;
-
-        std::vector<size_t> iterationCounter(iterationRange.size(), 0);
-        if (IsPowerOfTwo(outputComplexLen)) {
-            size_t parallelDimIndex = lastDimIndex == currentAxis ? lastDimIndex - 1 : lastDimIndex;
-            do {
-                parallel_for(iterationRange[parallelDimIndex], [&](size_t dim) {
-                    std::vector<float> gatheredData(outputLen);
-                    auto parallelIterationCounter = iterationCounter;
-                    parallelIterationCounter[parallelDimIndex] = dim;
-                    gatherToBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
-                    fft(gatheredData.data(), outputLen);
-                    applyBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
-                });
-                iterationCounter[parallelDimIndex] = iterationRange[parallelDimIndex] - 1;
-            } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
-        } else {
-            std::vector<float> gatheredData(outputLen);
-            do {
-                gatherToBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-                naiveDFT(gatheredData.data(), outputLen);
-                applyBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-            } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
-        }
+const FFTPlan& MKLDNNDFTNode::getPlan(size_t nComplex) {
+    auto& plan = plans[nComplex];
+    if (!plan) {
+        plan = std::make_shared<FFTPlan>(nComplex, inverse);
     }
+    return *plan;
 }
 
-/* Cooley Tukey implementation of FFT */
-void MKLDNNDFTNode::fft(float* data, int64_t dataLength, bool parallelize) const {
-    static int cacheSizeL3 = utils::get_cache_size(3, false);
-    static int elementsPerCacheLine = cacheSizeL3 / sizeof(float);
-    std::vector<float> bufferVector(dataLength * 2, 0);
-    float* buffer = bufferVector.data();
-    cpu_memcpy(buffer, data, dataLength * sizeof(float));
-
-    size_t nComplex = dataLength / 2;
-    float* inBufferStart = buffer + dataLength;
-    float* outBufferStart = buffer;
-
-    auto blockIteration = [&] (const size_t block, const size_t blockSize, const size_t nextIterationBlockSize, const float anglePart) {
-        float* curInpBufferPtr = inBufferStart + block * blockSize;
-        float* curOutBufferPtr = outBufferStart + block * nextIterationBlockSize;
-
-        const float angle = anglePart * block;
-        const float twiddleReal = std::cos(angle);
-        const float twiddleImag = -std::sin(angle);
-        for (int64_t pair = 0; pair < blockSize / 2; pair += 2) {
-            const float evenReal = curInpBufferPtr[pair];
-            const float evenImag = curInpBufferPtr[pair + 1];
-
-            const float oddReal = curInpBufferPtr[(blockSize / 2 + pair)];
-            const float oddImag = curInpBufferPtr[(blockSize / 2 + pair) + 1];
-
-            const float twiddledOddReal = getRealFromComplexProd(twiddleReal, twiddleImag, oddReal, oddImag);
-            const float twiddledOddImag = getImaginaryFromComplexProd(twiddleReal, twiddleImag, oddReal, oddImag);
-
-            curOutBufferPtr[pair] = evenReal + twiddledOddReal;
-            curOutBufferPtr[pair + 1] = evenImag + twiddledOddImag;
-
-            curOutBufferPtr[nComplex + pair] = evenReal - twiddledOddReal;
-            curOutBufferPtr[nComplex + pair + 1] = evenImag - twiddledOddImag;
-        }
-    };
-
-    for (int64_t numBlocks = 1; numBlocks < nComplex; numBlocks *= 2) {
-        const float anglePart = PI / numBlocks * (inverse ? -1 : 1);
-
-        std::swap(inBufferStart, outBufferStart);
-        const int64_t blockSize = dataLength / numBlocks;
-        const int64_t nextIterationBlockSize = blockSize / 2;
-        if (parallelize && blockSize >= 4 * elementsPerCacheLine) {
-            parallel_for(numBlocks, [&] (const size_t block) {
-                blockIteration(block, blockSize, nextIterationBlockSize, anglePart);
-            });
-        } else {
-            for (int64_t block = 0; block < numBlocks; ++block) {
-                blockIteration(block, blockSize, nextIterationBlockSize, anglePart);
+void MKLDNNDFTNode::dftNd(float* output, const std::vector<size_t>& outputStrides) const {
+    // the last dimension holds the real and the imaginary parts
+    const std::vector<size_t> iterationRange(outputShape.begin(), outputShape.end() - 1);
+    for (size_t currentAxis : axes) {
+        const auto& plan = *plans.at(outputShape[currentAxis]);
+        const size_t axisStride = outputStrides[currentAxis];
+        const bool isDense = axisStride == 2;
+
+        // every transform along the axis starts at its zero coordinate, they are batched over the other dimensions
+        std::vector<size_t> batchRange = iterationRange;
+        batchRange[currentAxis] = 1;
+        const size_t batchSize = std::accumulate(batchRange.begin(), batchRange.end(), size_t(1), std::multiplies<size_t>());
+        auto getOffset = [&](size_t index) {
+            size_t offset = 0;
+            for (size_t dim = batchRange.size(); dim-- > 0;) {
+                offset += (index % batchRange[dim]) * outputStrides[dim];
+                index /= batchRange[dim];
             }
+            return offset;
+        };
+
+        if (batchSize == 1) {
+            std::vector<float> buffer(plan.bufferSize() + (isDense ? 0 : 2 * plan.size()));
+            float* transformData = isDense ? output : buffer.data() + plan.bufferSize();
+            if (!isDense)
+                gatherToBuffer(transformData, output, plan.size(), axisStride);
+            plan.execute(transformData, buffer.data(), true);
+            if (!isDense)
+                applyBuffer(transformData, output, plan.size(), axisStride);
+            continue;
         }
-    }
 
-    for (int64_t k = 0; k < dataLength; k++) {
-        if (inverse) {
-            outBufferStart[k] /= nComplex;
-        }
-        data[k] = outBufferStart[k];
-    }
-}
-
-void MKLDNNDFTNode::naiveDFT(float* data, size_t dataLength) const {
-    std::vector<float> outputBuffer(dataLength);
-    const size_t nComplex = dataLength / 2;
-    const auto& twiddles = twiddlesMap.find(nComplex)->second;
-
-    parallel_for(nComplex, [&](size_t k) {
-        float sumReal = 0.0f;
-        float sumImag = 0.0f;
-        for (size_t n = 0; n < nComplex; ++n) {
-            auto it = twiddles[k * nComplex + n];
-            float complexReal = it.first;
-            float complexImag = it.second;
-
-            if (inverse) {
-                complexImag *= -1; // conjugate
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(batchSize, nthr, ithr, start, end);
+            if (start >= end)
+                return;
+
+            std::vector<float> buffer(plan.bufferSize() + (isDense ? 0 : 2 * plan.size()));
+            float* gatheredData = buffer.data() + plan.bufferSize();
+            for (size_t index = start; index < end; ++index) {
+                float* transformStart = output + getOffset(index);
+                if (isDense) {
+                    plan.execute(transformStart, buffer.data());
+                } else {
+                    gatherToBuffer(gatheredData, transformStart, plan.size(), axisStride);
+                    plan.execute(gatheredData, buffer.data());
+                    applyBuffer(gatheredData, transformStart, plan.size(), axisStride);
+                }
             }
-            float complexProdReal = getRealFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
-            float complexProdImag = getImaginaryFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
-
-            sumReal += complexProdReal;
-            sumImag += complexProdImag;
-        }
-
-        if (inverse) {
-            sumReal /= nComplex;
-            sumImag /= nComplex;
-        }
-        outputBuffer[k * 2] = sumReal;
-        outputBuffer[k * 2 + 1] = sumImag;
-    });
-    cpu_memcpy(data, outputBuffer.data(), dataLength * sizeof(float));
-}
-
-std::vector<std::pair<float, float>> MKLDNNDFTNode::generateTwiddles(size_t n_complex) const {
-    std::vector<std::pair<float, float>> twiddles(n_complex * n_complex);
-    parallel_for(n_complex, [&](const size_t k) {
-        for (size_t n = 0; n < n_complex; ++n) {
-            float phase =  2.0f * PI * static_cast<float>(n * k) / static_cast<float>(n_complex);
-            auto complexReal = std::cos(phase);
-            auto complexImag = -std::sin(phase);
-            twiddles[k * n_complex + n] = std::make_pair(complexReal, complexImag);
-        }
-    });
-    return twiddles;
+        });
+    }
 }
 
 bool MKLDNNDFTNode::created() const {
@@ -7,6 +7,7 @@
 #include <ie_common.h>
 #include <mkldnn_node.h>
 #include <string>
+#include "common/fft.h"
 
 namespace MKLDNNPlugin {
 
@@ -25,12 +26,10 @@ public:
 
 private:
     void dftNd(float* output, const std::vector<size_t>& outputStrides) const;
-    void fft(float* data, int64_t dataLength, bool parallelize = false) const;
-    void naiveDFT(float* data, size_t dataLength) const;
+    const FFTPlan& getPlan(size_t nComplex);
 
-    std::vector<std::pair<float, float>> generateTwiddles(size_t n_complex) const;
-
-    std::unordered_map<size_t, std::vector<std::pair<float, float>>> twiddlesMap;
+    // plans are cached per transform length, the direction is fixed for the node
+    std::unordered_map<size_t, FFTPlan::Ptr> plans;
     std::vector<int32_t> axes;
     std::vector<size_t> outputShape;
     std::vector<size_t> inputShape;
@@ -38,7 +37,6 @@ private:
     const size_t DATA_INDEX = 0;
     const size_t AXES_INDEX = 1;
     const size_t SIGNAL_SIZE_INDEX = 2;
-    static constexpr float PI = 3.141592653589793238462643f;
     bool inverse;
 };
 
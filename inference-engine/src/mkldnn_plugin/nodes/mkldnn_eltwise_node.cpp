@@ -72,6 +72,76 @@ struct EltwiseEmitter {
     }
 };
 
+// Eltwise operation (the node itself or fused one) as it is seen by the jit kernel
+struct EltwiseOpKey {
+    Algorithm algorithm;
+    mkldnn::algorithm mkldnnAlgorithm;
+    float alpha;
+    float beta;
+    float gamma;
+
+    bool operator==(const EltwiseOpKey& rhs) const {
+        return algorithm == rhs.algorithm && mkldnnAlgorithm == rhs.mkldnnAlgorithm &&
+               alpha == rhs.alpha && beta == rhs.beta && gamma == rhs.gamma;
+    }
+};
+
+// Describes everything executor creation depends on, so executors can be reused for the same shapes
+struct EltwiseKey {
+    jit_eltwise_params jep;
+    std::vector<EltwiseOpKey> ops;
+    size_t fullWorkAmount;
+    size_t schedulerWorkAmount;
+    size_t batchDimIdx;
+    bool useJit;
+
+    size_t hash() const {
+        size_t seed = 0;
+        seed = hash_combine(seed, jep.inputs_number);
+        seed = hash_combine(seed, jep.input_size);
+        for (size_t i = 0; i < jep.inputs_number; i++) {
+            seed = hash_combine(seed, static_cast<int>(jep.src_prc[i]));
+            seed = hash_combine(seed, jep.src_size[i]);
+            for (auto offset : jep.src_offsets[i])
+                seed = hash_combine(seed, offset);
+        }
+        seed = hash_combine(seed, static_cast<int>(jep.dst_prc));
+        for (auto dim : jep.dims)
+            seed = hash_combine(seed, dim);
+        for (auto offset : jep.dst_offsets)
+            seed = hash_combine(seed, offset);
+        seed = hash_combine(seed, jep.dst_size);
+        seed = hash_combine(seed, jep.oc_size);
+        seed = hash_combine(seed, jep.work_amount);
+        for (const auto& op : ops) {
+            seed = hash_combine(seed, static_cast<int>(op.algorithm));
+            seed = hash_combine(seed, static_cast<int>(op.mkldnnAlgorithm));
+            seed = hash_combine(seed, op.alpha);
+            seed = hash_combine(seed, op.beta);
+            seed = hash_combine(seed, op.gamma);
+        }
+        seed = hash_combine(seed, fullWorkAmount);
+        seed = hash_combine(seed, schedulerWorkAmount);
+        seed = hash_combine(seed, batchDimIdx);
+        seed = hash_combine(seed, useJit);
+        return seed;
+    }
+
+    bool operator==(const EltwiseKey& rhs) const {
+        if (jep.inputs_number != rhs.jep.inputs_number || jep.input_size != rhs.jep.input_size)
+            return false;
+        for (size_t i = 0; i < jep.inputs_number; i++) {
+            if (jep.src_prc[i] != rhs.jep.src_prc[i] || jep.src_size[i] != rhs.jep.src_size[i] ||
+                jep.src_offsets[i] != rhs.jep.src_offsets[i])
+                return false;
+        }
+        return jep.dst_prc == rhs.jep.dst_prc && jep.dims == rhs.jep.dims && jep.dst_offsets == rhs.jep.dst_offsets &&
+               jep.oc_offsets == rhs.jep.oc_offsets && jep.dst_size == rhs.jep.dst_size && jep.oc_size == rhs.jep.oc_size &&
+               jep.work_amount == rhs.jep.work_amount && ops == rhs.ops && fullWorkAmount == rhs.fullWorkAmount &&
+               schedulerWorkAmount == rhs.schedulerWorkAmount && batchDimIdx == rhs.batchDimIdx && useJit == rhs.useJit;
+    }
+};
+
 }   // namespace
 
 template <cpu_isa_t isa>
@@ -1456,11 +1526,30 @@ void MKLDNNEltwiseNode::prepareParams() {
     std::transform(jep.oc_offsets.begin(), jep.oc_offsets.end(), jep.oc_offsets.begin(),
                    [](size_t& offset) { return offset * sizeof(float);});
 
-    if (canUseOptimizedImpl) {
-        execPtr = std::make_shared<EltwiseJitExecutor>(jep, *this, schedulerWorkAmount, batchDimIdx);
-    } else {
-        execPtr = std::make_shared<EltwiseRefExecutor>(jep, fullWorkAmount, batchDimIdx);
+    auto builder = [this](const EltwiseKey& key) -> executorPtr {
+        if (key.useJit) {
+            return std::make_shared<EltwiseJitExecutor>(key.jep, *this, key.schedulerWorkAmount, key.batchDimIdx);
+        } else {
+            return std::make_shared<EltwiseRefExecutor>(key.jep, key.fullWorkAmount, key.batchDimIdx);
+        }
+    };
+
+    EltwiseKey key = {jep, {}, fullWorkAmount, schedulerWorkAmount, batchDimIdx, canUseOptimizedImpl};
+    // The jit kernel embeds FakeQuantize data pointers of the particular node, such executors can't be shared
+    if (!rtParamsCache || isFusedWith(FakeQuantize)) {
+        execPtr = builder(key);
+        return;
+    }
+
+    key.ops.push_back({getAlgorithm(), getMKLDNNAlgorithm(), getAlpha(), getBeta(), getGamma()});
+    for (const auto& fusedNode : fusedWith) {
+        const auto* eltwiseNode = dynamic_cast<const MKLDNNEltwiseNode*>(fusedNode.get());
+        if (eltwiseNode != nullptr) {
+            key.ops.push_back({eltwiseNode->getAlgorithm(), eltwiseNode->getMKLDNNAlgorithm(),
+                               eltwiseNode->getAlpha(), eltwiseNode->getBeta(), eltwiseNode->getGamma()});
+        }
     }
+    execPtr = rtParamsCache->getOrCreate<EltwiseKey, executorPtr>(key, builder);
 }
 
 bool MKLDNNEltwiseNode::needPrepareParams() const {
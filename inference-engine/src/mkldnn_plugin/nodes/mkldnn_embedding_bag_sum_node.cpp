@@ -10,9 +10,216 @@
 #include "mkldnn_embedding_bag_sum_node.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include <cpu/x64/jit_generator.hpp>
+#include <emitters/jit_bf16_emitters.hpp>
+#include "utils/general_utils.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+
+#define GET_OFF(field) offsetof(jit_emb_bag_call_args, field)
+
+/*
+    Sums the rows of the embedding table selected by the indices of one bag, optionally multiplied by the per sample
+    weights. The row is split into blocks of up to 'unroll' vectors which are accumulated in registers over all the
+    indices of the bag, the same block of the next row is prefetched while the current one is accumulated.
+    BF16 rows are accumulated in FP32 and rounded once on store.
+*/
+template <cpu_isa_t isa>
+struct jit_uni_emb_bag_sum_kernel_f32 : public jit_uni_emb_bag_sum_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_emb_bag_sum_kernel_f32)
+
+    explicit jit_uni_emb_bag_sum_kernel_f32(jit_emb_bag_config_params jcp) : jit_uni_emb_bag_sum_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        if (jcp_.data_prc == Precision::BF16 && !mayiuse(avx512_core_bf16))
+            emu_vcvtneps2bf16.reset(new jit_emu_vcvtneps2bf16(this, isa, nullptr));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_indices_num, ptr[reg_params + GET_OFF(indices_num)]);
+
+        const size_t tail = jcp_.emb_depth % simd_w;
+        if (tail != 0)
+            prepare_tail_mask(tail);
+
+        const size_t vectors_num = div_up(jcp_.emb_depth, simd_w);
+        for (size_t vector = 0; vector < vectors_num; vector += unroll) {
+            const size_t block_vectors = std::min(unroll, vectors_num - vector);
+            const bool is_tail_block = tail != 0 && vector + block_vectors == vectors_num;
+            accumulate_block(vector * simd_w, block_vectors, is_tail_block);
+        }
+
+        this->postamble();
+
+        if (emu_vcvtneps2bf16)
+            emu_vcvtneps2bf16->emit_data();
+
+        if (isa == avx2 && tail != 0) {
+            align(32);
+            L(l_tail_mask);
+            for (size_t i = 0; i < simd_w; i++)
+                dd(i < tail ? 0xFFFFFFFF : 0);
+        }
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const size_t vlen = cpu_isa_traits<isa>::vlen;
+    const size_t simd_w = vlen / sizeof(float);
+    const size_t data_size = jcp_.data_prc.size();
+    // number of accumulators, the rest of the registers hold the loaded row, the weight and the tail mask
+    const size_t unroll = 8;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_indices = r9;
+    Xbyak::Reg64 reg_weights = r10;
+    Xbyak::Reg64 reg_dst = r11;
+    Xbyak::Reg64 reg_indices_num = r12;
+    Xbyak::Reg64 reg_index_ptr = r13;
+    Xbyak::Reg64 reg_weight_ptr = r14;
+    Xbyak::Reg64 reg_work_amount = r15;
+    Xbyak::Reg64 reg_row = rax;
+    Xbyak::Reg64 reg_next_row = rbx;
+    Xbyak::Reg64 reg_aux = rdx;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_src = Vmm(unroll);
+    Vmm vmm_weight = Vmm(unroll + 1);
+    Xbyak::Xmm xmm_weight = Xbyak::Xmm(unroll + 1);
+    Vmm vmm_tail_mask = Vmm(unroll + 2);
+    const Xbyak::Opmask k_tail_mask = Xbyak::Opmask(1);
+
+    Xbyak::Label l_tail_mask;
+
+    std::unique_ptr<jit_emu_vcvtneps2bf16> emu_vcvtneps2bf16;
+
+    void prepare_tail_mask(size_t tail) {
+        if (isa == avx512_common) {
+            mov(reg_aux.cvt32(), (1 << tail) - 1);
+            kmovw(k_tail_mask, reg_aux.cvt32());
+        } else {
+            mov(reg_aux, l_tail_mask);
+            uni_vmovups(vmm_tail_mask, ptr[reg_aux]);
+        }
+    }
+
+    void accumulate_block(size_t first_element, size_t block_vectors, bool is_tail_block) {
+        const size_t row_size = jcp_.emb_depth * data_size;
+        const size_t block_offset = first_element * data_size;
+        const size_t block_size = std::min(block_vectors * simd_w, jcp_.emb_depth - first_element) * data_size;
+        auto is_tail = [&](size_t i) { return is_tail_block && i == block_vectors - 1; };
+
+        for (size_t i = 0; i < block_vectors; i++)
+            uni_vpxor(Vmm(i), Vmm(i), Vmm(i));
+
+        mov(reg_index_ptr, reg_indices);
+        mov(reg_weight_ptr, reg_weights);
+        mov(reg_work_amount, reg_indices_num);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label no_prefetch_label;
+        Xbyak::Label exit_label;
+
+        L(loop_label); {
+            cmp(reg_work_amount, 0);
+            je(exit_label, T_NEAR);
+
+            movsxd(reg_row, dword[reg_index_ptr]);
+            imul(reg_row, reg_row, static_cast<int>(row_size));
+            add(reg_row, reg_src);
+
+            cmp(reg_work_amount, 1);
+            je(no_prefetch_label, T_NEAR);
+            movsxd(reg_next_row, dword[reg_index_ptr + sizeof(int)]);
+            imul(reg_next_row, reg_next_row, static_cast<int>(row_size));
+            add(reg_next_row, reg_src);
+            for (size_t offset = 0; offset < block_size; offset += 64)
+                prefetcht0(ptr[reg_next_row + block_offset + offset]);
+            L(no_prefetch_label);
+
+            if (jcp_.with_weights)
+                load_weight();
+
+            for (size_t i = 0; i < block_vectors; i++) {
+                load_vector(vmm_src, ptr[reg_row + block_offset + i * simd_w * data_size], is_tail(i));
+                if (jcp_.with_weights)
+                    uni_vfmadd231ps(Vmm(i), vmm_src, vmm_weight);
+                else
+                    uni_vaddps(Vmm(i), Vmm(i), vmm_src);
+            }
+
+            add(reg_index_ptr, sizeof(int));
+            if (jcp_.with_weights)
+                add(reg_weight_ptr, data_size);
+            sub(reg_work_amount, 1);
+            jmp(loop_label, T_NEAR);
+        }
+        L(exit_label);
+
+        for (size_t i = 0; i < block_vectors; i++)
+            store_vector(ptr[reg_dst + block_offset + i * simd_w * data_size], Vmm(i), is_tail(i));
+    }
+
+    inline void load_weight() {
+        if (jcp_.data_prc == Precision::BF16) {
+            movzx(reg_aux.cvt32(), word[reg_weight_ptr]);
+            shl(reg_aux.cvt32(), 16);
+            vmovd(xmm_weight, reg_aux.cvt32());
+            vbroadcastss(vmm_weight, xmm_weight);
+        } else {
+            uni_vbroadcastss(vmm_weight, ptr[reg_weight_ptr]);
+        }
+    }
+
+    inline void load_vector(Vmm vmm_dst, const Xbyak::Address &op, bool is_tail) {
+        if (jcp_.data_prc == Precision::BF16) {
+            if (is_tail)
+                vpmovzxwd(vmm_dst | k_tail_mask | T_z, op);
+            else
+                vpmovzxwd(vmm_dst, op);
+            uni_vpslld(vmm_dst, vmm_dst, 16);
+        } else if (!is_tail) {
+            uni_vmovups(vmm_dst, op);
+        } else if (isa == avx512_common) {
+            vmovups(vmm_dst | k_tail_mask | T_z, op);
+        } else {
+            vmaskmovps(vmm_dst, vmm_tail_mask, op);
+        }
+    }
+
+    inline void store_vector(const Xbyak::Address &op, Vmm vmm_src, bool is_tail) {
+        if (jcp_.data_prc == Precision::BF16) {
+            Xbyak::Ymm ymm_src = Xbyak::Ymm(vmm_src.getIdx());
+            if (mayiuse(avx512_core_bf16))
+                vcvtneps2bf16(ymm_src, vmm_src);
+            else
+                emu_vcvtneps2bf16->emit_code({static_cast<size_t>(vmm_src.getIdx())}, {static_cast<size_t>(ymm_src.getIdx())});
+            if (is_tail)
+                vmovdqu16(op, ymm_src | k_tail_mask);
+            else
+                vmovdqu16(op, ymm_src);
+        } else if (!is_tail) {
+            uni_vmovups(op, vmm_src);
+        } else if (isa == avx512_common) {
+            vmovups(op, vmm_src | k_tail_mask);
+        } else {
+            vmaskmovps(op, vmm_tail_mask, vmm_src);
+        }
+    }
+};
 
 MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
             const std::shared_ptr<ngraph::Node>& op,
@@ -42,6 +249,78 @@ MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
     }
 }
 
+bool MKLDNNEmbeddingBagSumNode::isBf16Supported() {
+    return mayiuse(avx512_core);
+}
+
+void MKLDNNEmbeddingBagSumNode::createKernel(const InferenceEngine::Precision& dataPrecision) {
+    if (embBagKernel || !one_of(dataPrecision, Precision::FP32, Precision::BF16))
+        return;
+
+    jit_emb_bag_config_params jcp;
+    jcp.emb_depth = _embDepth;
+    jcp.data_prc = dataPrecision;
+    jcp.with_weights = _withWeights;
+
+    if (mayiuse(avx512_common)) {
+        embBagKernel.reset(new jit_uni_emb_bag_sum_kernel_f32<avx512_common>(jcp));
+    } else if (mayiuse(avx2) && dataPrecision == Precision::FP32) {
+        embBagKernel.reset(new jit_uni_emb_bag_sum_kernel_f32<avx2>(jcp));
+    }
+
+    if (embBagKernel)
+        embBagKernel->create_ker();
+}
+
+void MKLDNNEmbeddingBagSumNode::processDataJit(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
+                                               const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    const size_t outputBagsNum = outDataDims[0];
+    const size_t dataSize = embBagKernel->jcp_.data_prc.size();
+    // the weight of the default index which is used for the empty bags of the tables with per sample weights
+    static const float fp32One = 1.f;
+    static const uint16_t bf16One = 0x3f80;
+    const void* defaultWeight = embBagKernel->jcp_.data_prc == Precision::BF16 ? static_cast<const void*>(&bf16One) : &fp32One;
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(outputBagsNum, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0lu;
+        bool withWeights = _withWeights;
+
+        for (size_t obi = start; obi < end; obi++) {
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+
+            jit_emb_bag_call_args args;
+            args.src = srcData;
+            args.indices = indices;
+            args.indices_num = indices != nullptr ? indicesSize : 0lu;
+            args.dst = dstData + obi * _embDepth * dataSize;
+            args.weights = nullptr;
+            if (_withWeights)
+                args.weights = withWeights ? weightsData + weightsIdx * dataSize : defaultWeight;
+
+            for (size_t inIdx = 0lu; inIdx < args.indices_num; inIdx++) {
+                if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                }
+            }
+
+            (*embBagKernel)(&args);
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 template<typename T>
 void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsData, T* dstData,
                                             const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims) {
@@ -116,6 +395,10 @@ void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsDa
 
 void MKLDNNEmbeddingBagSumNode::execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData, const InferenceEngine::Precision &srcPrc,
                                         const InferenceEngine::SizeVector& inDims, const InferenceEngine::SizeVector& outDims) {
+    if (embBagKernel) {
+        return processDataJit(srcData, weightsData, dstData, inDims, outDims);
+    }
+
     switch (srcPrc) {
         case Precision::FP32: {
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
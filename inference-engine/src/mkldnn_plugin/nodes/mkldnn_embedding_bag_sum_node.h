@@ -12,6 +12,36 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_emb_bag_config_params {
+    size_t emb_depth;
+    InferenceEngine::Precision data_prc;
+    bool with_weights;
+};
+
+struct jit_emb_bag_call_args {
+    const void* src;
+    const int* indices;
+    const void* weights;
+    void* dst;
+    size_t indices_num;
+};
+
+struct jit_uni_emb_bag_sum_kernel {
+    void (*ker_)(const jit_emb_bag_call_args *);
+
+    void operator()(const jit_emb_bag_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_emb_bag_sum_kernel(jit_emb_bag_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_emb_bag_sum_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_emb_bag_config_params jcp_;
+};
+
 class MKLDNNEmbeddingBagSumNode {
 public:
     MKLDNNEmbeddingBagSumNode(
@@ -27,6 +57,10 @@ public:
     ~MKLDNNEmbeddingBagSumNode() = default;
 
 protected:
+    // BF16 tables are accumulated in FP32 by the JIT kernel, otherwise they are converted to FP32
+    static bool isBf16Supported();
+    void createKernel(const InferenceEngine::Precision& dataPrecision);
+
     virtual void initFromInputs() = 0;
     virtual void getIndices(
             int embIndex,
@@ -38,6 +72,8 @@ protected:
     template<typename T>
     void processData(const T* srcData, const T* weightsData, T* dstData,
                      const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
+    void processDataJit(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData,
+                        const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -47,6 +83,8 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    std::shared_ptr<jit_uni_emb_bag_sum_kernel> embBagKernel;
 };
 
 }  // namespace MKLDNNPlugin
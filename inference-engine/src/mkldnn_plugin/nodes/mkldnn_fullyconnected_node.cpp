@@ -8,9 +8,14 @@
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <string>
+#include <numeric>
+#include <functional>
 #include <vector>
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
+#include <mkldnn_types.h>
+#include <cpu/x64/jit_generator.hpp>
+#include "ie_parallel.hpp"
 #include "utils/general_utils.h"
 #include <memory_desc/cpu_memory_desc_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
@@ -18,6 +23,99 @@
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+
+#define GET_OFF(field) offsetof(jit_fc_decompression_call_args, field)
+
+/*
+    Computes the partial dot products of one row of the FP32 input and 'oc_block' rows of the u8/i8 weights.
+    The weights are converted to FP32 and the zero points are subtracted in registers, so the weights are read from
+    memory in their compressed form. The accumulators are stored as is, the lanes are reduced and the scales are
+    applied by the caller. Only the first ic / simd_w vectors are processed, the rest of the row is left to the caller.
+*/
+template <cpu_isa_t isa>
+struct jit_uni_fc_decompression_kernel_f32 : public jit_uni_fc_decompression_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_fc_decompression_kernel_f32)
+
+    explicit jit_uni_fc_decompression_kernel_f32(jit_fc_decompression_config_params jcp)
+        : jit_uni_fc_decompression_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        if (jcp_.with_zero_points) {
+            mov(reg_zero_points, ptr[reg_params + GET_OFF(zero_points)]);
+            for (size_t oc = 0; oc < jcp_.oc_block; oc++)
+                uni_vbroadcastss(vmm_zero_point(oc), ptr[reg_zero_points + oc * sizeof(float)]);
+        }
+
+        for (size_t oc = 0; oc < jcp_.oc_block; oc++)
+            uni_vpxor(vmm_acc(oc), vmm_acc(oc), vmm_acc(oc));
+
+        mov(reg_work_amount, jcp_.ic / simd_w);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label exit_label;
+
+        L(loop_label); {
+            cmp(reg_work_amount, 0);
+            je(exit_label, T_NEAR);
+
+            uni_vmovups(vmm_src, ptr[reg_src]);
+            for (size_t oc = 0; oc < jcp_.oc_block; oc++) {
+                load_weights(vmm_weights, ptr[reg_weights + oc * jcp_.ic]);
+                if (jcp_.with_zero_points)
+                    uni_vsubps(vmm_weights, vmm_weights, vmm_zero_point(oc));
+                uni_vfmadd231ps(vmm_acc(oc), vmm_src, vmm_weights);
+            }
+
+            add(reg_src, simd_w * sizeof(float));
+            add(reg_weights, simd_w);
+            sub(reg_work_amount, 1);
+            jmp(loop_label, T_NEAR);
+        }
+        L(exit_label);
+
+        for (size_t oc = 0; oc < jcp_.oc_block; oc++)
+            uni_vmovups(ptr[reg_dst + oc * simd_w * sizeof(float)], vmm_acc(oc));
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional3<isa == sse41, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const size_t vlen = cpu_isa_traits<isa>::vlen;
+    const size_t simd_w = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_weights = r9;
+    Xbyak::Reg64 reg_zero_points = r10;
+    Xbyak::Reg64 reg_dst = r11;
+    Xbyak::Reg64 reg_work_amount = r12;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    // the accumulators and the zero points of the block are kept in registers during the whole row
+    inline Vmm vmm_acc(size_t oc) { return Vmm(oc); }
+    inline Vmm vmm_zero_point(size_t oc) { return Vmm(jcp_.oc_block + oc); }
+    Vmm vmm_src = Vmm(2 * jcp_.oc_block);
+    Vmm vmm_weights = Vmm(2 * jcp_.oc_block + 1);
+
+    inline void load_weights(Vmm vmm_dst, const Xbyak::Address &op) {
+        if (jcp_.weights_prc == Precision::I8)
+            uni_vpmovsxbd(vmm_dst, op);
+        else
+            uni_vpmovzxbd(vmm_dst, op);
+        uni_vcvtdq2ps(vmm_dst, vmm_dst);
+    }
+};
 
 bool MKLDNNFullyConnectedNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
@@ -79,6 +177,10 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
 
+    // the compressed weights are not supported by oneDNN, the node uses its own kernel
+    if (withWeightsDecompression())
+        return;
+
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalOutputPrecisionAtPort(DATA_ID));
 
@@ -127,7 +229,60 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!withWeightsDecompression()) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    impl_desc_type implType = mayiuse(avx512_common) ? impl_desc_type::jit_avx512 :
+                              mayiuse(avx2) ? impl_desc_type::jit_avx2 : impl_desc_type::ref;
+
+    std::vector<PortConfigurator> inConfigurators({{LayoutType::ncsp, Precision::FP32},
+                                                   {LayoutType::ncsp, getOriginalInputPrecisionAtPort(WEIGHTS_ID)}});
+    if (withBiases)
+        inConfigurators.push_back({LayoutType::ncsp, Precision::FP32});
+
+    addSupportedPrimDesc(inConfigurators, {{LayoutType::ncsp, Precision::FP32}}, implType);
+}
+
+void MKLDNNFullyConnectedNode::createDecompressionKernels() {
+    if (decompressionKernel || !mayiuse(avx2))
+        return;
+
+    const auto& weightsShape = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const size_t OC = weightsShape[0];
+
+    jit_fc_decompression_config_params jcp;
+    jcp.ic = weightsShape[1];
+    jcp.weights_prc = getOriginalInputPrecisionAtPort(WEIGHTS_ID);
+    jcp.with_zero_points = !decompressionSubtract.empty();
+
+    auto createKernel = [&](size_t ocBlock) {
+        jcp.oc_block = ocBlock;
+        std::shared_ptr<jit_uni_fc_decompression_kernel> kernel;
+        if (mayiuse(avx512_common)) {
+            kernel.reset(new jit_uni_fc_decompression_kernel_f32<avx512_common>(jcp));
+        } else {
+            kernel.reset(new jit_uni_fc_decompression_kernel_f32<avx2>(jcp));
+        }
+        kernel->create_ker();
+        return kernel;
+    };
+
+    decompressionKernel = createKernel(DECOMPRESSION_OC_BLOCK);
+    if (OC % DECOMPRESSION_OC_BLOCK != 0)
+        decompressionTailKernel = createKernel(OC % DECOMPRESSION_OC_BLOCK);
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
+    if (withWeightsDecompression()) {
+        createDecompressionKernels();
+        return;
+    }
+
     if (prim)
         return;
 
@@ -155,7 +310,71 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
     }
 }
 
+void MKLDNNFullyConnectedNode::executeWithDecompression() {
+    const auto* src = reinterpret_cast<const float*>(getParentEdgeAt(DATA_ID)->getMemoryPtr()->GetPtr());
+    const auto* weights = reinterpret_cast<const uint8_t*>(getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr()->GetPtr());
+    const auto* bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemoryPtr()->GetPtr()) : nullptr;
+    auto* dst = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const auto& weightsShape = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const size_t OC = weightsShape[0];
+    const size_t IC = weightsShape[1];
+    const auto& srcShape = getInputShapeAtPort(DATA_ID).getStaticDims();
+    const size_t rowsNum = std::accumulate(srcShape.begin(), srcShape.end() - 1, size_t(1), std::multiplies<size_t>());
+
+    const bool isSigned = getOriginalInputPrecisionAtPort(WEIGHTS_ID) == Precision::I8;
+    const bool withZeroPoints = !decompressionSubtract.empty();
+    const size_t simdW = mayiuse(avx512_common) ? 16 : 8;
+    // the kernel processes the whole vectors of the row, the rest is computed below
+    const size_t vectorIC = decompressionKernel ? IC / simdW * simdW : 0;
+
+    auto weightAt = [&](size_t oc, size_t ic) {
+        const size_t idx = oc * IC + ic;
+        return isSigned ? static_cast<float>(reinterpret_cast<const int8_t*>(weights)[idx]) : static_cast<float>(weights[idx]);
+    };
+
+    parallel_for(div_up(OC, DECOMPRESSION_OC_BLOCK), [&](size_t block) {
+        const size_t ocStart = block * DECOMPRESSION_OC_BLOCK;
+        const size_t ocBlock = std::min(OC - ocStart, static_cast<size_t>(DECOMPRESSION_OC_BLOCK));
+        const auto& kernel = ocBlock == DECOMPRESSION_OC_BLOCK ? decompressionKernel : decompressionTailKernel;
+        float partialSums[DECOMPRESSION_OC_BLOCK * 16];
+
+        // the weights of the block are read from memory once and stay in cache for the next rows
+        for (size_t row = 0; row < rowsNum; row++) {
+            const float* srcRow = src + row * IC;
+            float sums[DECOMPRESSION_OC_BLOCK] = {};
+            if (vectorIC != 0) {
+                jit_fc_decompression_call_args args;
+                args.src = srcRow;
+                args.weights = weights + ocStart * IC;
+                args.zero_points = withZeroPoints ? &decompressionSubtract[ocStart] : nullptr;
+                args.dst = partialSums;
+                (*kernel)(&args);
+
+                for (size_t oc = 0; oc < ocBlock; oc++) {
+                    for (size_t i = 0; i < simdW; i++)
+                        sums[oc] += partialSums[oc * simdW + i];
+                }
+            }
+
+            for (size_t oc = 0; oc < ocBlock; oc++) {
+                const size_t outChannel = ocStart + oc;
+                const float zeroPoint = withZeroPoints ? decompressionSubtract[outChannel] : 0.f;
+                for (size_t ic = vectorIC; ic < IC; ic++)
+                    sums[oc] += srcRow[ic] * (weightAt(outChannel, ic) - zeroPoint);
+
+                dst[row * OC + outChannel] = sums[oc] * decompressionMultiply[outChannel] + (bias ? bias[outChannel] : 0.f);
+            }
+        }
+    });
+}
+
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (withWeightsDecompression()) {
+        executeWithDecompression();
+        return;
+    }
+
     if (prim) {
         auto reshapeMemory = [this](int argType) {
             auto param = primArgs.find(argType);
@@ -179,6 +398,9 @@ void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
 }
 
 bool MKLDNNFullyConnectedNode::canFuse(const MKLDNNNodePtr& node) const {
+    // the decompressing kernel does not apply post ops
+    if (withWeightsDecompression())
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -320,6 +542,8 @@ void MKLDNNFullyConnectedNode::createDescriptorInternal(const mkldnn::memory::de
 
 void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                                 const std::vector<MemoryDescPtr> &outputDesc) {
+    if (withWeightsDecompression())
+        return;
     createDescriptorInternal(MemoryDescUtils::convertToDnnlMemoryDesc(inputDesc[0])->getDnnlDesc(),
                              MemoryDescUtils::convertToDnnlMemoryDesc(outputDesc[0])->getDnnlDesc());
 }
@@ -12,12 +12,43 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_fc_decompression_config_params {
+    size_t ic;
+    InferenceEngine::Precision weights_prc;
+    bool with_zero_points;
+    size_t oc_block;
+};
+
+struct jit_fc_decompression_call_args {
+    const float* src;
+    const void* weights;
+    const float* zero_points;
+    float* dst;
+};
+
+struct jit_uni_fc_decompression_kernel {
+    void (*ker_)(const jit_fc_decompression_call_args *);
+
+    void operator()(const jit_fc_decompression_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_fc_decompression_kernel(jit_fc_decompression_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_fc_decompression_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_fc_decompression_config_params jcp_;
+};
+
 class MKLDNNFullyConnectedNode : public MKLDNNNode {
 public:
     MKLDNNFullyConnectedNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const Shape &dims) const override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
@@ -43,6 +74,10 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
+    // per output channel scales and zero points of the u8/i8 weights, the weights are dequantized on the fly when set
+    std::vector<float> decompressionMultiply;
+    std::vector<float> decompressionSubtract;
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -56,12 +91,23 @@ private:
     std::vector<MKLDNNMemoryPtr> PostOpsIntBlobMemory;
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights, bool initAsBinary);
 
+    bool withWeightsDecompression() const {
+        return !decompressionMultiply.empty();
+    }
+    void createDecompressionKernels();
+    void executeWithDecompression();
+
+    std::shared_ptr<jit_uni_fc_decompression_kernel> decompressionKernel;
+    // handles the last output channels which do not fill the whole block
+    std::shared_ptr<jit_uni_fc_decompression_kernel> decompressionTailKernel;
+
     bool withBiases = false;
 
     std::string errorPrefix;
     static const size_t DATA_ID = 0;
     static const size_t WEIGHTS_ID = 1;
     static const size_t BIAS_ID = 2;
+    static const size_t DECOMPRESSION_OC_BLOCK = 4;
 };
 
 }  // namespace MKLDNNPlugin
@@ -54,6 +54,8 @@ void MKLDNNIfNode::getSupportedDescriptors() {
 
     const std::shared_ptr<const ov::Function>& thenBody = ifOp->get_then_body();
     const std::shared_ptr<const ov::Function>& elseBody = ifOp->get_else_body();
+    subGraphThen.setRuntimeCache(rtParamsCache);
+    subGraphElse.setRuntimeCache(rtParamsCache);
     subGraphThen.CreateGraph(thenBody, ext_mng, weightCache);
     subGraphElse.CreateGraph(elseBody, ext_mng, weightCache);
 
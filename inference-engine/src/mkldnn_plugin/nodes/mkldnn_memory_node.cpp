@@ -10,6 +10,8 @@
 #include "utils/general_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/ngraph_utils.hpp"
+#include "mkldnn_concat_node.h"
+#include "mkldnn_split_node.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -75,6 +77,32 @@ void MKLDNNMemoryOutputNode::initSupportedPrimitiveDescriptors() {
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
 }
 
+static inline void changeEdgePtr(const MKLDNNEdgePtr &edge, void *newPtr) {
+    edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
+}
+
+void MKLDNNMemoryOutputNode::createPrimitive() {
+    // The producer may write the new state directly to the state buffer only if nobody else reads its output
+    // and its output doesn't share memory with inputs
+    auto srcEdge = getParentEdgeAt(0);
+    auto parent = srcEdge->getParent();
+    canShareInput = parent->getChildEdges().size() == 1 && !parent->isConstant() && !parent->isInplace() &&
+                    !one_of(parent->getType(), Input, MemoryInput);
+    for (size_t i = 0; canShareInput && i < parent->getParentEdges().size(); i++) {
+        if (parent->getParentEdgeAt(i)->getMemory().GetPtr() == srcEdge->getMemory().GetPtr())
+            canShareInput = false;
+    }
+}
+
+void MKLDNNMemoryOutputNode::redirectInput(const MKLDNNMemoryPtr& state) {
+    if (!canShareInput)
+        return;
+    auto srcEdge = getParentEdgeAt(0);
+    const auto& srcMemory = srcEdge->getMemory();
+    if (srcMemory.GetPtr() != state->GetPtr() && srcMemory.getDesc().isCompatible(state->getDesc()))
+        changeEdgePtr(srcEdge, state->GetPtr());
+}
+
 void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
@@ -121,6 +149,46 @@ void MKLDNNMemoryInputNode::createPrimitive() {
     // default memory state is zero filled
     if (dataStore->getDesc().hasDefinedMaxSize())
         dataStore->FillZero();
+
+    // until the state buffers are bound the single store is read and written in place
+    activeState = dataStore;
+    inactiveState = dataStore;
+
+    // Consumers can read the state buffer directly only if they don't keep own pointers to the input
+    // and don't share their outputs with it (the same rules as for the network inputs in the infer request)
+    canShareOutput = true;
+    for (size_t i = 0; canShareOutput && i < getChildEdges().size(); i++) {
+        auto edge = getChildEdgeAt(i);
+        auto child = edge->getChild();
+        if (child->isConstant() || child->isInplace() || one_of(child->getType(), Output, Split))
+            canShareOutput = false;
+
+        auto concat = dynamic_cast<MKLDNNConcatNode*>(child.get());
+        if (concat && concat->isOptimized())
+            canShareOutput = false;
+
+        for (size_t j = 0; canShareOutput && j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetPtr() == edge->getMemory().GetPtr())
+                canShareOutput = false;
+        }
+    }
+}
+
+void MKLDNNMemoryInputNode::setStateBuffers(const MKLDNNMemoryPtr& active, const MKLDNNMemoryPtr& inactive) {
+    IE_ASSERT(active->GetSize() == dataStore->GetSize() && inactive->GetSize() == dataStore->GetSize())
+        << "State buffers are not compatible with the variable " << getId();
+    activeState = active;
+    inactiveState = inactive;
+
+    if (canShareOutput) {
+        for (size_t i = 0; i < getChildEdges().size(); i++) {
+            auto edge = getChildEdgeAt(i);
+            if (edge->getMemory().GetPtr() != activeState->GetPtr())
+                changeEdgePtr(edge, activeState->GetPtr());
+        }
+    }
+    if (outputNode)
+        outputNode->redirectInput(inactiveState);
 }
 
 /**
@@ -150,17 +218,16 @@ MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
 }
 
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
-    // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    // the producer has already written the state in place if its output is redirected to the buffer
+    if (new_state.GetPtr() != inactiveState->GetPtr())
+        simple_copy(*inactiveState, new_state);
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
-    // TODO: Should be simple call of:
-    //           dst_mem.SetData(dataStore, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    // the consumers read the active buffer directly if the output edges are redirected to it
+    const auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    if (dstMemory.GetPtr() != activeState->GetPtr())
+        simple_copy(dstMemory, *activeState);
 }
 
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
@@ -172,6 +239,7 @@ MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(
         auto outputNode = dynamic_cast<MKLDNNMemoryOutputNode*>(sibling);
         IE_ASSERT(outputNode != nullptr);
         outputNode->setInputNode(node);
+        node->setOutputNode(outputNode);
     } else {
         holder[node->getId()] = node;
     }
@@ -187,6 +255,7 @@ MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerOutput
         auto inputNode = dynamic_cast<MKLDNNMemoryInputNode*>(sibling);
         IE_ASSERT(inputNode != nullptr);
         node->setInputNode(inputNode);
+        inputNode->setOutputNode(node);
     } else {
         holder[node->getId()] = node;
     }
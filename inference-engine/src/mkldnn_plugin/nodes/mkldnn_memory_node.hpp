@@ -62,7 +62,7 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {}
+    void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override {
         return getType() == MemoryOutput;
@@ -72,11 +72,17 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
         inputNode = node;
     }
 
+    /**
+     * @brief Makes the producer of the new state write directly to the given buffer if it is possible
+     */
+    void redirectInput(const MKLDNNMemoryPtr& state);
+
  private:
     /**
      * @brief keeps reference to input sibling node
      */
     MKLDNNNode* inputNode = nullptr;
+    bool canShareInput = false;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
@@ -97,10 +103,25 @@ public:
     void createPrimitive() override;
 
     void setInputNode(MKLDNNNode* node) override {}
+    void setOutputNode(MKLDNNMemoryOutputNode* node) {
+        outputNode = node;
+    }
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+
+    /**
+     * @brief Binds ping-pong state buffers: the node outputs the active one and the sibling output node stores
+     * the new state to the inactive one. Graph edges are redirected to the buffers where it is possible,
+     * so the state is copied only if a neighbour node can't work with external memory.
+     */
+    void setStateBuffers(const MKLDNNMemoryPtr& active, const MKLDNNMemoryPtr& inactive);
+
  private:
     MKLDNNMemoryPtr dataStore;
+    MKLDNNMemoryPtr activeState;
+    MKLDNNMemoryPtr inactiveState;
+    MKLDNNMemoryOutputNode* outputNode = nullptr;
+    bool canShareOutput = false;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
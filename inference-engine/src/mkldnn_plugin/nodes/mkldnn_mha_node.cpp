@@ -0,0 +1,603 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_mha_node.h"
+#include <ngraph_ops/multi_head_attention.hpp>
+#include <string>
+#include <vector>
+#include <cfloat>
+#include <cmath>
+#include <algorithm>
+#include <numeric>
+#include <functional>
+#include <mkldnn.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include <cpu/x64/injectors/jit_uni_eltwise_injector.hpp>
+#include "ie_parallel.hpp"
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+
+#define GET_OFF_QK(field) offsetof(jit_mha_qk_call_args, field)
+#define GET_OFF_PV(field) offsetof(jit_mha_pv_call_args, field)
+
+/*
+    Computes the scaled and masked scores of one query row for 'work_amount' vectors of keys. The keys are transposed,
+    so each query element is broadcast and multiplied by a row of the keys, several vectors of keys share the
+    broadcast. The lanes of the maximum of the scores are stored as is and are reduced by the caller.
+*/
+template <cpu_isa_t isa>
+struct jit_uni_mha_qk_kernel_f32 : public jit_uni_mha_qk_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_mha_qk_kernel_f32)
+
+    explicit jit_uni_mha_qk_kernel_f32(jit_mha_config_params jcp)
+        : jit_uni_mha_qk_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_q, ptr[reg_params + GET_OFF_QK(q)]);
+        mov(reg_kt, ptr[reg_params + GET_OFF_QK(kt)]);
+        if (jcp_.with_mask)
+            mov(reg_mask, ptr[reg_params + GET_OFF_QK(mask)]);
+        mov(reg_scores, ptr[reg_params + GET_OFF_QK(scores)]);
+        mov(reg_max, ptr[reg_params + GET_OFF_QK(max)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF_QK(work_amount)]);
+
+        broadcast_float(vmm_scale, jcp_.scale);
+        broadcast_float(vmm_max, -FLT_MAX);
+
+        Xbyak::Label unrolled_loop_label;
+        Xbyak::Label unrolled_loop_end_label;
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        L(unrolled_loop_label); {
+            cmp(reg_work_amount, unroll);
+            jl(unrolled_loop_end_label, T_NEAR);
+
+            compute_scores(unroll);
+
+            sub(reg_work_amount, unroll);
+            jmp(unrolled_loop_label, T_NEAR);
+        }
+        L(unrolled_loop_end_label);
+
+        L(loop_label); {
+            cmp(reg_work_amount, 0);
+            je(loop_end_label, T_NEAR);
+
+            compute_scores(1);
+
+            sub(reg_work_amount, 1);
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        uni_vmovups(ptr[reg_max], vmm_max);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional3<isa == sse41, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const size_t vlen = cpu_isa_traits<isa>::vlen;
+    const size_t unroll = 4;
+
+    Xbyak::Reg64 reg_q = r8;
+    Xbyak::Reg64 reg_kt = r9;
+    Xbyak::Reg64 reg_mask = r10;
+    Xbyak::Reg64 reg_scores = r11;
+    Xbyak::Reg64 reg_max = r12;
+    Xbyak::Reg64 reg_work_amount = r13;
+    Xbyak::Reg64 reg_tmp = r14;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    inline Vmm vmm_acc(size_t i) { return Vmm(i); }
+    Vmm vmm_q = Vmm(unroll);
+    Vmm vmm_scale = Vmm(unroll + 1);
+    Vmm vmm_max = Vmm(unroll + 2);
+    Xbyak::Xmm xmm_tmp = Xbyak::Xmm(unroll + 3);
+
+    inline void broadcast_float(Vmm vmm_dst, float value) {
+        mov(reg_tmp.cvt32(), float2int(value));
+        vmovd(xmm_tmp, reg_tmp.cvt32());
+        uni_vbroadcastss(vmm_dst, xmm_tmp);
+    }
+
+    void compute_scores(size_t vectors) {
+        for (size_t i = 0; i < vectors; i++)
+            uni_vpxor(vmm_acc(i), vmm_acc(i), vmm_acc(i));
+
+        for (size_t d = 0; d < jcp_.head_size; d++) {
+            uni_vbroadcastss(vmm_q, ptr[reg_q + d * sizeof(float)]);
+            for (size_t i = 0; i < vectors; i++)
+                uni_vfmadd231ps(vmm_acc(i), vmm_q, ptr[reg_kt + d * jcp_.kt_stride * sizeof(float) + i * vlen]);
+        }
+
+        for (size_t i = 0; i < vectors; i++) {
+            uni_vmulps(vmm_acc(i), vmm_acc(i), vmm_scale);
+            if (jcp_.with_mask)
+                uni_vaddps(vmm_acc(i), vmm_acc(i), ptr[reg_mask + i * vlen]);
+            uni_vmovups(ptr[reg_scores + i * vlen], vmm_acc(i));
+            uni_vmaxps(vmm_max, vmm_max, vmm_acc(i));
+        }
+
+        add(reg_kt, vectors * vlen);
+        if (jcp_.with_mask)
+            add(reg_mask, vectors * vlen);
+        add(reg_scores, vectors * vlen);
+    }
+};
+
+/*
+    Replaces the scores of the block by exp(score - max) in place and stores the lanes of their sum, then rescales the
+    output accumulator by the correction of the running maximum and adds the values weighted by the probabilities.
+    The accumulator is processed in chunks which fit into the registers, the values may be BF16.
+*/
+template <cpu_isa_t isa>
+struct jit_uni_mha_pv_kernel_f32 : public jit_uni_mha_pv_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_mha_pv_kernel_f32)
+
+    explicit jit_uni_mha_pv_kernel_f32(jit_mha_config_params jcp)
+        : jit_uni_mha_pv_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        exp_injector.reset(new jit_uni_eltwise_injector_f32<isa>(this, mkldnn::impl::alg_kind::eltwise_exp, 0.f, 0.f, 1.0f));
+
+        this->preamble();
+
+        mov(reg_scores, ptr[reg_params + GET_OFF_PV(scores)]);
+        mov(reg_aux_scores, ptr[reg_params + GET_OFF_PV(max)]);
+        uni_vbroadcastss(vmm_max, ptr[reg_aux_scores]);
+        mov(reg_aux_scores, ptr[reg_params + GET_OFF_PV(corr)]);
+        uni_vbroadcastss(vmm_corr, ptr[reg_aux_scores]);
+        mov(reg_v, ptr[reg_params + GET_OFF_PV(v)]);
+        mov(reg_acc, ptr[reg_params + GET_OFF_PV(acc)]);
+        mov(reg_sum, ptr[reg_params + GET_OFF_PV(sum)]);
+        mov(reg_vec_amount, ptr[reg_params + GET_OFF_PV(vec_amount)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF_PV(work_amount)]);
+
+        Xbyak::Label exp_loop_label;
+        Xbyak::Label exp_loop_end_label;
+
+        uni_vpxor(vmm_sum, vmm_sum, vmm_sum);
+        mov(reg_aux_scores, reg_scores);
+        L(exp_loop_label); {
+            cmp(reg_vec_amount, 0);
+            je(exp_loop_end_label, T_NEAR);
+
+            uni_vmovups(vmm_val, ptr[reg_aux_scores]);
+            uni_vsubps(vmm_val, vmm_val, vmm_max);
+            exp_injector->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
+            uni_vmovups(ptr[reg_aux_scores], vmm_val);
+            uni_vaddps(vmm_sum, vmm_sum, vmm_val);
+
+            add(reg_aux_scores, vlen);
+            sub(reg_vec_amount, 1);
+            jmp(exp_loop_label, T_NEAR);
+        }
+        L(exp_loop_end_label);
+
+        uni_vmovups(ptr[reg_sum], vmm_sum);
+
+        const size_t vectors = jcp_.head_size_v / simd_w;
+        for (size_t start = 0; start < vectors; start += acc_block)
+            accumulate(start, std::min(acc_block, vectors - start));
+
+        this->postamble();
+
+        exp_injector->prepare_table();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional3<isa == sse41, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const size_t vlen = cpu_isa_traits<isa>::vlen;
+    const size_t simd_w = vlen / sizeof(float);
+    const size_t acc_block = 8;
+
+    Xbyak::Reg64 reg_scores = r8;
+    Xbyak::Reg64 reg_v = r9;
+    Xbyak::Reg64 reg_acc = r10;
+    Xbyak::Reg64 reg_sum = r11;
+    Xbyak::Reg64 reg_vec_amount = r12;
+    Xbyak::Reg64 reg_work_amount = r13;
+    Xbyak::Reg64 reg_aux_scores = r14;
+    Xbyak::Reg64 reg_aux_v = r15;
+    Xbyak::Reg64 reg_aux_work_amount = rbx;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    inline Vmm vmm_acc(size_t i) { return Vmm(i); }
+    Vmm vmm_p = Vmm(acc_block);
+    Vmm vmm_v = Vmm(acc_block + 1);
+    Vmm vmm_corr = Vmm(acc_block + 2);
+    Vmm vmm_max = Vmm(acc_block + 3);
+    Vmm vmm_sum = Vmm(acc_block + 4);
+    Vmm vmm_val = Vmm(acc_block + 5);
+
+    std::shared_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector;
+
+    void accumulate(size_t start, size_t vectors) {
+        const size_t v_size = jcp_.v_prc.size();
+
+        for (size_t i = 0; i < vectors; i++) {
+            uni_vmovups(vmm_acc(i), ptr[reg_acc + (start + i) * vlen]);
+            uni_vmulps(vmm_acc(i), vmm_acc(i), vmm_corr);
+        }
+
+        mov(reg_aux_scores, reg_scores);
+        mov(reg_aux_v, reg_v);
+        mov(reg_aux_work_amount, reg_work_amount);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        L(loop_label); {
+            cmp(reg_aux_work_amount, 0);
+            je(loop_end_label, T_NEAR);
+
+            uni_vbroadcastss(vmm_p, ptr[reg_aux_scores]);
+            for (size_t i = 0; i < vectors; i++) {
+                const size_t offset = (start + i) * simd_w * v_size;
+                if (jcp_.v_prc == Precision::BF16) {
+                    vpmovzxwd(vmm_v, ptr[reg_aux_v + offset]);
+                    uni_vpslld(vmm_v, vmm_v, 16);
+                    uni_vfmadd231ps(vmm_acc(i), vmm_p, vmm_v);
+                } else {
+                    uni_vfmadd231ps(vmm_acc(i), vmm_p, ptr[reg_aux_v + offset]);
+                }
+            }
+
+            add(reg_aux_scores, sizeof(float));
+            add(reg_aux_v, jcp_.head_size_v * v_size);
+            sub(reg_aux_work_amount, 1);
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        for (size_t i = 0; i < vectors; i++)
+            uni_vmovups(ptr[reg_acc + (start + i) * vlen], vmm_acc(i));
+    }
+};
+
+bool MKLDNNMultiHeadAttentionNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (isDynamicNgraphNode(op)) {
+            errorMessage = "Doesn't support op with dynamic shapes";
+            return false;
+        }
+        const auto mha = std::dynamic_pointer_cast<const ngraph::op::internal::MultiHeadAttention>(op);
+        if (!mha) {
+            errorMessage = "Only internal MultiHeadAttention operation is supported";
+            return false;
+        }
+        const auto& outDims = op->get_output_shape(0);
+        if (mha->with_mask()) {
+            const auto& maskDims = op->get_input_shape(MASK_ID);
+            if (maskDims.size() > outDims.size()) {
+                errorMessage = "Doesn't support mask with rank greater than the rank of the inputs";
+                return false;
+            }
+            // the scores have the shape of the output, except the last dimension
+            auto scoresDims = outDims;
+            scoresDims.back() = mha->get_transpose_k() ? op->get_input_shape(K_ID).rbegin()[1] : op->get_input_shape(K_ID).back();
+            const size_t offset = scoresDims.size() - maskDims.size();
+            for (size_t i = 0; i < maskDims.size(); i++) {
+                if (maskDims[i] != 1 && maskDims[i] != scoresDims[offset + i]) {
+                    errorMessage = "Doesn't support mask which is not broadcast to the scores";
+                    return false;
+                }
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNMultiHeadAttentionNode::MKLDNNMultiHeadAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+                                                           MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "MultiHeadAttention node with name '" + getName() + "'";
+    const auto mha = std::dynamic_pointer_cast<const ngraph::op::internal::MultiHeadAttention>(op);
+    scale = mha->get_scale();
+    transposeK = mha->get_transpose_k();
+    withMask = mha->with_mask();
+
+    const auto& qDims = op->get_input_shape(Q_ID);
+    const auto& kDims = op->get_input_shape(K_ID);
+    const auto& vDims = op->get_input_shape(V_ID);
+    const size_t rank = qDims.size();
+    batchHeads = std::accumulate(qDims.begin(), qDims.end() - 2, size_t(1), std::multiplies<size_t>());
+    seqLenQ = qDims[rank - 2];
+    headSize = qDims[rank - 1];
+    seqLenK = transposeK ? kDims[rank - 2] : kDims[rank - 1];
+    headSizeV = vDims[rank - 1];
+
+    if (withMask) {
+        // the mask is aligned to [batch..., seqLenQ, seqLenK], the broadcast dimensions get zero strides
+        auto maskDims = op->get_input_shape(MASK_ID);
+        maskDims.insert(maskDims.begin(), rank - maskDims.size(), 1);
+        std::vector<size_t> maskStrides(rank, 0);
+        size_t stride = 1;
+        for (int i = static_cast<int>(rank) - 1; i >= 0; i--) {
+            maskStrides[i] = maskDims[i] == 1 ? 0 : stride;
+            stride *= maskDims[i];
+        }
+        maskRowStride = maskStrides[rank - 2];
+        maskColStride = maskStrides[rank - 1];
+
+        maskBatchOffsets.resize(batchHeads);
+        for (size_t bh = 0; bh < batchHeads; bh++) {
+            size_t idx = bh;
+            size_t offset = 0;
+            for (int i = static_cast<int>(rank) - 3; i >= 0; i--) {
+                offset += (idx % qDims[i]) * maskStrides[i];
+                idx /= qDims[i];
+            }
+            maskBatchOffsets[bh] = offset;
+        }
+    }
+}
+
+namespace {
+
+// The kernels process the values by whole vectors, the other head sizes are computed by the reference code
+cpu_isa_t getKernelIsa(size_t headSizeV) {
+    if (mayiuse(avx512_common) && headSizeV % 16 == 0)
+        return avx512_common;
+    if (mayiuse(avx2) && headSizeV % 8 == 0)
+        return avx2;
+    return isa_any;
+}
+
+} // namespace
+
+void MKLDNNMultiHeadAttentionNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    Precision precision = getOriginalInputPrecisionAtPort(Q_ID);
+    if (!one_of(precision, Precision::FP32, Precision::BF16) || (precision == Precision::BF16 && !mayiuse(avx512_core)))
+        precision = Precision::FP32;
+
+    impl_desc_type implType = impl_desc_type::ref;
+    const auto isa = getKernelIsa(headSizeV);
+    if (isa == avx512_common)
+        implType = impl_desc_type::jit_avx512;
+    else if (isa == avx2)
+        implType = impl_desc_type::jit_avx2;
+
+    std::vector<PortConfigurator> inConfigurators({{LayoutType::ncsp, precision},
+                                                   {LayoutType::ncsp, precision},
+                                                   {LayoutType::ncsp, precision}});
+    if (withMask)
+        inConfigurators.push_back({LayoutType::ncsp, Precision::FP32});
+
+    addSupportedPrimDesc(inConfigurators, {{LayoutType::ncsp, precision}}, implType);
+}
+
+void MKLDNNMultiHeadAttentionNode::createPrimitive() {
+    if (!keysTransposed.empty())
+        return;
+
+    dataPrecision = getSelectedPrimitiveDescriptor()->getConfig().inConfs[Q_ID].desc->getPrecision();
+
+    jit_mha_config_params jcp;
+    jcp.head_size = headSize;
+    jcp.head_size_v = headSizeV;
+    jcp.scale = scale;
+    jcp.v_prc = dataPrecision;
+
+    const auto isa = getKernelIsa(headSizeV);
+    if (isa == avx512_common) {
+        simdW = 16;
+        seqLenKPadded = rnd_up(seqLenK, simdW);
+        jcp.kt_stride = seqLenKPadded;
+        jcp.with_mask = withMask || seqLenKPadded != seqLenK;
+        qkKernel.reset(new jit_uni_mha_qk_kernel_f32<avx512_common>(jcp));
+        pvKernel.reset(new jit_uni_mha_pv_kernel_f32<avx512_common>(jcp));
+    } else if (isa == avx2) {
+        simdW = 8;
+        seqLenKPadded = rnd_up(seqLenK, simdW);
+        jcp.kt_stride = seqLenKPadded;
+        jcp.with_mask = withMask || seqLenKPadded != seqLenK;
+        qkKernel.reset(new jit_uni_mha_qk_kernel_f32<avx2>(jcp));
+        pvKernel.reset(new jit_uni_mha_pv_kernel_f32<avx2>(jcp));
+    } else {
+        simdW = 1;
+        seqLenKPadded = seqLenK;
+    }
+    if (qkKernel)
+        qkKernel->create_ker();
+    if (pvKernel)
+        pvKernel->create_ker();
+
+    keysTransposed.resize(batchHeads * headSize * seqLenKPadded);
+    // scores of the block, mask row, query row, accumulator, partial maximum and partial sum
+    scratchPerThread = KEYS_BLOCK + seqLenKPadded + headSize + headSizeV + 2 * 16;
+    scratchBuffer.resize(parallel_get_max_threads() * scratchPerThread);
+}
+
+void MKLDNNMultiHeadAttentionNode::transposeKeys(const uint8_t* k) {
+    const auto* kF32 = reinterpret_cast<const float*>(k);
+    const auto* kBF16 = reinterpret_cast<const bfloat16_t*>(k);
+    const bool isBF16 = dataPrecision == Precision::BF16;
+
+    parallel_for2d(batchHeads, headSize, [&](size_t bh, size_t d) {
+        float* dst = &keysTransposed[(bh * headSize + d) * seqLenKPadded];
+        const size_t headOffset = bh * seqLenK * headSize;
+        for (size_t s = 0; s < seqLenK; s++) {
+            const size_t idx = headOffset + (transposeK ? s * headSize + d : d * seqLenK + s);
+            dst[s] = isBF16 ? static_cast<float>(kBF16[idx]) : kF32[idx];
+        }
+        std::fill(dst + seqLenK, dst + seqLenKPadded, 0.f);
+    });
+}
+
+void MKLDNNMultiHeadAttentionNode::computeRow(size_t bh, size_t row, const uint8_t* q, const uint8_t* v, const float* mask,
+                                              uint8_t* dst, float* scratch) {
+    float* scores = scratch;
+    float* maskRow = scores + KEYS_BLOCK;
+    float* qRow = maskRow + seqLenKPadded;
+    float* acc = qRow + headSize;
+    float* partialMax = acc + headSizeV;
+    float* partialSum = partialMax + 16;
+
+    const bool isBF16 = dataPrecision == Precision::BF16;
+    const size_t qOffset = (bh * seqLenQ + row) * headSize;
+    const float* qData = reinterpret_cast<const float*>(q) + qOffset;
+    if (isBF16) {
+        const auto* qBF16 = reinterpret_cast<const bfloat16_t*>(q) + qOffset;
+        for (size_t d = 0; d < headSize; d++)
+            qRow[d] = static_cast<float>(qBF16[d]);
+        qData = qRow;
+    }
+
+    // the padded keys get the lowest scores, so they don't contribute to the softmax
+    const bool padded = seqLenKPadded != seqLenK;
+    const float* maskData = nullptr;
+    if (withMask) {
+        const float* maskSrc = mask + maskBatchOffsets[bh] + row * maskRowStride;
+        if (maskColStride == 1 && !padded) {
+            maskData = maskSrc;
+        } else {
+            for (size_t s = 0; s < seqLenK; s++)
+                maskRow[s] = maskSrc[s * maskColStride];
+            maskData = maskRow;
+        }
+    } else if (padded) {
+        std::fill(maskRow, maskRow + seqLenK, 0.f);
+        maskData = maskRow;
+    }
+    if (padded)
+        std::fill(maskRow + seqLenK, maskRow + seqLenKPadded, -FLT_MAX);
+
+    const float* kt = &keysTransposed[bh * headSize * seqLenKPadded];
+    const size_t vSize = dataPrecision.size();
+    const uint8_t* vHead = v + bh * seqLenK * headSizeV * vSize;
+    auto valueAt = [&](size_t s, size_t d) {
+        const size_t idx = s * headSizeV + d;
+        return isBF16 ? static_cast<float>(reinterpret_cast<const bfloat16_t*>(vHead)[idx]) : reinterpret_cast<const float*>(vHead)[idx];
+    };
+
+    // the softmax is computed online: the sum and the output are rescaled each time the running maximum grows
+    float runningMax = -FLT_MAX;
+    float runningSum = 0.f;
+    std::fill(acc, acc + headSizeV, 0.f);
+
+    for (size_t keysStart = 0; keysStart < seqLenK; keysStart += KEYS_BLOCK) {
+        const size_t keys = std::min(seqLenK - keysStart, static_cast<size_t>(KEYS_BLOCK));
+        const size_t vectors = div_up(keys, simdW);
+
+        float blockMax = -FLT_MAX;
+        if (qkKernel) {
+            jit_mha_qk_call_args args;
+            args.q = qData;
+            args.kt = kt + keysStart;
+            args.mask = maskData ? maskData + keysStart : nullptr;
+            args.scores = scores;
+            args.max = partialMax;
+            args.work_amount = vectors;
+            (*qkKernel)(&args);
+
+            for (size_t i = 0; i < simdW; i++)
+                blockMax = std::max(blockMax, partialMax[i]);
+        } else {
+            for (size_t s = 0; s < keys; s++) {
+                float score = 0.f;
+                for (size_t d = 0; d < headSize; d++)
+                    score += qData[d] * kt[d * seqLenKPadded + keysStart + s];
+                score = score * scale + (maskData ? maskData[keysStart + s] : 0.f);
+                scores[s] = score;
+                blockMax = std::max(blockMax, score);
+            }
+        }
+
+        const float newMax = std::max(runningMax, blockMax);
+        const float corr = std::exp(runningMax - newMax);
+        float blockSum = 0.f;
+        if (pvKernel) {
+            jit_mha_pv_call_args args;
+            args.scores = scores;
+            args.max = &newMax;
+            args.corr = &corr;
+            args.v = vHead + keysStart * headSizeV * vSize;
+            args.acc = acc;
+            args.sum = partialSum;
+            args.vec_amount = vectors;
+            args.work_amount = keys;
+            (*pvKernel)(&args);
+
+            for (size_t i = 0; i < simdW; i++)
+                blockSum += partialSum[i];
+        } else {
+            for (size_t s = 0; s < keys; s++) {
+                scores[s] = std::exp(scores[s] - newMax);
+                blockSum += scores[s];
+            }
+            for (size_t d = 0; d < headSizeV; d++)
+                acc[d] *= corr;
+            for (size_t s = 0; s < keys; s++) {
+                for (size_t d = 0; d < headSizeV; d++)
+                    acc[d] += scores[s] * valueAt(keysStart + s, d);
+            }
+        }
+
+        runningSum = runningSum * corr + blockSum;
+        runningMax = newMax;
+    }
+
+    const size_t dstOffset = (bh * seqLenQ + row) * headSizeV;
+    if (isBF16) {
+        auto* dstBF16 = reinterpret_cast<bfloat16_t*>(dst) + dstOffset;
+        for (size_t d = 0; d < headSizeV; d++)
+            dstBF16[d] = bfloat16_t(acc[d] / runningSum);
+    } else {
+        auto* dstF32 = reinterpret_cast<float*>(dst) + dstOffset;
+        for (size_t d = 0; d < headSizeV; d++)
+            dstF32[d] = acc[d] / runningSum;
+    }
+}
+
+void MKLDNNMultiHeadAttentionNode::execute(mkldnn::stream strm) {
+    const auto* q = reinterpret_cast<const uint8_t*>(getParentEdgeAt(Q_ID)->getMemoryPtr()->GetPtr());
+    const auto* k = reinterpret_cast<const uint8_t*>(getParentEdgeAt(K_ID)->getMemoryPtr()->GetPtr());
+    const auto* v = reinterpret_cast<const uint8_t*>(getParentEdgeAt(V_ID)->getMemoryPtr()->GetPtr());
+    const auto* mask = withMask ? reinterpret_cast<const float*>(getParentEdgeAt(MASK_ID)->getMemoryPtr()->GetPtr()) : nullptr;
+    auto* dst = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    transposeKeys(k);
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        float* scratch = &scratchBuffer[ithr * scratchPerThread];
+        for_2d(ithr, nthr, batchHeads, seqLenQ, [&](size_t bh, size_t row) {
+            computeRow(bh, row, q, v, mask, dst, scratch);
+        });
+    });
+}
+
+bool MKLDNNMultiHeadAttentionNode::created() const {
+    return getType() == MultiHeadAttention;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNMultiHeadAttentionNode, MultiHeadAttention)
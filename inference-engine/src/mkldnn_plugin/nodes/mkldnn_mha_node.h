@@ -0,0 +1,130 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+struct jit_mha_config_params {
+    size_t head_size;
+    size_t head_size_v;
+    // the row stride of the transposed keys, in elements
+    size_t kt_stride;
+    float scale;
+    bool with_mask;
+    InferenceEngine::Precision v_prc;
+};
+
+struct jit_mha_qk_call_args {
+    const float* q;
+    const float* kt;
+    const float* mask;
+    float* scores;
+    float* max;
+    size_t work_amount;
+};
+
+struct jit_mha_pv_call_args {
+    float* scores;
+    const float* max;
+    const float* corr;
+    const void* v;
+    float* acc;
+    float* sum;
+    size_t vec_amount;
+    size_t work_amount;
+};
+
+struct jit_uni_mha_qk_kernel {
+    void (*ker_)(const jit_mha_qk_call_args *);
+
+    void operator()(const jit_mha_qk_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_mha_qk_kernel(jit_mha_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_mha_qk_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_mha_config_params jcp_;
+};
+
+struct jit_uni_mha_pv_kernel {
+    void (*ker_)(const jit_mha_pv_call_args *);
+
+    void operator()(const jit_mha_pv_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_mha_pv_kernel(jit_mha_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_mha_pv_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_mha_config_params jcp_;
+};
+
+class MKLDNNMultiHeadAttentionNode : public MKLDNNNode {
+public:
+    MKLDNNMultiHeadAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    void transposeKeys(const uint8_t* k);
+    void computeRow(size_t bh, size_t row, const uint8_t* q, const uint8_t* v, const float* mask, uint8_t* dst, float* scratch);
+
+    float scale = 1.f;
+    bool transposeK = true;
+    bool withMask = false;
+
+    // the leading dimensions of the inputs are collapsed into a single batch of heads
+    size_t batchHeads = 0;
+    size_t seqLenQ = 0;
+    size_t seqLenK = 0;
+    size_t headSize = 0;
+    size_t headSizeV = 0;
+    // the keys are padded to the vector length, the padded scores are masked out
+    size_t seqLenKPadded = 0;
+    size_t simdW = 1;
+
+    std::vector<size_t> maskBatchOffsets;
+    size_t maskRowStride = 0;
+    size_t maskColStride = 0;
+
+    InferenceEngine::Precision dataPrecision = InferenceEngine::Precision::FP32;
+
+    // the transposed FP32 keys of all heads, [batchHeads, headSize, seqLenKPadded]
+    std::vector<float> keysTransposed;
+    std::vector<float> scratchBuffer;
+    size_t scratchPerThread = 0;
+
+    std::shared_ptr<jit_uni_mha_qk_kernel> qkKernel;
+    std::shared_ptr<jit_uni_mha_pv_kernel> pvKernel;
+
+    std::string errorPrefix;
+    static const size_t Q_ID = 0;
+    static const size_t K_ID = 1;
+    static const size_t V_ID = 2;
+    static const size_t MASK_ID = 3;
+    // the number of keys which scores are kept in the cache at once
+    static const size_t KEYS_BLOCK = 256;
+};
+
+}  // namespace MKLDNNPlugin
@@ -19,6 +19,46 @@ using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+
+struct ReorderKey {
+    mkldnn::memory::desc src;
+    mkldnn::memory::desc dest;
+
+    size_t hash() const {
+        size_t seed = 0;
+        for (const auto* desc : {&src.data, &dest.data}) {
+            seed = hash_combine(seed, desc->ndims);
+            for (int i = 0; i < desc->ndims; i++)
+                seed = hash_combine(seed, desc->dims[i]);
+            seed = hash_combine(seed, static_cast<int>(desc->data_type));
+            seed = hash_combine(seed, desc->offset0);
+            seed = hash_combine(seed, static_cast<int>(desc->format_kind));
+            if (desc->format_kind == dnnl_blocked) {
+                const auto& blk = desc->format_desc.blocking;
+                for (int i = 0; i < desc->ndims; i++)
+                    seed = hash_combine(seed, blk.strides[i]);
+                for (int i = 0; i < blk.inner_nblks; i++) {
+                    seed = hash_combine(seed, blk.inner_blks[i]);
+                    seed = hash_combine(seed, blk.inner_idxs[i]);
+                }
+            }
+        }
+        return seed;
+    }
+
+    bool operator==(const ReorderKey& rhs) const {
+        return src == rhs.src && dest == rhs.dest;
+    }
+};
+
+struct ReorderPrimitive {
+    std::shared_ptr<mkldnn::primitive> prim;
+    impl_desc_type implType;
+};
+
+}  // namespace
+
 MKLDNNReorderNode::MKLDNNReorderNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &w_cache) :
         MKLDNNNode(op, eng, w_cache) {
     IE_THROW() << "Can't create reorder node from ngraph node";
@@ -176,17 +216,22 @@ void MKLDNNReorderNode::createReorderPrimitive(const mkldnn::memory::desc &srcDe
     dst_blocked->Create(MKLDNNExtensionUtils::makeDescriptor(dstDesc), dstPtr, false);
 
     mkldnn::primitive_attr attr;
-    auto createReorder = [&]() -> bool {
+    auto builder = [&](const ReorderKey& key) -> ReorderPrimitive {
         // No autoblocking. Reorder can be applied as is
-        reorder::primitive_desc pd = mkldnn::reorder::primitive_desc(src_blocked->GetPrimitive(), dst_blocked->GetPrimitive(), attr, true);
-
+        reorder::primitive_desc pd = mkldnn::reorder::primitive_desc(getEngine(), key.src, getEngine(), key.dest, attr, true);
         if (!pd)
-            return false;
+            return {nullptr, impl_desc_type::undef};
 
-        auto info = pd.impl_info_str();
-        supportedPrimitiveDescriptors[0].setImplementationType(parse_impl_name(info));
+        return {std::make_shared<mkldnn::reorder>(pd), parse_impl_name(pd.impl_info_str())};
+    };
+    auto createReorder = [&]() -> bool {
+        const ReorderKey key = {src_blocked->GetPrimitive().get_desc(), dst_blocked->GetPrimitive().get_desc()};
+        const auto result = rtParamsCache ? rtParamsCache->getOrCreate<ReorderKey, ReorderPrimitive>(key, builder) : builder(key);
+        if (!result.prim)
+            return false;
 
-        prim.reset(new mkldnn::reorder(pd));
+        supportedPrimitiveDescriptors[0].setImplementationType(result.implType);
+        prim = result.prim;
         return true;
     };
 
@@ -10,8 +10,10 @@
 #include "mkldnn_input_node.h"
 #include <mkldnn_extension_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "memory_desc/cpu_memory_desc_utils.h"
 
 #include <ngraph/node.hpp>
+#include <low_precision/rt_info/data_dequantization_attribute.hpp>
 
 #include <string>
 #include <utility>
@@ -103,9 +105,9 @@ const std::map<InferenceEngine::Precision, InferenceEngine::Precision> MKLDNNRNN
     // layer precision,                weights precision
     {InferenceEngine::Precision::FP32, InferenceEngine::Precision::FP32},
     {InferenceEngine::Precision::BF16, InferenceEngine::Precision::BF16},
-    // FP16 and U8 are not supported yet
+    {InferenceEngine::Precision::U8,   InferenceEngine::Precision::I8},
+    // FP16 is not supported yet
     // {InferenceEngine::Precision::FP16, InferenceEngine::Precision::FP16},
-    // {InferenceEngine::Precision::U8,   InferenceEngine::Precision::I8},
 };
 
 bool MKLDNNRNN::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
@@ -198,10 +200,10 @@ bool MKLDNNRNN::isSupportedOperation(const std::shared_ptr<const ngraph::Node>&
 MKLDNNRNN::MKLDNNRNN(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
         MKLDNNNode(op, eng, cache) {
     internalBlobDesc.emplace_back([&](primitive_desc_iterator& primitive_desc_it, size_t idx) -> DnnlMemoryDescPtr {
-        return MKLDNNExtensionUtils::makeDescriptor(primitive_desc_it.weights_desc(0));
+        return getWeightsDesc(primitive_desc_it, 0);
     });
     internalBlobDesc.emplace_back([&](primitive_desc_iterator& primitive_desc_it, size_t idx) -> DnnlMemoryDescPtr {
-        return MKLDNNExtensionUtils::makeDescriptor(primitive_desc_it.weights_desc(1));
+        return getWeightsDesc(primitive_desc_it, 1);
     });
     internalBlobDesc.emplace_back([&](primitive_desc_iterator& primitive_desc_it, size_t idx) -> DnnlMemoryDescPtr {
         return MKLDNNExtensionUtils::makeDescriptor(primitive_desc_it.weights_desc(2));
@@ -234,6 +236,14 @@ MKLDNNRNN::MKLDNNRNN(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engi
         wIdx = 4; rIdx = 5; bIdx = 6;
     }
 
+    // low precision transformations leave the dequantization of u8 data and hidden state to the primitive
+    if (ov::has_data_dequantization(op)) {
+        const auto dequantization = ov::get_data_dequantization(op);
+        dataScale = 1.f / dequantization.scale;
+        dataShift = dequantization.shift;
+        weightsDequantizationScales = dequantization.weightsScales;
+    }
+
     if (is_cell)
         initCell(op);
     else
@@ -296,6 +306,8 @@ void MKLDNNRNN::initCell(const std::shared_ptr<ngraph::Node>& op) {
 void MKLDNNRNN::fillCellDesc() {
     runtimePrecision = getOriginalInputPrecisionAtPort(0);
     auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
+    // int8 primitive produces dequantized states
+    auto outDataType = runtimePrecision == Precision::U8 ? memory::data_type::f32 : dataType;
 
     Shape S_4D_shape(VectorDims{L, D, N, SC});
 
@@ -305,10 +317,10 @@ void MKLDNNRNN::fillCellDesc() {
 
     // Shapes and Attributes are correct. Can start internal stuff initialization.
     in_data_d.emplace_back(Shape(VectorDims{T, N, DC}), dataType, memory::format_tag::tnc);
-    out_data_d.emplace_back(Shape(VectorDims{T, N, SC}), dataType, memory::format_tag::tnc);
+    out_data_d.emplace_back(Shape(VectorDims{T, N, SC}), outDataType, memory::format_tag::tnc);
 
     in_data_d.emplace_back(S_4D_shape, dataType, memory::format_tag::ldnc);
-    out_data_d.emplace_back(S_4D_shape, dataType, memory::format_tag::ldnc);
+    out_data_d.emplace_back(S_4D_shape, outDataType, memory::format_tag::ldnc);
 
     if (haveCellState(cell_type)) {
         in_data_d.emplace_back(S_4D_shape, memory::data_type::f32, memory::format_tag::ldnc);
@@ -324,7 +336,7 @@ void MKLDNNRNN::fillCellDesc() {
 
     in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(D_shape, dataType, memory::format_tag::nc));
     in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(S_shape, dataType, memory::format_tag::nc));
-    out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(S_shape, dataType, memory::format_tag::nc));
+    out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(S_shape, outDataType, memory::format_tag::nc));
 
     if (haveCellState(cell_type)) {
         in_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(S_shape, memory::data_type::f32, memory::format_tag::nc));
@@ -390,15 +402,17 @@ void MKLDNNRNN::initSeq(const std::shared_ptr<ngraph::Node>& op) {
 void MKLDNNRNN::fillSeqDesc() {
     runtimePrecision = getOriginalInputPrecisionAtPort(0);
     auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
+    // int8 primitive produces dequantized sequence and states
+    auto outDataType = runtimePrecision == Precision::U8 ? memory::data_type::f32 : dataType;
 
     Shape S_4D_shape(VectorDims{L, D, N, SC});
 
     // Try to create descriptor and corresponding configuration
     in_data_d.emplace_back(Shape(VectorDims{in_data_dims}),  dataType, memory::format_tag::tnc);
-    out_data_d.emplace_back(Shape(VectorDims{out_data_dims}), dataType, memory::format_tag::tnc);
+    out_data_d.emplace_back(Shape(VectorDims{out_data_dims}), outDataType, memory::format_tag::tnc);
 
     in_data_d.emplace_back(S_4D_shape, dataType, memory::format_tag::ldnc);
-    out_data_d.emplace_back(S_4D_shape, dataType, memory::format_tag::ldnc);
+    out_data_d.emplace_back(S_4D_shape, outDataType, memory::format_tag::ldnc);
 
     if (haveCellState(cell_type)) {
         in_data_d.emplace_back(S_4D_shape, memory::data_type::f32, memory::format_tag::ldnc);
@@ -445,16 +459,16 @@ void MKLDNNRNN::fillSeqDesc() {
         out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(out_data_d[RNNInOutKind::Layer]));
     } else if (N == 1) {
         // WA to avoid reorder after sequence for some models
-        out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, T, SC}), dataType, memory::format_tag::tnc));
+        out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, T, SC}), outDataType, memory::format_tag::tnc));
     } else {
-        out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, T, SC}), dataType, memory::format_tag::ntc));
+        out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, T, SC}), outDataType, memory::format_tag::ntc));
     }
 
     // WA to avoid reorder after
     if (D == 1)
-        out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, D, SC}), dataType, memory::format_tag::tnc));
+        out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, D, SC}), outDataType, memory::format_tag::tnc));
     else
-        out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, D, SC}), dataType, memory::format_tag::ntc));
+        out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, D, SC}), outDataType, memory::format_tag::ntc));
 
     if (haveCellState(cell_type)) {
         if (D == 1)
@@ -478,9 +492,11 @@ void MKLDNNRNN::fillWeights(const int *gate_map, const size_t wIdx, const size_t
     if (!verifyWeightsPrecision(runtimePrecision, weightPrec) && runtimePrecision != Precision::BF16 && weightPrec != Precision::FP32) {
         IE_THROW() << "Doesn't support combination of weights precision: " << weightPrec << " and runtime precision: " << runtimePrecision;
     }
+    // int8 weights are filled in fp32, they are quantized while reordering to the primitive format
+    const auto targetWeightPrec = runtimePrecision == Precision::U8 ? Precision::FP32 : runtimePrecision;
     // create weight blobs (data and state part)
     InferenceEngine::SizeVector dims_w = { L, D, DC, G, SC };
-    InferenceEngine::TensorDesc w_data_desc(runtimePrecision, dims_w, getWeightsLayoutByDims(dims_w, false));
+    InferenceEngine::TensorDesc w_data_desc(targetWeightPrec, dims_w, getWeightsLayoutByDims(dims_w, false));
     Blob::Ptr w_data_mem = InferenceEngine::make_shared_blob<Prec>(w_data_desc);
     w_data_mem->allocate();
     auto w_ptr = static_cast<Prec*>(w_data_mem->buffer());
@@ -488,7 +504,7 @@ void MKLDNNRNN::fillWeights(const int *gate_map, const size_t wIdx, const size_t
         IE_THROW(NotAllocated) << "Internal blob was not allocated for node " << getName() << ".";
 
     InferenceEngine::SizeVector dims_s = { L, D, SC, G, SC };
-    InferenceEngine::TensorDesc w_state_desc(runtimePrecision, dims_s, getWeightsLayoutByDims(dims_s, false));
+    InferenceEngine::TensorDesc w_state_desc(targetWeightPrec, dims_s, getWeightsLayoutByDims(dims_s, false));
     Blob::Ptr w_state_mem = InferenceEngine::make_shared_blob<Prec>(w_state_desc);
     w_state_mem->allocate();
     auto r_ptr = static_cast<Prec*>(w_state_mem->buffer());
@@ -508,8 +524,8 @@ void MKLDNNRNN::fillWeights(const int *gate_map, const size_t wIdx, const size_t
 
     auto ie_w_ptr = ie_w_vec.data();
     auto ie_r_ptr = ie_r_vec.data();
-    cpu_convert(wConstBlob->GetPtr(), ie_w_ptr, weightPrec, runtimePrecision, ie_w_vec_size);
-    cpu_convert(rConstBlob->GetPtr(), ie_r_ptr, weightPrec, runtimePrecision, ie_r_vec_size);
+    cpu_convert(wConstBlob->GetPtr(), ie_w_ptr, weightPrec, targetWeightPrec, ie_w_vec_size);
+    cpu_convert(rConstBlob->GetPtr(), ie_r_ptr, weightPrec, targetWeightPrec, ie_r_vec_size);
 
     const int step = SC * G;
 
@@ -631,20 +647,87 @@ void MKLDNNRNN::copyWeightsData() {
         if (T != 1 || N < 16)
             w_format = mkldnn::memory::format_tag::ldigo;
         fillWeights<float>(gate_map, wIdx, rIdx);
-    } else {// TODO FP16 and INT8 support
+    } else if (runtimePrecision == Precision::U8) {
+        if (cell_type != mkldnn::algorithm::vanilla_lstm)
+            IE_THROW() << "Node " << getName() << " supports u8 data for LSTM cell only";
+        fillWeights<float>(gate_map, wIdx, rIdx);
+        fillWeightsScales(gate_map);
+    } else {// TODO FP16 support
         IE_THROW() << "Unsupported data type";
     }
 
-    if (runtimePrecision == Precision::BF16 || runtimePrecision == Precision::FP32)
-        fillBiases<Precision::FP32>(gate_map);
+    fillBiases<Precision::FP32>(gate_map);
+}
+
+void MKLDNNRNN::fillWeightsScales(const int *gate_map) {
+    // the weights are folded from the signed quantization, so they are quantized back exactly with its scales
+    const size_t channels = G * SC;
+    if (weightsDequantizationScales.size() != channels)
+        IE_THROW() << "Node " << getName() << " has " << weightsDequantizationScales.size()
+                   << " weights dequantization scales instead of " << channels;
+
+    // weights are filled in ldigo layout, so a gate and an output channel form the innermost index
+    weightsScales.resize(channels);
+    for (size_t g = 0; g < G; g++) {
+        for (size_t out_i = 0; out_i < SC; out_i++)
+            weightsScales[g * SC + out_i] = 1.f / weightsDequantizationScales[gate_map[g] * SC + out_i];
+    }
+}
+
+DnnlMemoryDescPtr MKLDNNRNN::getWeightsDesc(primitive_desc_iterator& primitive_desc_it, size_t idx) const {
+    // int8 weights stay in fp32 until the quantizing reorder in createPrimitive
+    if (runtimePrecision == Precision::U8)
+        return std::make_shared<DnnlBlockedMemoryDesc>(MemoryDescUtils::convertToDnnlBlockedMemoryDesc(internalBlobs[idx]->getTensorDesc()));
+    return MKLDNNExtensionUtils::makeDescriptor(primitive_desc_it.weights_desc(idx));
+}
+
+mkldnn::primitive_attr MKLDNNRNN::initPrimitiveAttr() const {
+    mkldnn::primitive_attr attr;
+    if (runtimePrecision == Precision::U8) {
+        attr.set_rnn_data_qparams(dataScale, dataShift);
+        // scales vary along the gates and output channels dimensions of ldigo weights
+        attr.set_rnn_weights_qparams((1 << 3) | (1 << 4), weightsScales);
+    }
+    return attr;
+}
+
+void MKLDNNRNN::prepareQuantizedWeights(const mkldnn::primitive_attr& attr,
+                                        const mkldnn::memory::desc& wDataDesc,
+                                        const mkldnn::memory::desc& wStateDesc) {
+    // Packed int8 weights carry the compensation of the data shift, which is computed by the reorder
+    // from the quantization attributes, so the reorder of the common internal blobs preparation can't be used
+    const mkldnn::memory::desc dstDescs[] = {wDataDesc, wStateDesc};
+    for (size_t i = 0; i < 2; i++) {
+        auto create = [&] () {
+            const auto& src = internalBlobMemory[i];
+            MKLDNNMemoryPtr dst = std::make_shared<MKLDNNMemory>(getEngine());
+            dst->Create(MKLDNNExtensionUtils::makeDescriptor(dstDescs[i]));
+
+            mkldnn::reorder quantize(src->GetPrimitive(), dst->GetPrimitive(), attr);
+            mkldnn::stream loc_stream(getEngine(), mkldnn::stream::flags::in_order);
+            quantize.execute(loc_stream, *src->GetPrimitivePtr(), *dst->GetPrimitivePtr());
+            return dst;
+        };
+
+        if (weightCache != nullptr) {
+            const auto& internalBlob = internalBlobs[i];
+            const uint64_t data_hash = weightCache->GetHashFunc().hash(internalBlob->buffer(), internalBlob->byteSize());
+            const std::string string_hash = getName() + "_s8_" + std::to_string(i)
+                                            + "_" + std::to_string(internalBlob->byteSize())
+                                            + "_" + std::to_string(data_hash);
+            internalBlobMemory[i] = *weightCache->findOrCreate(string_hash, create);
+        } else {
+            internalBlobMemory[i] = create();
+        }
+    }
 }
 void MKLDNNRNN::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                  const std::vector<MemoryDescPtr> &outputDesc) {
-    auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
+    auto weightsDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(weightsByLayerPrec.at(runtimePrecision));
     auto weightsDims = MKLDNNExtensionUtils::convertToDnnlDims(VectorDims{ L, D, DC, G, SC });
-    mkldnn::memory::desc w_data_d(weightsDims, dataType, w_format);
+    mkldnn::memory::desc w_data_d(weightsDims, weightsDataType, w_format);
     auto statesDims = MKLDNNExtensionUtils::convertToDnnlDims(VectorDims{ L, D, SC, G, SC });
-    mkldnn::memory::desc w_state_d(statesDims, dataType, w_format);
+    mkldnn::memory::desc w_state_d(statesDims, weightsDataType, w_format);
     auto biasDims = MKLDNNExtensionUtils::convertToDnnlDims(VectorDims{ L, D, Gb, SC });
     mkldnn::memory::desc w_bias_d(biasDims, memory::data_type::f32, memory::format_tag::ldgo);
 
@@ -726,18 +809,21 @@ void MKLDNNRNN::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
 }
 
 void MKLDNNRNN::createPrimitive() {
+    const auto attr = initPrimitiveAttr();
     if (cell_type == mkldnn::algorithm::vanilla_rnn) {
-        auto prim_desc = createPrimitiveDescriptor<vanilla_rnn_forward::primitive_desc, vanilla_rnn_forward::desc>();
+        auto prim_desc = createPrimitiveDescriptor<vanilla_rnn_forward::primitive_desc, vanilla_rnn_forward::desc>(attr);
         prim.reset(new vanilla_rnn_forward(prim_desc));
     } else if (cell_type == mkldnn::algorithm::vanilla_gru) {
-        auto prim_desc = createPrimitiveDescriptor<gru_forward::primitive_desc, gru_forward::desc>();
+        auto prim_desc = createPrimitiveDescriptor<gru_forward::primitive_desc, gru_forward::desc>(attr);
         prim.reset(new gru_forward(prim_desc));
     } else if (cell_type == mkldnn::algorithm::lbr_gru) {
-        auto prim_desc = createPrimitiveDescriptor<lbr_gru_forward::primitive_desc, lbr_gru_forward::desc>();
+        auto prim_desc = createPrimitiveDescriptor<lbr_gru_forward::primitive_desc, lbr_gru_forward::desc>(attr);
         prim.reset(new lbr_gru_forward(prim_desc));
     } else if (cell_type == mkldnn::algorithm::vanilla_lstm) {
-        auto prim_desc = createPrimitiveDescriptor<lstm_forward::primitive_desc, lstm_forward::desc>();
+        auto prim_desc = createPrimitiveDescriptor<lstm_forward::primitive_desc, lstm_forward::desc>(attr);
         prim.reset(new lstm_forward(prim_desc));
+        if (runtimePrecision == Precision::U8)
+            prepareQuantizedWeights(attr, prim_desc.weights_layer_desc(), prim_desc.weights_iter_desc());
     } else {
         IE_THROW() << "Unknown cell type";
     }
@@ -43,9 +43,16 @@ private:
     void fillWeights(const int* gate_map, const size_t wIdx, const size_t rIdx);
     template <InferenceEngine::Precision::ePrecision Prec>
     void fillBiases(const int* gate_map);
+    void fillWeightsScales(const int* gate_map);
 
     void copyWeightsData();
 
+    DnnlMemoryDescPtr getWeightsDesc(mkldnn::primitive_desc_iterator& primitive_desc_it, size_t idx) const;
+    mkldnn::primitive_attr initPrimitiveAttr() const;
+    void prepareQuantizedWeights(const mkldnn::primitive_attr& attr,
+                                 const mkldnn::memory::desc& wDataDesc,
+                                 const mkldnn::memory::desc& wStateDesc);
+
 private:
     InferenceEngine::Precision runtimePrecision;
     /** Specify mode Cell or Seq. true - Cell, false - Seq */
@@ -93,6 +100,14 @@ private:
     size_t rIdx = 0;
     size_t bIdx = 0;
 
+    /** u8 data and hidden state are quantized as u8 = f32 * dataScale + dataShift */
+    float dataScale = 1.f;
+    float dataShift = 0.f;
+    /** Dequantization scales of the data and the state weights per output channel in the gate order of the operation */
+    std::vector<float> weightsDequantizationScales;
+    /** Scales of s8 weights per gate and output channel, shared by the data and the state weights */
+    std::vector<float> weightsScales;
+
     static const std::map<InferenceEngine::Precision, InferenceEngine::Precision> weightsByLayerPrec;
 };
 
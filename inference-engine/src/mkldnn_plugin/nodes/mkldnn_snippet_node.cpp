@@ -0,0 +1,278 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_snippet_node.h"
+
+#include <ie_parallel.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/runtime/host_tensor.hpp>
+
+#include "emitters/cpu_generator.hpp"
+#include "emitters/jit_snippets_emitters.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl::cpu::x64;
+
+bool MKLDNNSnippetNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (isDynamicNgraphNode(op)) {
+            errorMessage = "Doesn't support op with dynamic shapes";
+            return false;
+        }
+        const auto subgraph = std::dynamic_pointer_cast<const ngraph::snippets::op::Subgraph>(op);
+        if (!subgraph) {
+            errorMessage = "Only snippets Subgraph operation is supported";
+            return false;
+        }
+        for (const auto& input : op->inputs()) {
+            if (input.get_element_type() != ngraph::element::f32) {
+                errorMessage = "Only f32 inputs are supported";
+                return false;
+            }
+        }
+        for (const auto& output : op->outputs()) {
+            if (output.get_element_type() != ngraph::element::f32) {
+                errorMessage = "Only f32 outputs are supported";
+                return false;
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNSnippetNode::MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "Subgraph node with name '" + op->get_friendly_name() + "'";
+    original = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(op);
+    hostIsa = mayiuse(avx512_common) ? avx512_common : avx2;
+
+    // the copy is connected to its own parameters, so the ngraph function the node was created from is not modified
+    ngraph::OutputVector subgraphInputs;
+    for (const auto& input : original->input_values()) {
+        subgraphInputs.push_back(std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape()));
+    }
+    snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraphInputs, ngraph::clone_function(*original->get_body()));
+    ngraph::copy_runtime_info(original, snippet);
+    snippet->set_friendly_name(original->get_friendly_name());
+}
+
+bool MKLDNNSnippetNode::canUseJit() const {
+    if (!mayiuse(avx2))
+        return false;
+    if (inputShapes.size() + outputShapes.size() > SNIPPETS_MAX_SNIPPETS_PTRS)
+        return false;
+
+    // the kernel writes all the outputs with the same pointer increments
+    const auto& outDims = getOutputShapeAtPort(0).getStaticDims();
+    for (size_t i = 1; i < outputShapes.size(); i++) {
+        if (getOutputShapeAtPort(i).getStaticDims() != outDims)
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    useJit = canUseJit();
+
+    std::vector<PortConfigurator> inConfs;
+    for (size_t i = 0; i < inputShapes.size(); i++)
+        inConfs.push_back({LayoutType::ncsp, Precision::FP32});
+    std::vector<PortConfigurator> outConfs;
+    for (size_t i = 0; i < outputShapes.size(); i++)
+        outConfs.push_back({LayoutType::ncsp, Precision::FP32});
+
+    impl_desc_type implType = impl_desc_type::ref;
+    if (useJit)
+        implType = hostIsa == avx512_common ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+
+    addSupportedPrimDesc(inConfs, outConfs, implType);
+}
+
+void MKLDNNSnippetNode::createPrimitive() {
+    if (!useJit)
+        return;
+
+    defineSchedule();
+    generate();
+}
+
+void MKLDNNSnippetNode::generate() {
+    auto toBlockedShape = [](const VectorDims& dims) {
+        ngraph::Shape shape(dims.begin(), dims.end());
+        ngraph::AxisVector order(shape.size());
+        std::iota(order.begin(), order.end(), 0);
+        return ngraph::snippets::op::Subgraph::BlockedShape{shape, order, ngraph::element::f32};
+    };
+
+    ngraph::snippets::op::Subgraph::BlockedShapeVector inputBlockedShapes;
+    for (size_t i = 0; i < inputShapes.size(); i++)
+        inputBlockedShapes.push_back(toBlockedShape(getInputShapeAtPort(i).getStaticDims()));
+    ngraph::snippets::op::Subgraph::BlockedShapeVector outputBlockedShapes;
+    for (size_t i = 0; i < outputShapes.size(); i++)
+        outputBlockedShapes.push_back(toBlockedShape(getOutputShapeAtPort(i).getStaticDims()));
+
+    snippet->set_generator(std::make_shared<CPUGenerator>(hostIsa));
+    try {
+        schedule = snippet->generate(outputBlockedShapes, inputBlockedShapes);
+    } catch (const ngraph::ngraph_error&) {
+        // the body contains operations the target machine can't lower, such subgraph is evaluated by ngraph
+        useJit = false;
+    }
+}
+
+void MKLDNNSnippetNode::defineSchedule() {
+    const auto& outDims = getOutputShapeAtPort(0).getStaticDims();
+    const size_t rank = std::max<size_t>(outDims.size(), 1);
+    auto padded = [rank](const VectorDims& dims) {
+        VectorDims result(rank - dims.size(), 1);
+        result.insert(result.end(), dims.begin(), dims.end());
+        return result;
+    };
+
+    std::vector<VectorDims> tensorDims;
+    for (size_t i = 0; i < inputShapes.size(); i++)
+        tensorDims.push_back(padded(getInputShapeAtPort(i).getStaticDims()));
+    for (size_t i = 0; i < outputShapes.size(); i++)
+        tensorDims.push_back(padded(getOutputShapeAtPort(i).getStaticDims()));
+    VectorDims dims = padded(outDims);
+
+    // The kernel is generated for the innermost dimension, so an outer dimension is collapsed into it only if every tensor
+    // keeps the same kind of access: either dense along both dimensions or broadcasted along both of them
+    while (dims.size() > 1 && dims.back() != 1) {
+        const size_t d = dims.size() - 2;
+        const bool canCollapse = std::all_of(tensorDims.begin(), tensorDims.end(), [&](const VectorDims& t) {
+            const bool dense = t.back() == dims.back() && t[d] == dims[d];
+            const bool broadcasted = t.back() == 1 && t[d] == 1;
+            return dense || broadcasted;
+        });
+        if (!canCollapse)
+            break;
+
+        dims[d] *= dims.back();
+        dims.pop_back();
+        for (auto& t : tensorDims) {
+            t[d] *= t.back();
+            t.pop_back();
+        }
+    }
+
+    outerDims.assign(dims.begin(), dims.end() - 1);
+    outerWorkAmount = std::accumulate(outerDims.begin(), outerDims.end(), size_t(1), std::multiplies<size_t>());
+    innerWorkAmount = dims.back();
+
+    outerStrides.clear();
+    innerStrides.clear();
+    for (const auto& t : tensorDims) {
+        std::vector<size_t> strides(t.size());
+        size_t stride = sizeof(float);
+        for (int d = static_cast<int>(t.size()) - 1; d >= 0; d--) {
+            strides[d] = t[d] == 1 && dims[d] != 1 ? 0 : stride;
+            stride *= t[d];
+        }
+        innerStrides.push_back(strides.back());
+        strides.pop_back();
+        outerStrides.push_back(strides);
+    }
+
+    // when outer dimensions don't provide enough parallel work the innermost one is split into chunks
+    // which are multiple of the widest vector, so only the last chunk has a tail
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    const size_t minChunk = 256;
+    innerChunksNum = 1;
+    if (outerWorkAmount < nthr)
+        innerChunksNum = std::max<size_t>(1, std::min(div_up(nthr, outerWorkAmount), innerWorkAmount / minChunk));
+    innerChunk = rnd_up(div_up(innerWorkAmount, innerChunksNum), 16);
+    innerChunksNum = div_up(innerWorkAmount, innerChunk);
+}
+
+void MKLDNNSnippetNode::executeJit() {
+    const size_t numInputs = inputShapes.size();
+    const size_t numPtrs = numInputs + outputShapes.size();
+
+    std::vector<const uint8_t*> basePtrs(numPtrs);
+    for (size_t i = 0; i < numInputs; i++)
+        basePtrs[i] = reinterpret_cast<const uint8_t*>(getParentEdgesAtPort(i)[0]->getMemoryPtr()->GetPtr());
+    for (size_t i = 0; i < outputShapes.size(); i++)
+        basePtrs[numInputs + i] = reinterpret_cast<const uint8_t*>(getChildEdgesAtPort(i)[0]->getMemoryPtr()->GetPtr());
+
+    const auto callable = schedule.get_callable<void (*)(const jit_snippets_call_args*)>();
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(outerWorkAmount * innerChunksNum, nthr, ithr, start, end);
+
+        jit_snippets_call_args args;
+        size_t offsets[SNIPPETS_MAX_SNIPPETS_PTRS];
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            const size_t chunk = iwork % innerChunksNum;
+            for (size_t i = 0; i < numPtrs; i++)
+                offsets[i] = chunk * innerChunk * innerStrides[i];
+
+            size_t outer = iwork / innerChunksNum;
+            for (int d = static_cast<int>(outerDims.size()) - 1; d >= 0; d--) {
+                const size_t idx = outer % outerDims[d];
+                outer /= outerDims[d];
+                for (size_t i = 0; i < numPtrs; i++)
+                    offsets[i] += idx * outerStrides[i][d];
+            }
+
+            for (size_t i = 0; i < numPtrs; i++)
+                args.ptrs[i] = basePtrs[i] + offsets[i];
+            args.work_amount = std::min(innerChunk, innerWorkAmount - chunk * innerChunk);
+            callable(&args);
+        }
+    });
+}
+
+void MKLDNNSnippetNode::executeReference() {
+    ngraph::HostTensorVector inputs;
+    for (size_t i = 0; i < inputShapes.size(); i++) {
+        void *srcDataPtr = getParentEdgesAtPort(i)[0]->getMemory().GetPtr();
+        inputs.push_back(std::make_shared<ngraph::HostTensor>(original->get_input_element_type(i), original->get_input_shape(i), srcDataPtr));
+    }
+
+    ngraph::HostTensorVector outputs;
+    for (size_t i = 0; i < outputShapes.size(); i++) {
+        void *dstDataPtr = getChildEdgesAtPort(i)[0]->getMemory().GetPtr();
+        outputs.push_back(std::make_shared<ngraph::HostTensor>(original->get_output_element_type(i), original->get_output_shape(i), dstDataPtr));
+    }
+
+    OPENVINO_SUPPRESS_DEPRECATED_START
+    if (!original->evaluate(outputs, inputs)) {
+        IE_THROW() << errorPrefix << " evaluation failed";
+    }
+    OPENVINO_SUPPRESS_DEPRECATED_END
+}
+
+void MKLDNNSnippetNode::execute(mkldnn::stream strm) {
+    if (useJit) {
+        executeJit();
+    } else {
+        executeReference();
+    }
+}
+
+bool MKLDNNSnippetNode::created() const {
+    return getType() == Subgraph;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNSnippetNode, Subgraph);
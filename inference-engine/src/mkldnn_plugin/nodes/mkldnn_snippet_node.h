@@ -0,0 +1,63 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include "snippets/op/subgraph.hpp"
+
+#include <string>
+#include <vector>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Executes subgraph of elementwise operations collapsed by the snippets tokenization in a single pass over memory.
+ * The body is compiled with the snippets generator to a kernel which processes the innermost dimension,
+ * the node schedules the kernel over the outer dimensions. Subgraphs which can't be compiled are evaluated by ngraph.
+ */
+class MKLDNNSnippetNode : public MKLDNNNode {
+public:
+    MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    bool canUseJit() const;
+    void generate();
+    void defineSchedule();
+    void executeJit();
+    void executeReference();
+
+    // original subgraph is kept intact for the reference evaluation, code generation transforms the body of its copy
+    std::shared_ptr<ngraph::snippets::op::Subgraph> original;
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+    ngraph::snippets::Schedule schedule;
+
+    mkldnn::impl::cpu::x64::cpu_isa_t hostIsa;
+    bool useJit = false;
+
+    // schedule of the kernel calls: the kernel processes innerChunk elements of the innermost dimension per call
+    std::vector<size_t> outerDims;
+    size_t outerWorkAmount = 1;
+    size_t innerWorkAmount = 1;
+    size_t innerChunk = 1;
+    size_t innerChunksNum = 1;
+    // strides in bytes for the outer dimensions and for the innermost one (0 for broadcasted tensors), inputs go first
+    std::vector<std::vector<size_t>> outerStrides;
+    std::vector<size_t> innerStrides;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
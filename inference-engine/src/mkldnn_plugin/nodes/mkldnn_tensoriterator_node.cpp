@@ -12,6 +12,8 @@
 #include <utils/general_utils.h>
 #include "common/blocked_desc_creator.h"
 #include "utils/ngraph_utils.hpp"
+#include "mkldnn_concat_node.h"
+#include "mkldnn_split_node.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -48,11 +50,16 @@ static NodeConfig make_plain_config(const std::shared_ptr<ngraph::Node>& op) {
     return config;
 }
 
+/**
+ * Moves a chunk of the sliced tensor to the body or back. If views are provided, the chunk is dense and has
+ * the same layout as the body tensor, so the body memory is redirected to the chunk instead of the copy.
+ */
 class PortIteratorHelper : public PortMapHelper {
 public:
     PortIteratorHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, bool sliced_src,
-                       const PortMap &slice_rule, const mkldnn::engine& eng)
-                       : sliced_src(sliced_src) {
+                       const PortMap &slice_rule, const mkldnn::engine& eng,
+                       const std::vector<MKLDNNMemoryPtr> &views = {})
+                       : sliced_src(sliced_src), views(views) {
         const auto &full_blob = sliced_src ? from : to;
         const auto &part_blob = !sliced_src ? from : to;
 
@@ -98,9 +105,17 @@ public:
     void execute(mkldnn::stream strm, int iter) override {
         IE_ASSERT(iter >= 0 && iter < iter_count);
 
+        auto chunk_ptr = static_cast<uint8_t *>(full_mem.get_data_handle()) +
+                chunk_offset_in_byte + chunk_stride_in_byte * iter;
+
+        if (!views.empty()) {
+            for (auto &view : views)
+                view->GetPrimitivePtr()->set_data_handle(chunk_ptr);
+            return;
+        }
+
         auto &chunk_mem = sliced_src ? mem_holder_src : mem_holder_dst;
-        chunk_mem.set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) +
-                chunk_offset_in_byte + chunk_stride_in_byte * iter);
+        chunk_mem.set_data_handle(chunk_ptr);
 
         reorder.execute(strm, mem_holder_src, mem_holder_dst);
     }
@@ -111,6 +126,7 @@ private:
 
     bool sliced_src;
     mkldnn::memory full_mem;
+    std::vector<MKLDNNMemoryPtr> views;
 
     int iter_count;
 };
@@ -130,6 +146,35 @@ public:
     }
 };
 
+/**
+ * Passes the body output to the next iteration by swapping memory of the body output and input:
+ * the input reads the buffer produced on the previous iteration, the output writes to the buffer
+ * which has already been consumed.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const std::vector<MKLDNNMemoryPtr> &from_views, const std::vector<MKLDNNMemoryPtr> &to_views)
+                       : from_views(from_views), to_views(to_views) {
+        IE_ASSERT(!from_views.empty() && !to_views.empty());
+    }
+
+    void execute(mkldnn::stream strm, int iter) override {
+        if (iter == 0)
+            return;
+
+        auto produced = from_views.front()->GetPrimitive().get_data_handle();
+        auto consumed = to_views.front()->GetPrimitive().get_data_handle();
+        for (auto &view : to_views)
+            view->GetPrimitivePtr()->set_data_handle(produced);
+        for (auto &view : from_views)
+            view->GetPrimitivePtr()->set_data_handle(consumed);
+    }
+
+private:
+    std::vector<MKLDNNMemoryPtr> from_views;
+    std::vector<MKLDNNMemoryPtr> to_views;
+};
+
 class IterCountPortHelper : public PortMapHelper {
 public:
     IterCountPortHelper(const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
@@ -195,6 +240,65 @@ private:
     int value;
 };
 
+/**
+ * Returns memory of all the edges which read the body input if they may be redirected to external data:
+ * the consumers don't modify the input in place and don't keep own pointers to it.
+ */
+static std::vector<MKLDNNMemoryPtr> getInputViews(const MKLDNNNodePtr &inNode) {
+    std::vector<MKLDNNMemoryPtr> views;
+    for (size_t i = 0; i < inNode->getChildEdges().size(); i++) {
+        auto edge = inNode->getChildEdgeAt(i);
+        auto child = edge->getChild();
+        if (child->isConstant() || child->isInplace() || one_of(child->getType(), Output, Split))
+            return {};
+
+        auto concat = dynamic_cast<MKLDNNConcatNode*>(child.get());
+        if (concat && concat->isOptimized())
+            return {};
+
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetPtr() == edge->getMemory().GetPtr())
+                return {};
+        }
+        views.push_back(edge->getMemoryPtr());
+    }
+    return views;
+}
+
+/**
+ * Returns memory of the edge which holds the body output if its producer may write to external data:
+ * the output isn't read by other body nodes and doesn't share memory with the producer inputs.
+ */
+static std::vector<MKLDNNMemoryPtr> getOutputViews(const MKLDNNNodePtr &outNode) {
+    auto edge = outNode->getParentEdgeAt(0);
+    auto parent = edge->getParent();
+    if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace() || parent->getType() == Input)
+        return {};
+
+    for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
+        if (parent->getParentEdgeAt(i)->getMemory().GetPtr() == edge->getMemory().GetPtr())
+            return {};
+    }
+    return {edge->getMemoryPtr()};
+}
+
+/**
+ * Checks if the chunk of the sliced tensor is a dense block with the same layout as the body tensor,
+ * so the body may work with the chunk directly.
+ */
+static bool isDenseChunk(const MKLDNNMemoryPtr &full, const MKLDNNMemoryPtr &part, int axis) {
+    if (full->GetDataType() != part->GetDataType() ||
+        !full->getDesc().hasLayoutType(LayoutType::ncsp) || !part->getDesc().hasLayoutType(LayoutType::ncsp))
+        return false;
+
+    const auto &full_dims = full->GetShape().getStaticDims();
+    for (int i = 0; i < axis; i++) {
+        if (full_dims[i] != 1)
+            return false;
+    }
+    return true;
+}
+
 }  // namespace MKLDNNPlugin
 
 int getNumIteration(const std::shared_ptr<const ngraph::Node>& op, const std::vector<PortMap>& inputPortMap, const std::vector<PortMap>& outputPortMap) {
@@ -308,6 +412,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         IE_THROW() << "Can't cast TensorIterator node with name: " << getName() << " to ngraph::op::util::SubGraphOp";
     }
     const std::shared_ptr<const ngraph::Function> body = tiOp->get_function();
+    sub_graph.setRuntimeCache(rtParamsCache);
     sub_graph.CreateGraph(body, ext_mng, weightCache);
 
     const auto &inMap = sub_graph.GetInputNodesMap();
@@ -316,6 +421,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         if (inNode != inMap.end()) {
             auto inMem = inNode->second->getChildEdgeAt(0)->getMemoryPtr();
             input_mem.push_back(inMem);
+            input_views.push_back(getInputViews(inNode->second));
         }
     }
 
@@ -330,6 +436,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         if (outNode != outMap.end()) {
             auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
             output_mem.push_back(outMem);
+            output_views.push_back(getOutputViews(outNode->second));
         }
     }
 
@@ -412,12 +519,26 @@ void MKLDNNTensorIteratorNode::initSupportedPrimitiveDescriptors() {
 void MKLDNNTensorIteratorNode::createPrimitive() {
     const auto &eng = getEngine();
 
+    // A body output may be redirected only by one port rule, otherwise the rules would fight for its memory
+    std::vector<int> output_uses(output_mem.size(), 0);
+    for (const auto &map_rule : outputPortMap)
+        output_uses[map_rule.to]++;
+    for (const auto &map_rule : backEdges)
+        output_uses[map_rule.from]++;
+    if (loopBodyConditionOutputIdx != -1)
+        output_uses[loopBodyConditionOutputIdx]++;
+    auto canRedirectOutput = [&](int idx) {
+        return output_uses[idx] == 1 && !output_views[idx].empty();
+    };
+
     for (auto map_rule : inputPortMap) {
         auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &to_mem = input_mem[map_rule.to];
 
         if (map_rule.axis == -1)
             first_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        else if (!input_views[map_rule.to].empty() && isDenseChunk(from_mem, to_mem, map_rule.axis))
+            before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, true, map_rule, eng, input_views[map_rule.to]));
         else
             before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, true, map_rule, eng));
     }
@@ -428,6 +549,9 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
 
         if (map_rule.axis == -1)
             last_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        else if (canRedirectOutput(map_rule.to) && isDenseChunk(to_mem, from_mem, map_rule.axis))
+            // the body writes to the chunk directly, so the memory is redirected before the iteration
+            before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, false, map_rule, eng, output_views[map_rule.to]));
         else
             after_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, false, map_rule, eng));
     }
@@ -436,7 +560,11 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mem[map_rule.to];
 
-        before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        if (canRedirectOutput(map_rule.from) && !input_views[map_rule.to].empty() &&
+                from_mem->getDesc().isCompatible(to_mem->getDesc()))
+            before_mappers.emplace_back(new BackEdgeSwapHelper(output_views[map_rule.from], input_views[map_rule.to]));
+        else
+            before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
     }
 
     // special purpose ports
@@ -74,6 +74,8 @@ private:
     MKLDNNExtensionManager::Ptr ext_mng;
     MKLDNNGraph sub_graph;
     std::vector<MKLDNNMemoryPtr> input_mem, output_mem;
+    // memory of the body edges which may be redirected to external data instead of copying, empty if it's not allowed
+    std::vector<std::vector<MKLDNNMemoryPtr>> input_views, output_views;
 
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
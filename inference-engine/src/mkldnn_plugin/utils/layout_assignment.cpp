@@ -0,0 +1,220 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "layout_assignment.h"
+
+#include <ie_common.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_set>
+
+namespace MKLDNNPlugin {
+
+size_t LayoutAssignment::addNode(std::vector<float> costs, size_t initial) {
+    if (costs.empty() || initial >= costs.size())
+        IE_THROW() << "LayoutAssignment: node must have candidates and the initial candidate must be one of them";
+    nodes.push_back({std::move(costs), initial, {}, {}});
+    return nodes.size() - 1;
+}
+
+void LayoutAssignment::addEdge(size_t parent, size_t child, std::vector<float> costs) {
+    if (parent >= child || child >= nodes.size())
+        IE_THROW() << "LayoutAssignment: edge " << parent << " -> " << child << " doesn't follow the topological order";
+    if (costs.size() != nodes[parent].costs.size() * nodes[child].costs.size())
+        IE_THROW() << "LayoutAssignment: edge " << parent << " -> " << child << " has wrong number of transition costs";
+    nodes[parent].outEdges.push_back(edges.size());
+    nodes[child].inEdges.push_back(edges.size());
+    edges.push_back({parent, child, std::move(costs)});
+}
+
+float LayoutAssignment::getTotalCost() const {
+    float cost = 0.f;
+    for (const auto& node : nodes)
+        cost += node.costs[node.selected];
+    for (const auto& edge : edges)
+        cost += edgeCost(edge, nodes[edge.parent].selected, nodes[edge.child].selected);
+    return cost;
+}
+
+float LayoutAssignment::localCost(size_t node, size_t candidate) const {
+    float cost = nodes[node].costs[candidate];
+    for (auto e : nodes[node].inEdges)
+        cost += edgeCost(edges[e], nodes[edges[e].parent].selected, candidate);
+    for (auto e : nodes[node].outEdges)
+        cost += edgeCost(edges[e], candidate, nodes[edges[e].child].selected);
+    return cost;
+}
+
+float LayoutAssignment::neighbourhoodCost(const std::vector<size_t>& neighbourhood) const {
+    float cost = 0.f;
+    std::unordered_set<size_t> visitedEdges;
+    for (auto node : neighbourhood) {
+        cost += nodes[node].costs[nodes[node].selected];
+        for (auto e : nodes[node].inEdges) {
+            if (visitedEdges.insert(e).second)
+                cost += edgeCost(edges[e], nodes[edges[e].parent].selected, nodes[edges[e].child].selected);
+        }
+        for (auto e : nodes[node].outEdges) {
+            if (visitedEdges.insert(e).second)
+                cost += edgeCost(edges[e], nodes[edges[e].parent].selected, nodes[edges[e].child].selected);
+        }
+    }
+    return cost;
+}
+
+std::vector<std::vector<size_t>> LayoutAssignment::buildChains() const {
+    // u -> v is a chain link if it is the only output of u and the only input of v
+    std::vector<size_t> next(nodes.size(), nodes.size());
+    std::vector<bool> hasPrev(nodes.size(), false);
+    for (size_t u = 0; u < nodes.size(); u++) {
+        if (nodes[u].outEdges.size() != 1)
+            continue;
+        const size_t v = edges[nodes[u].outEdges[0]].child;
+        if (nodes[v].inEdges.size() == 1) {
+            next[u] = v;
+            hasPrev[v] = true;
+        }
+    }
+
+    std::vector<std::vector<size_t>> chains;
+    for (size_t u = 0; u < nodes.size(); u++) {
+        if (hasPrev[u])
+            continue;
+        chains.emplace_back();
+        for (size_t v = u; v < nodes.size(); v = next[v])
+            chains.back().push_back(v);
+    }
+    return chains;
+}
+
+bool LayoutAssignment::solveChain(const std::vector<size_t>& chain) {
+    const size_t length = chain.size();
+
+    // The edges to the nodes out of the chain are accounted in the node costs since these nodes are fixed.
+    // Inner nodes of the chain have a single input and a single output, which are the chain links.
+    std::vector<std::vector<float>> unary(length);
+    for (size_t i = 0; i < length; i++) {
+        const auto& node = nodes[chain[i]];
+        unary[i] = node.costs;
+        for (size_t c = 0; c < node.costs.size(); c++) {
+            if (i == 0) {
+                for (auto e : node.inEdges)
+                    unary[i][c] += edgeCost(edges[e], nodes[edges[e].parent].selected, c);
+            }
+            if (i == length - 1) {
+                for (auto e : node.outEdges)
+                    unary[i][c] += edgeCost(edges[e], c, nodes[edges[e].child].selected);
+            }
+        }
+    }
+
+    float currentCost = unary[0][nodes[chain[0]].selected];
+    for (size_t i = 1; i < length; i++) {
+        const auto& link = edges[nodes[chain[i]].inEdges[0]];
+        currentCost += unary[i][nodes[chain[i]].selected] + edgeCost(link, nodes[chain[i - 1]].selected, nodes[chain[i]].selected);
+    }
+
+    std::vector<float> best = unary[0];
+    std::vector<std::vector<size_t>> from(length);
+    for (size_t i = 1; i < length; i++) {
+        const auto& link = edges[nodes[chain[i]].inEdges[0]];
+        std::vector<float> cur(unary[i].size());
+        from[i].resize(unary[i].size());
+        for (size_t c = 0; c < unary[i].size(); c++) {
+            float minCost = std::numeric_limits<float>::max();
+            for (size_t p = 0; p < best.size(); p++) {
+                const float cost = best[p] + edgeCost(link, p, c);
+                if (cost < minCost) {
+                    minCost = cost;
+                    from[i][c] = p;
+                }
+            }
+            cur[c] = minCost + unary[i][c];
+        }
+        best.swap(cur);
+    }
+
+    const auto last = std::min_element(best.begin(), best.end());
+    // keep the current assignment if there is no noticeable gain
+    if (*last >= currentCost - 1e-6f * std::max(1.f, std::fabs(currentCost)))
+        return false;
+
+    size_t selected = static_cast<size_t>(std::distance(best.begin(), last));
+    for (size_t i = length; i-- > 0;) {
+        nodes[chain[i]].selected = selected;
+        if (i > 0)
+            selected = from[i][selected];
+    }
+    return true;
+}
+
+bool LayoutAssignment::solveNeighbourhood(size_t node) {
+    const size_t initial = nodes[node].selected;
+    std::vector<size_t> neighbourhood{node};
+    for (auto e : nodes[node].inEdges)
+        neighbourhood.push_back(edges[e].parent);
+    for (auto e : nodes[node].outEdges)
+        neighbourhood.push_back(edges[e].child);
+    std::sort(neighbourhood.begin() + 1, neighbourhood.end());
+    neighbourhood.erase(std::unique(neighbourhood.begin() + 1, neighbourhood.end()), neighbourhood.end());
+
+    std::vector<size_t> currentSelection(neighbourhood.size());
+    for (size_t i = 0; i < neighbourhood.size(); i++)
+        currentSelection[i] = nodes[neighbourhood[i]].selected;
+    const float currentCost = neighbourhoodCost(neighbourhood);
+
+    float bestCost = currentCost - 1e-6f * std::max(1.f, std::fabs(currentCost));
+    std::vector<size_t> bestSelection;
+    for (size_t candidate = 0; candidate < nodes[node].costs.size(); candidate++) {
+        if (candidate == initial)
+            continue;
+        nodes[node].selected = candidate;
+        // the neighbours are re-optimized one by one, each one given the choices made for the previous ones
+        for (size_t i = 1; i < neighbourhood.size(); i++) {
+            auto& neighbour = nodes[neighbourhood[i]];
+            float minCost = std::numeric_limits<float>::max();
+            for (size_t c = 0; c < neighbour.costs.size(); c++) {
+                const float cost = localCost(neighbourhood[i], c);
+                if (cost < minCost) {
+                    minCost = cost;
+                    neighbour.selected = c;
+                }
+            }
+        }
+        const float cost = neighbourhoodCost(neighbourhood);
+        if (cost < bestCost) {
+            bestCost = cost;
+            bestSelection.resize(neighbourhood.size());
+            for (size_t i = 0; i < neighbourhood.size(); i++)
+                bestSelection[i] = nodes[neighbourhood[i]].selected;
+        }
+        for (size_t i = 0; i < neighbourhood.size(); i++)
+            nodes[neighbourhood[i]].selected = currentSelection[i];
+    }
+
+    if (bestSelection.empty())
+        return false;
+    for (size_t i = 0; i < neighbourhood.size(); i++)
+        nodes[neighbourhood[i]].selected = bestSelection[i];
+    return true;
+}
+
+void LayoutAssignment::solve(size_t maxIterations) {
+    const auto chains = buildChains();
+    for (size_t iter = 0; iter < maxIterations; iter++) {
+        bool improved = false;
+        for (const auto& chain : chains)
+            improved |= solveChain(chain);
+        for (size_t node = 0; node < nodes.size(); node++) {
+            if (nodes[node].costs.size() > 1)
+                improved |= solveNeighbourhood(node);
+        }
+        if (!improved)
+            break;
+    }
+}
+
+}  // namespace MKLDNNPlugin
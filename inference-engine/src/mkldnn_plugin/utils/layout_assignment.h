@@ -0,0 +1,78 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Assignment of one candidate per node of a DAG minimizing the sum of the node costs and the edge
+ * (transition) costs. Used to select memory layouts of the graph nodes: the node cost estimates the kernel
+ * execution and the edge cost estimates the reorder between the layouts of the producer and the consumer.
+ *
+ * The problem is NP-hard for a general DAG, so it is solved heuristically starting from the initial assignment:
+ * the graph is split into chains of single-producer/single-consumer links, and the optimal assignment of every
+ * chain is found by dynamic programming while the rest of the graph is fixed. The chains are revisited until
+ * the cost stops decreasing. A chain of a single node degenerates into a local search step. Since the nodes where
+ * the graph branches or merges must change the candidate together with their neighbours (a single node switch
+ * only adds reorders), every node is also tried with each of its candidates while its producers and consumers
+ * are re-optimized. A step is applied only if it decreases the cost, so the total cost never exceeds the cost
+ * of the initial assignment.
+ */
+class LayoutAssignment {
+public:
+    /**
+     * @brief Adds a node
+     * @param costs costs of the node candidates, must not be empty
+     * @param initial index of the initially selected candidate
+     * @return index of the node
+     */
+    size_t addNode(std::vector<float> costs, size_t initial);
+
+    /**
+     * @brief Adds an edge between the nodes, the nodes must be added in the topological order
+     * @param costs transition costs in row-major order [parent candidates x child candidates]
+     */
+    void addEdge(size_t parent, size_t child, std::vector<float> costs);
+
+    void solve(size_t maxIterations = 4);
+
+    size_t getSelected(size_t node) const {
+        return nodes[node].selected;
+    }
+
+    float getTotalCost() const;
+
+private:
+    struct Node {
+        std::vector<float> costs;
+        size_t selected;
+        std::vector<size_t> inEdges;
+        std::vector<size_t> outEdges;
+    };
+
+    struct Edge {
+        size_t parent;
+        size_t child;
+        std::vector<float> costs;
+    };
+
+    float edgeCost(const Edge& edge, size_t parentCandidate, size_t childCandidate) const {
+        return edge.costs[parentCandidate * nodes[edge.child].costs.size() + childCandidate];
+    }
+
+    float localCost(size_t node, size_t candidate) const;
+    float neighbourhoodCost(const std::vector<size_t>& neighbourhood) const;
+    std::vector<std::vector<size_t>> buildChains() const;
+    bool solveChain(const std::vector<size_t>& chain);
+    bool solveNeighbourhood(size_t node);
+
+    std::vector<Node> nodes;
+    std::vector<Edge> edges;
+};
+
+}  // namespace MKLDNNPlugin
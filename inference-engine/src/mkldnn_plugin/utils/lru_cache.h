@@ -0,0 +1,161 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * @file contains the caches of runtime parameters (executors, primitives) which nodes with dynamic shapes
+ * prepare for the current input shapes. It allows to avoid JIT compilation when shapes alternate between a few values.
+ */
+
+namespace MKLDNNPlugin {
+
+template <typename T>
+inline size_t hash_combine(size_t seed, const T& value) {
+    return seed ^ (std::hash<T>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+/**
+ * Thread safe least recently used cache
+ * Key type must provide size_t hash() const and bool operator==(const Key&) const methods
+ */
+template <typename Key, typename Value>
+class LruCache {
+public:
+    explicit LruCache(size_t capacity) : capacity(capacity) {}
+
+    /**
+     * Returns the cached value for the key or creates it with the builder and puts to the cache
+     * @param key
+     * key of the value
+     * @param builder
+     * functor which creates the value from the key, called without the cache lock
+     * @return cached or created value
+     */
+    template <typename Builder>
+    Value getOrCreate(const Key& key, Builder builder) {
+        {
+            std::lock_guard<std::mutex> lock(guard);
+            auto found = index.find(key);
+            if (found != index.end()) {
+                items.splice(items.begin(), items, found->second);
+                hits++;
+                return found->second->second;
+            }
+        }
+        misses++;
+        Value value = builder(key);
+        std::lock_guard<std::mutex> lock(guard);
+        if (capacity == 0 || index.count(key))
+            return value;
+        items.emplace_front(key, value);
+        index.emplace(key, items.begin());
+        if (items.size() > capacity) {
+            index.erase(items.back().first);
+            items.pop_back();
+        }
+        return value;
+    }
+
+    size_t getHits() const {
+        return hits;
+    }
+
+    size_t getMisses() const {
+        return misses;
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(guard);
+        return items.size();
+    }
+
+private:
+    struct KeyHasher {
+        size_t operator()(const Key& key) const {
+            return key.hash();
+        }
+    };
+
+    using ItemList = std::list<std::pair<Key, Value>>;
+
+    const size_t capacity;
+    ItemList items;
+    std::unordered_map<Key, typename ItemList::iterator, KeyHasher> index;
+    mutable std::mutex guard;
+    std::atomic<size_t> hits{0};
+    std::atomic<size_t> misses{0};
+};
+
+/**
+ * Collection of LruCache objects, one per key type, so nodes of different kinds can share one instance.
+ * Is a thread safe
+ */
+class MultiCache {
+public:
+    typedef std::shared_ptr<MultiCache> Ptr;
+
+    /**
+     * @param capacity
+     * maximal number of entries per key type, 0 disables caching
+     */
+    explicit MultiCache(size_t capacity) : capacity(capacity) {}
+
+    template <typename Key, typename Value, typename Builder>
+    Value getOrCreate(const Key& key, Builder builder) {
+        return getCache<Key, Value>().getOrCreate(key, builder);
+    }
+
+    size_t getHits() const {
+        size_t result = 0;
+        std::lock_guard<std::mutex> lock(guard);
+        for (const auto& cache : caches)
+            result += cache.second.hits();
+        return result;
+    }
+
+    size_t getMisses() const {
+        size_t result = 0;
+        std::lock_guard<std::mutex> lock(guard);
+        for (const auto& cache : caches)
+            result += cache.second.misses();
+        return result;
+    }
+
+private:
+    struct CacheEntry {
+        std::shared_ptr<void> cache;
+        std::function<size_t()> hits;
+        std::function<size_t()> misses;
+    };
+
+    template <typename Key, typename Value>
+    LruCache<Key, Value>& getCache() {
+        using CacheType = LruCache<Key, Value>;
+        std::lock_guard<std::mutex> lock(guard);
+        auto& entry = caches[std::type_index(typeid(CacheType))];
+        if (!entry.cache) {
+            auto cache = std::make_shared<CacheType>(capacity);
+            entry.hits = [cache] { return cache->getHits(); };
+            entry.misses = [cache] { return cache->getMisses(); };
+            entry.cache = cache;
+        }
+        return *std::static_pointer_cast<CacheType>(entry.cache);
+    }
+
+    const size_t capacity;
+    std::unordered_map<std::type_index, CacheEntry> caches;
+    mutable std::mutex guard;
+};
+
+}  // namespace MKLDNNPlugin
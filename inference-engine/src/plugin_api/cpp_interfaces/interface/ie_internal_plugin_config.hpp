@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <tuple>
+
 #include "ie_plugin_config.hpp"
 
 namespace InferenceEngine {
@@ -45,6 +47,56 @@ DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
  */
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
+/**
+ * @brief Enables per-stream lock-free task queues with work stealing between streams of the same NUMA node
+ * in CPU Executor Streams instead of the single shared task queue. Values: YES / NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_STREAMS_WORK_STEALING);
+
+/**
+ * @brief Enables concurrent execution of independent graph nodes (inter-op parallelism) in CPU plugin.
+ * Values: YES / NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_INTER_OP_PARALLELISM);
+
+/**
+ * @brief Defines the capacity of the CPU plugin cache of node executors prepared for particular input shapes.
+ * Values: non-negative integer, 0 disables the cache. Default is 5000
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
+
+/**
+ * @brief Enables fusion of elementwise subgraphs into snippets compiled to a single kernel in CPU plugin.
+ * Values: YES / NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SNIPPETS_MODE);
+
+/**
+ * @brief Enables the whole-graph selection of memory layouts minimizing the cost of the kernels and reorders
+ * in CPU plugin, instead of the node by node selection only. Values: YES / NO (default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_GLOBAL_LAYOUT_SELECTION);
+
+/**
+ * @brief Registers the CPU executable network in the process-wide core budget scheduler with the given priority,
+ * so the networks loaded in the same process share the cores instead of oversubscribing them.
+ * Values: non-negative integer, larger value is more important. By default the network is not registered
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_NETWORK_PRIORITY);
+
+/**
+ * @brief Number of cores reserved for the CPU executable network in the core budget scheduler.
+ * Values: non-negative integer, default is 0. Takes effect together with CPU_NETWORK_PRIORITY only
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_NETWORK_MIN_CORES);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
@@ -64,4 +116,22 @@ DECLARE_CONFIG_KEY(CONFIG_DEVICE_ID);
 
 }  // namespace PluginConfigInternalParams
 
+namespace Metrics {
+
+/**
+ * @brief Queueing statistics of the CPU executable network registered in the core budget scheduler:
+ * the number of dispatched tasks, the average and the maximal delay of a task in milliseconds
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_QUEUEING_DELAY, std::tuple<unsigned int, float, float>);
+
+/**
+ * @brief Number of the graph edges which needed a reorder before and after the whole-graph layout selection
+ * in the CPU executable network. Reported if CPU_GLOBAL_LAYOUT_SELECTION is enabled
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_LAYOUT_SELECTION_REORDERS, std::tuple<unsigned int, unsigned int>);
+
+}  // namespace Metrics
+
 }  // namespace InferenceEngine
@@ -0,0 +1,48 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Non-cryptographic hash of raw memory buffers
+ * @file ie_data_hash.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Size of the chunks which are hashed in parallel by hashData()
+ * @ingroup ie_dev_api_memory
+ */
+constexpr std::size_t dataHashChunkSize = 1 << 20;
+
+/**
+ * @brief      Computes xxHash64 of a memory buffer in the calling thread
+ * @ingroup    ie_dev_api_memory
+ *
+ * @param[in]  data  A pointer to the data
+ * @param[in]  size  A size of the data in bytes
+ * @param[in]  seed  A seed of the hash, allows to chain the hashes of several buffers
+ * @return     64-bit hash value
+ */
+INFERENCE_ENGINE_API_CPP(uint64_t) hashBytes(const void* data, std::size_t size, uint64_t seed = 0);
+
+/**
+ * @brief      Computes 64-bit hash of a memory buffer of any size.
+ *             Buffers larger than ::dataHashChunkSize are split into fixed size chunks hashed in parallel, so the
+ *             result doesn't depend on the number of threads and is the same on any machine.
+ * @ingroup    ie_dev_api_memory
+ *
+ * @param[in]  data  A pointer to the data
+ * @param[in]  size  A size of the data in bytes
+ * @return     64-bit hash value, equal to hashBytes(data, size) for the buffers of a single chunk
+ */
+INFERENCE_ENGINE_API_CPP(uint64_t) hashData(const void* data, std::size_t size);
+
+}  // namespace InferenceEngine
@@ -0,0 +1,111 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_core_budget_scheduler.hpp
+ * @brief A header file for the process-wide scheduler of tasks of several executable networks on a shared core budget
+ */
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "threading/ie_istreams_executor.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @class CoreBudgetScheduler
+ * @ingroup ie_dev_api_threading
+ * @brief Arbitrates the tasks of several executable networks sharing the CPU cores of a process.
+ *        Every network has its own streams executor sized to the whole machine, so the networks running
+ *        concurrently oversubscribe the cores. A network registered in the scheduler gets an executor which
+ *        dispatches a task to the network streams executor only when the cores the task needs are available:
+ *         - The cores requested as a minimum share are reserved for the network and are always available to it.
+ *         - The rest of the cores is a pool shared by all the networks. Waiting tasks are dispatched in the order
+ *           of the network priority, then in the order of submission. A task which waits for the pool blocks
+ *           the pool for the networks of the same or lower priority, but not their reserved cores.
+ *        The total reservation is limited so that at least one core remains in the pool, so every network makes
+ *        progress.
+ */
+class INFERENCE_ENGINE_API_CLASS(CoreBudgetScheduler) {
+public:
+    /**
+     * @brief A shared pointer to a CoreBudgetScheduler object
+     */
+    using Ptr = std::shared_ptr<CoreBudgetScheduler>;
+
+    /**
+     * @brief Scheduling parameters of a network
+     */
+    struct NetworkConfig {
+        std::string _name;      //!< Name of the network
+        int _priority = 0;      //!< Priority of the network tasks, larger value is more important
+        int _minCores = 0;      //!< Number of cores reserved for the network
+        int _coresPerTask = 1;  //!< Number of cores a task occupies, usually the number of threads per stream
+    };
+
+    /**
+     * @brief Queueing statistics of a network
+     */
+    struct Statistics {
+        size_t _dispatchedTasks = 0;                //!< Number of tasks dispatched to the network executor
+        size_t _waitingTasks = 0;                   //!< Number of tasks waiting for the cores at the moment
+        std::chrono::microseconds _totalDelay{0};   //!< Total time the dispatched tasks waited for the cores
+        std::chrono::microseconds _maxDelay{0};     //!< Maximal time a dispatched task waited for the cores
+    };
+
+    /**
+     * @brief Executor of the tasks of a registered network. The network is unregistered when the executor is destroyed.
+     *        Tasks started by `run()` are scheduled, `Execute()` waits for the cores in the same queue and runs the task
+     *        in the calling thread, so it must not be called from a task of the scheduled networks.
+     */
+    class ScheduledExecutor : public IStreamsExecutor {
+    public:
+        /**
+         * @brief A shared pointer to a ScheduledExecutor object
+         */
+        using Ptr = std::shared_ptr<ScheduledExecutor>;
+
+        /**
+         * @brief Returns the queueing statistics of the network
+         * @return Statistics of the tasks started since the registration
+         */
+        virtual Statistics GetStatistics() const = 0;
+    };
+
+    /**
+     * @brief Constructor
+     * @param cores Number of cores in the budget, the number of physical cores if zero
+     */
+    explicit CoreBudgetScheduler(int cores = 0);
+
+    /**
+     * @brief Registers a network
+     * @param config Scheduling parameters of the network
+     * @param executor Executor of the network tasks
+     * @return Executor which dispatches the tasks to @p executor
+     */
+    ScheduledExecutor::Ptr registerNetwork(const NetworkConfig& config, const IStreamsExecutor::Ptr& executor);
+
+    /**
+     * @brief Returns the number of cores in the budget
+     * @return Number of cores
+     */
+    int getCores() const;
+
+    /**
+     * @brief Returns the number of registered networks
+     * @return Number of networks
+     */
+    size_t getNetworksNumber() const;
+
+private:
+    struct Impl;
+    std::shared_ptr<Impl> _impl;
+};
+
+}  // namespace InferenceEngine
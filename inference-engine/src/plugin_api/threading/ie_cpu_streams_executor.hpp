@@ -21,6 +21,8 @@ namespace InferenceEngine {
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
  *        It uses custom threads to pull tasks from single queue.
+ *        If IStreamsExecutor::Config::_workStealing is set, every stream has its own lock-free queue instead,
+ *        and idle streams steal tasks from streams on the same NUMA node.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
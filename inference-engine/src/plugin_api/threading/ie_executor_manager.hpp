@@ -15,6 +15,7 @@
 #include <utility>
 #include <vector>
 
+#include "threading/ie_core_budget_scheduler.hpp"
 #include "threading/ie_istreams_executor.hpp"
 #include "threading/ie_itask_executor.hpp"
 
@@ -29,6 +30,8 @@ public:
 
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    CoreBudgetScheduler::Ptr getCoreBudgetScheduler();
+
     // for tests purposes
     size_t getExecutorsNumber();
 
@@ -40,6 +43,7 @@ public:
 private:
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
     std::vector<std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr>> cpuStreamsExecutors;
+    CoreBudgetScheduler::Ptr coreBudgetScheduler;
     std::mutex streamExecutorMutex;
     std::mutex taskExecutorMutex;
 };
@@ -83,6 +87,13 @@ public:
     /// @private
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    /**
+     * @brief Returns the process-wide scheduler which shares the CPU cores between the executable networks
+     * registered in it according to their priorities
+     * @return A shared pointer to the scheduler
+     */
+    CoreBudgetScheduler::Ptr getCoreBudgetScheduler();
+
     /**
      * @cond
      */
@@ -103,6 +103,8 @@ public:
                          // (for large #streams)
         } _threadPreferredCoreType =
             PreferredCoreType::ANY;  //!< In case of @ref HYBRID_AWARE hints the TBB to affinitize
+        bool _workStealing = false;  //!< Use per-stream lock-free task queues with work stealing between streams
+                                     //!< on the same NUMA node instead of the single shared task queue
 
         /**
          * @brief      A constructor with arguments
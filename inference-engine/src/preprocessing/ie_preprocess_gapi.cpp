@@ -686,25 +686,22 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 }
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+constexpr size_t PreprocEngine::defaultCacheCapacity;
 
-PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
-    // Given our knowledge about Fluid, full graph rebuild is required
-    // if and only if:
-    // 0. This is the first call ever
+PreprocEngine::PreprocEngine(size_t cacheCapacity) : _compiledCache(cacheCapacity) {}
+
+PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &lastCall, const CallDesc &newCallOrig) {
+    // Given our knowledge about Fluid, full graph rebuild (instead of
+    // reshaping graph compiled for the last call) is required if and only if:
     // 1. precision has changed (affects kernel versions)
     // 2. layout has changed (affects graph topology)
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
-    if (!_lastCall) {
-        return Update::REBUILD;
-    }
-
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    std::tie(last_in, last_out, last_algo) = lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
@@ -816,6 +813,7 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
 }
 
 void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
+    std::vector<cv::GCompiled>& compiledSlices,
     const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
     std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, bool omp_serial,
     Update update) {
@@ -838,7 +836,7 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
     parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
         OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
 
-        auto& compiled = _lastComp[slice_n];
+        auto& compiled = compiledSlices[slice_n];
         if (Update::REBUILD == update || Update::RESHAPE == update) {
             //  need to compile (or reshape) own object for a particular ROI
             OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
@@ -948,12 +946,16 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
         IE_THROW()  << "No job to do in the PreProcessing ?";
     }
 
-    const Update update = needUpdate(thisCall);
-
-    Opt<cv::GComputation> _lastComputation;
-    if (Update::REBUILD == update || Update::RESHAPE == update) {
-        _lastCall = cv::util::make_optional(std::move(thisCall));
+    _compiledCache.access(thisCall, [&](std::vector<cv::GCompiled>& compiledSlices, const CallDesc* lastCall) {
+        Update update = Update::REBUILD;
+        if (lastCall == nullptr) {
+            compiledSlices.resize(parallel_get_max_threads());
+        } else {
+            // Nothing to do on a hit, the graph of the evicted call is reshaped if only input sizes differ
+            update = needUpdate(*lastCall, thisCall);
+        }
 
+        Opt<cv::GComputation> _lastComputation;
         if (Update::REBUILD == update) {
             //  rebuild the graph
             OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
@@ -968,13 +970,13 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                            in_fmt,
                            out_fmt));
         }
-    }
 
-    auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
-    auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
+        auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
+        auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
-        omp_serial, update);
+        executeGraph(_lastComputation, compiledSlices, batched_input_plane_mats, batched_output_plane_mats, batch_size,
+            omp_serial, update);
+    });
 }
 
 void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
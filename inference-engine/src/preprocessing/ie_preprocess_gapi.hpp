@@ -7,6 +7,7 @@
 #include "ie_blob.h"
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
+#include "ie_preprocess_lru_cache.hpp"
 
 #include <tuple>
 #include <vector>
@@ -25,8 +26,9 @@ class PreprocEngine {
     using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
     template<typename T> using Opt = cv::util::optional<T>;
 
-    Opt<CallDesc> _lastCall;
-    std::vector<cv::GCompiled> _lastComp;
+    // Graphs compiled for the recent calls (one slice per thread). Allows to switch
+    // between a few input resolutions without recompilation
+    LruCache<CallDesc, std::vector<cv::GCompiled>> _compiledCache;
 
     openvino::itt::handle_t _perf_graph_building = openvino::itt::handle("Preproc Graph Building");
     openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Preproc Calc Tile");
@@ -34,9 +36,10 @@ class PreprocEngine {
     openvino::itt::handle_t _perf_graph_compiling = openvino::itt::handle("Preproc Graph compiling");
 
     enum class Update { REBUILD, RESHAPE, NOTHING };
-    Update needUpdate(const CallDesc &newCall) const;
+    static Update needUpdate(const CallDesc &lastCall, const CallDesc &newCall);
 
     void executeGraph(Opt<cv::GComputation>& lastComputation,
+                      std::vector<cv::GCompiled>& compiledSlices,
                       const std::vector<std::vector<cv::gapi::own::Mat>>& src,
                       std::vector<std::vector<cv::gapi::own::Mat>>& dst,
                       int batch_size,
@@ -49,7 +52,13 @@ class PreprocEngine {
         int batch_size);
 
 public:
-    PreprocEngine();
+    static constexpr size_t defaultCacheCapacity = 4;
+
+    /**
+     * @param cacheCapacity maximal number of distinct calls (input/output descriptors, algorithm, color formats)
+     * which compiled graphs are kept for, must be positive
+     */
+    explicit PreprocEngine(size_t cacheCapacity = defaultCacheCapacity);
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
     void preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
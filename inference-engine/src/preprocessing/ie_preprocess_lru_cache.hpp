@@ -0,0 +1,76 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <list>
+#include <utility>
+
+#include "ie_common.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Least recently used cache of the values which are expensive to build, like compiled graphs.
+ * When the cache is full, the value of the least recently used entry is handed over to the new key,
+ * so it can be partially reused (e.g. a graph compiled for other input sizes is reshaped instead of rebuilt).
+ */
+template <typename Key, typename Value>
+class LruCache {
+    // most recently used first
+    std::list<std::pair<Key, Value>> _entries;
+    size_t _capacity;
+
+public:
+    explicit LruCache(size_t capacity) : _capacity(capacity) {
+        IE_ASSERT(_capacity > 0);
+    }
+
+    /**
+     * @brief Calls `f(value, builtFor)` for the value of the key entry, which becomes the most recently used one.
+     * `builtFor` is the key the value was built for: the key itself on a hit, nullptr for a new entry
+     * or the key of the evicted entry if the cache is full.
+     * If `f` throws on a miss, the entry is dropped, so a partially built value is never used again.
+     */
+    template <typename F>
+    void access(const Key& key, F&& f) {
+        auto found = std::find_if(_entries.begin(), _entries.end(), [&](const std::pair<Key, Value>& entry) {
+            return entry.first == key;
+        });
+        if (found != _entries.end()) {
+            _entries.splice(_entries.begin(), _entries, found);
+            f(_entries.front().second, &_entries.front().first);
+            return;
+        }
+
+        const Key* builtFor = nullptr;
+        if (_entries.size() < _capacity) {
+            _entries.emplace_front(key, Value{});
+        } else {
+            _entries.splice(_entries.begin(), _entries, std::prev(_entries.end()));
+            builtFor = &_entries.front().first;
+        }
+        try {
+            f(_entries.front().second, builtFor);
+        } catch (...) {
+            _entries.pop_front();
+            throw;
+        }
+        _entries.front().first = key;
+    }
+
+    bool contains(const Key& key) const {
+        return std::any_of(_entries.begin(), _entries.end(), [&](const std::pair<Key, Value>& entry) {
+            return entry.first == key;
+        });
+    }
+
+    size_t size() const {
+        return _entries.size();
+    }
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <transformations_visibility.hpp>
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph {
+namespace op {
+namespace internal {
+
+/**
+ * @brief MultiHeadAttention computes Softmax(Q x K^T * scale + mask) x V over the last two dimensions of the inputs.
+ * Q is [..., Sq, D], K is [..., Sk, D] if transpose_k is true and [..., D, Sk] otherwise, V is [..., Sk, Dv] and
+ * the optional mask is broadcast to [..., Sq, Sk] by the numpy rules. The leading dimensions of Q, K and V are equal.
+ * The output is [..., Sq, Dv].
+ */
+class TRANSFORMATIONS_API MultiHeadAttention : public Op {
+public:
+    OPENVINO_OP("MultiHeadAttention", "util");
+    BWDCMP_RTTI_DECLARATION;
+
+    MultiHeadAttention() = default;
+
+    MultiHeadAttention(const Output<Node>& q,
+                       const Output<Node>& k,
+                       const Output<Node>& v,
+                       float scale,
+                       bool transpose_k);
+
+    MultiHeadAttention(const Output<Node>& q,
+                       const Output<Node>& k,
+                       const Output<Node>& v,
+                       const Output<Node>& mask,
+                       float scale,
+                       bool transpose_k);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector & new_args) const override;
+
+    float get_scale() const { return m_scale; }
+    bool get_transpose_k() const { return m_transpose_k; }
+    bool with_mask() const { return get_input_size() == 4; }
+
+private:
+    float m_scale = 1.f;
+    bool m_transpose_k = true;
+};
+
+}  // namespace internal
+}  // namespace op
+}  // namespace ngraph
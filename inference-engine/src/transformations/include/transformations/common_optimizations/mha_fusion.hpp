@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API MultiHeadAttentionFusion;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief MultiHeadAttentionFusion transformation replaces the scaled dot product attention subgraph:
+ *
+ *      Q      K
+ *       \    /
+ *       MatMul
+ *         |
+ *      Multiply (optional, by a scalar constant)
+ *         |
+ *        Add (optional, with the mask)
+ *         |
+ *      Softmax      V
+ *          \       /
+ *            MatMul
+ *
+ * with a single MultiHeadAttention operation, so plugins are able to compute the attention without materializing
+ * the whole scores tensor.
+ *
+ * Restrictions:
+ *   - Q, K and V have static shapes of rank 3 or 4 with the same leading dimensions
+ *   - the first MatMul doesn't transpose Q, the second MatMul has no transposes
+ *   - Softmax is computed over the last axis
+ *   - the mask is broadcast to the scores shape and doesn't change it
+ *
+ * The transformation is disabled by default and is enabled by the plugins that support MultiHeadAttention.
+ */
+
+class ngraph::pass::MultiHeadAttentionFusion: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MultiHeadAttentionFusion();
+};
@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+
+#include "ngraph_ops/multi_head_attention.hpp"
+#include "itt.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+BWDCMP_RTTI_DEFINITION(op::internal::MultiHeadAttention);
+
+op::internal::MultiHeadAttention::MultiHeadAttention(const Output<Node>& q,
+                                                     const Output<Node>& k,
+                                                     const Output<Node>& v,
+                                                     float scale,
+                                                     bool transpose_k)
+        : Op({q, k, v}), m_scale(scale), m_transpose_k(transpose_k) {
+    constructor_validate_and_infer_types();
+}
+
+op::internal::MultiHeadAttention::MultiHeadAttention(const Output<Node>& q,
+                                                     const Output<Node>& k,
+                                                     const Output<Node>& v,
+                                                     const Output<Node>& mask,
+                                                     float scale,
+                                                     bool transpose_k)
+        : Op({q, k, v, mask}), m_scale(scale), m_transpose_k(transpose_k) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<Node> op::internal::MultiHeadAttention::clone_with_new_inputs(const ngraph::OutputVector &new_args) const {
+    INTERNAL_OP_SCOPE(internal_MultiHeadAttention_clone_with_new_inputs);
+    if (new_args.size() == 4) {
+        return make_shared<MultiHeadAttention>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3),
+                                               m_scale, m_transpose_k);
+    } else if (new_args.size() == 3) {
+        return make_shared<MultiHeadAttention>(new_args.at(0), new_args.at(1), new_args.at(2), m_scale, m_transpose_k);
+    }
+    throw ngraph::ngraph_error("Unsupported number of inputs: " + std::to_string(new_args.size()));
+}
+
+bool op::internal::MultiHeadAttention::visit_attributes(AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(internal_MultiHeadAttention_visit_attributes);
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("transpose_k", m_transpose_k);
+    return true;
+}
+
+void op::internal::MultiHeadAttention::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(internal_MultiHeadAttention_validate_and_infer_types);
+    NODE_VALIDATION_CHECK(this, get_input_size() == 3 || get_input_size() == 4,
+                          "Expected 3 or 4 inputs, got: ", get_input_size());
+
+    element::Type result_et;
+    NODE_VALIDATION_CHECK(this,
+                          element::Type::merge(result_et, get_input_element_type(0), get_input_element_type(1)) &&
+                          element::Type::merge(result_et, result_et, get_input_element_type(2)),
+                          "Q, K and V element types must be equal.");
+
+    const auto& q_ps = get_input_partial_shape(0);
+    const auto& k_ps = get_input_partial_shape(1);
+    const auto& v_ps = get_input_partial_shape(2);
+    if (q_ps.rank().is_dynamic() || k_ps.rank().is_dynamic() || v_ps.rank().is_dynamic()) {
+        set_output_type(0, result_et, PartialShape::dynamic());
+        return;
+    }
+
+    const auto rank = q_ps.rank().get_length();
+    NODE_VALIDATION_CHECK(this, rank >= 2 && k_ps.rank().get_length() == rank && v_ps.rank().get_length() == rank,
+                          "Q, K and V must have the same rank which is not less than 2.");
+
+    PartialShape out_shape = q_ps;
+    for (int64_t i = 0; i < rank - 2; i++) {
+        NODE_VALIDATION_CHECK(this,
+                              Dimension::merge(out_shape[i], out_shape[i], k_ps[i]) &&
+                              Dimension::merge(out_shape[i], out_shape[i], v_ps[i]),
+                              "Batch dimensions of Q, K and V are not equal.");
+    }
+
+    const auto& k_depth = m_transpose_k ? k_ps[rank - 1] : k_ps[rank - 2];
+    const auto& k_len = m_transpose_k ? k_ps[rank - 2] : k_ps[rank - 1];
+    NODE_VALIDATION_CHECK(this, q_ps[rank - 1].compatible(k_depth), "Q and K depths are not equal.");
+    NODE_VALIDATION_CHECK(this, k_len.compatible(v_ps[rank - 2]), "K and V sequence lengths are not equal.");
+
+    out_shape[rank - 1] = v_ps[rank - 1];
+    set_output_type(0, result_et, out_shape);
+}
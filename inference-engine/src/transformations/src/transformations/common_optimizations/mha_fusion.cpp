@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/mha_fusion.hpp"
+#include "transformations/utils/utils.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph_ops/multi_head_attention.hpp>
+#include "itt.hpp"
+
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::MultiHeadAttentionFusion, "MultiHeadAttentionFusion", 0);
+
+ngraph::pass::MultiHeadAttentionFusion::MultiHeadAttentionFusion() {
+    MATCHER_SCOPE(MultiHeadAttentionFusion);
+    auto q_pattern = ngraph::pattern::any_input(pattern::has_static_shape());
+    auto k_pattern = ngraph::pattern::any_input(pattern::has_static_shape());
+    auto v_pattern = ngraph::pattern::any_input(pattern::has_static_shape());
+    auto matmul_qk_pattern = ngraph::pattern::wrap_type<opset1::MatMul>({q_pattern, k_pattern}, pattern::consumers_count(1));
+    auto scale_pattern = ngraph::pattern::wrap_type<opset1::Constant>();
+    auto mul_pattern = ngraph::pattern::wrap_type<opset1::Multiply>({matmul_qk_pattern, scale_pattern}, pattern::consumers_count(1));
+    auto scaled_pattern = std::make_shared<pattern::op::Or>(OutputVector{matmul_qk_pattern, mul_pattern});
+    auto mask_pattern = ngraph::pattern::any_input(pattern::has_static_shape());
+    auto add_pattern = ngraph::pattern::wrap_type<opset1::Add>({scaled_pattern, mask_pattern}, pattern::consumers_count(1));
+    auto scores_pattern = std::make_shared<pattern::op::Or>(OutputVector{scaled_pattern, add_pattern});
+    auto softmax_pattern = ngraph::pattern::wrap_type<opset1::Softmax>({scores_pattern}, pattern::consumers_count(1));
+    auto matmul_v_pattern = ngraph::pattern::wrap_type<opset1::MatMul>({softmax_pattern, v_pattern});
+
+    ngraph::matcher_pass_callback callback = [=](pattern::Matcher& m) {
+        if (transformation_callback(m.get_match_root()))
+            return false;
+
+        const auto& pattern_map = m.get_pattern_value_map();
+
+        auto matmul_qk = std::dynamic_pointer_cast<opset1::MatMul>(pattern_map.at(matmul_qk_pattern).get_node_shared_ptr());
+        auto matmul_v = std::dynamic_pointer_cast<opset1::MatMul>(pattern_map.at(matmul_v_pattern).get_node_shared_ptr());
+        auto softmax = std::dynamic_pointer_cast<opset1::Softmax>(pattern_map.at(softmax_pattern).get_node_shared_ptr());
+        if (!matmul_qk || !matmul_v || !softmax)
+            return false;
+        if (matmul_qk->get_transpose_a() || matmul_v->get_transpose_a() || matmul_v->get_transpose_b())
+            return false;
+
+        const auto& q = pattern_map.at(q_pattern);
+        const auto& k = pattern_map.at(k_pattern);
+        const auto& v = pattern_map.at(v_pattern);
+        if (!q.get_element_type().is_real())
+            return false;
+
+        const auto& q_shape = q.get_shape();
+        const auto& k_shape = k.get_shape();
+        const auto& v_shape = v.get_shape();
+        const auto rank = q_shape.size();
+        if ((rank != 3 && rank != 4) || k_shape.size() != rank || v_shape.size() != rank)
+            return false;
+        // the batch dimensions are not broadcast
+        if (!std::equal(q_shape.begin(), q_shape.end() - 2, k_shape.begin()) ||
+            !std::equal(q_shape.begin(), q_shape.end() - 2, v_shape.begin()))
+            return false;
+        if (softmax->get_axis() != rank - 1)
+            return false;
+
+        NodeVector fused_nodes{matmul_qk, softmax, matmul_v};
+        float scale = 1.f;
+        if (pattern_map.count(mul_pattern)) {
+            auto scale_const = std::dynamic_pointer_cast<opset1::Constant>(pattern_map.at(scale_pattern).get_node_shared_ptr());
+            if (!scale_const || shape_size(scale_const->get_shape()) != 1)
+                return false;
+            scale = scale_const->cast_vector<float>()[0];
+            fused_nodes.push_back(pattern_map.at(mul_pattern).get_node_shared_ptr());
+        }
+
+        std::shared_ptr<Node> mha;
+        if (pattern_map.count(add_pattern)) {
+            const auto& mask = pattern_map.at(mask_pattern);
+            const auto& scores_shape = matmul_qk->get_output_shape(0);
+            const auto& mask_shape = mask.get_shape();
+            if (mask_shape.size() > scores_shape.size())
+                return false;
+            // the mask must be broadcast to the scores, not vice versa
+            const auto offset = scores_shape.size() - mask_shape.size();
+            for (size_t i = 0; i < mask_shape.size(); i++) {
+                if (mask_shape[i] != 1 && mask_shape[i] != scores_shape[offset + i])
+                    return false;
+            }
+            mha = register_new_node<op::internal::MultiHeadAttention>(q, k, v, mask, scale, matmul_qk->get_transpose_b());
+            fused_nodes.push_back(pattern_map.at(add_pattern).get_node_shared_ptr());
+        } else {
+            mha = register_new_node<op::internal::MultiHeadAttention>(q, k, v, scale, matmul_qk->get_transpose_b());
+        }
+
+        mha->set_friendly_name(matmul_v->get_friendly_name());
+        copy_runtime_info(fused_nodes, mha);
+        replace_node(matmul_v, mha);
+
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_v_pattern, matcher_name);
+    this->register_matcher(m, callback);
+}
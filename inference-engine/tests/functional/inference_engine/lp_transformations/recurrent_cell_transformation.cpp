@@ -0,0 +1,235 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "layer_transformation.hpp"
+
+#include <string>
+#include <sstream>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <ngraph/opsets/opset5.hpp>
+#include <transformations/utils/utils.hpp>
+#include "simple_low_precision_transformer.hpp"
+#include <low_precision/recurrent_cell.hpp>
+#include <low_precision/rt_info/data_dequantization_attribute.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+#include "lpt_ngraph_functions/recurrent_cell_function.hpp"
+#include "lpt_ngraph_functions/common/dequantization_operations.hpp"
+
+namespace {
+using namespace testing;
+using namespace ngraph;
+using namespace ngraph::pass;
+using namespace ngraph::builder::subgraph;
+
+constexpr size_t hiddenSize = 16ul;
+
+class RecurrentCellTransformationTestValues {
+public:
+    class Actual {
+    public:
+        ngraph::element::Type inputPrecision;
+        DequantizationOperations dequantizationOnData;
+        DequantizationOperations dequantizationOnHiddenState;
+        DequantizationOperations dequantizationOnWeights;
+    };
+    class Expected {
+    public:
+        bool transformed;
+        float scale;
+        float shift;
+    };
+    TestTransformationParams transformationParams;
+    Actual actual;
+    Expected expected;
+};
+
+typedef std::tuple<
+    ngraph::Shape,
+    RecurrentCellTransformationTestValues> RecurrentCellTransformationParams;
+
+class RecurrentCellTransformation : public LayerTransformation, public testing::WithParamInterface<RecurrentCellTransformationParams> {
+public:
+    void SetUp() override {
+        ngraph::Shape shape;
+        RecurrentCellTransformationTestValues testValues;
+        std::tie(shape, testValues) = GetParam();
+
+        actualFunction = RecurrentCellFunction::getOriginal(
+            testValues.actual.inputPrecision,
+            shape,
+            hiddenSize,
+            testValues.actual.dequantizationOnData,
+            testValues.actual.dequantizationOnHiddenState,
+            testValues.actual.dequantizationOnWeights);
+
+        SimpleLowPrecisionTransformer transform;
+        transform.add<low_precision::RecurrentCellTransformation, ngraph::opset5::LSTMSequence>(testValues.transformationParams);
+        transform.transform(actualFunction);
+
+        referenceFunction = testValues.expected.transformed ?
+            RecurrentCellFunction::getReference(
+                testValues.actual.inputPrecision,
+                shape,
+                hiddenSize,
+                testValues.actual.dequantizationOnWeights) :
+            RecurrentCellFunction::getOriginal(
+                testValues.actual.inputPrecision,
+                shape,
+                hiddenSize,
+                testValues.actual.dequantizationOnData,
+                testValues.actual.dequantizationOnHiddenState,
+                testValues.actual.dequantizationOnWeights);
+    }
+
+    static std::string getTestCaseName(testing::TestParamInfo<RecurrentCellTransformationParams> obj) {
+        ngraph::Shape shape;
+        RecurrentCellTransformationTestValues testValues;
+        std::tie(shape, testValues) = obj.param;
+
+        std::ostringstream result;
+        result <<
+            toString(testValues.transformationParams) << shape << "_" <<
+            testValues.actual.inputPrecision << "_" <<
+            testValues.actual.dequantizationOnData << "_" <<
+            testValues.actual.dequantizationOnHiddenState << "_" <<
+            testValues.actual.dequantizationOnWeights;
+        return result.str();
+    }
+};
+
+TEST_P(RecurrentCellTransformation, CompareFunctions) {
+    actualFunction->validate_nodes_and_infer_types();
+    auto res = compare_functions(referenceFunction, actualFunction, true, true, false);
+    ASSERT_TRUE(res.first) << res.second;
+
+    ASSERT_TRUE(LayerTransformation::allNamesAreUnique(actualFunction)) << "Not all names are unique";
+
+    const auto& testValues = std::get<1>(GetParam());
+    const auto& expected = testValues.expected;
+    for (const auto& op : actualFunction->get_ops()) {
+        if (!ov::is_type<ngraph::opset5::LSTMSequence>(op)) {
+            continue;
+        }
+
+        ASSERT_EQ(expected.transformed, ov::has_data_dequantization(op));
+        if (expected.transformed) {
+            const auto dequantization = ov::get_data_dequantization(op);
+            ASSERT_EQ(expected.scale, dequantization.scale);
+            ASSERT_EQ(expected.shift, dequantization.shift);
+
+            const auto& weightsScales = testValues.actual.dequantizationOnWeights.multiply.values;
+            ASSERT_EQ(4ul * hiddenSize, dequantization.weightsScales.size());
+            for (size_t i = 0; i < dequantization.weightsScales.size(); ++i) {
+                ASSERT_EQ(weightsScales.size() == 1ul ? weightsScales[0] : weightsScales[i], dequantization.weightsScales[i]);
+            }
+        }
+    }
+}
+
+const std::vector<ngraph::Shape> shapes = {
+    { 1, 3, 16 },
+    { 4, 1, 32 }
+};
+
+std::vector<float> perChannelScales() {
+    std::vector<float> scales(4ul * hiddenSize);
+    for (size_t i = 0; i < scales.size(); ++i) {
+        scales[i] = 0.001f * static_cast<float>(1ul + i % 7ul);
+    }
+    return scales;
+}
+
+const std::vector<RecurrentCellTransformationTestValues> testValues = {
+    // U8 per tensor quantization, the same on the data and the hidden state
+    {
+        LayerTransformation::createParamsU8I8(),
+        {
+            ngraph::element::u8,
+            {{ngraph::element::f32}, {128.f}, {0.02f}},
+            {{ngraph::element::f32}, {128.f}, {0.02f}},
+            {{ngraph::element::f32}, {}, {0.01f}}
+        },
+        {true, 0.02f, 128.f}
+    },
+    // U8 per tensor quantization without subtract
+    {
+        LayerTransformation::createParamsU8I8(),
+        {
+            ngraph::element::u8,
+            {{ngraph::element::f32}, {}, {0.01f}},
+            {{ngraph::element::f32}, {}, {0.01f}},
+            {{ngraph::element::f32}, {}, {0.01f}}
+        },
+        {true, 0.01f, 0.f}
+    },
+    // U8 per tensor quantization on the data, I8 per channel quantization on the weights
+    {
+        LayerTransformation::createParamsU8I8(),
+        {
+            ngraph::element::u8,
+            {{ngraph::element::f32}, {128.f}, {0.02f}},
+            {{ngraph::element::f32}, {128.f}, {0.02f}},
+            {{ngraph::element::f32}, {}, {perChannelScales(), ngraph::element::f32, {1, 4ul * hiddenSize, 1}}}
+        },
+        {true, 0.02f, 128.f}
+    },
+    // U8 per tensor quantization without quantized weights: the weights stay in fp32
+    {
+        LayerTransformation::createParamsU8I8(),
+        {
+            ngraph::element::u8,
+            {{ngraph::element::f32}, {128.f}, {0.02f}},
+            {{ngraph::element::f32}, {128.f}, {0.02f}},
+            {}
+        },
+        {false}
+    },
+    // U8 per tensor quantization, I8 weights with zero point
+    {
+        LayerTransformation::createParamsU8I8(),
+        {
+            ngraph::element::u8,
+            {{ngraph::element::f32}, {128.f}, {0.02f}},
+            {{ngraph::element::f32}, {128.f}, {0.02f}},
+            {{ngraph::element::f32}, {2.f}, {0.01f}}
+        },
+        {false}
+    },
+    // U8 per tensor quantization, different on the data and the hidden state
+    {
+        LayerTransformation::createParamsU8I8(),
+        {
+            ngraph::element::u8,
+            {{ngraph::element::f32}, {128.f}, {0.02f}},
+            {{ngraph::element::f32}, {128.f}, {0.01f}},
+            {{ngraph::element::f32}, {}, {0.01f}}
+        },
+        {false}
+    },
+    // I8 per tensor quantization: the recurrent primitive takes unsigned data only
+    {
+        LayerTransformation::createParamsI8I8(),
+        {
+            ngraph::element::i8,
+            {{ngraph::element::f32}, {}, {0.02f}},
+            {{ngraph::element::f32}, {}, {0.02f}},
+            {{ngraph::element::f32}, {}, {0.01f}}
+        },
+        {false}
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    smoke_LPT,
+    RecurrentCellTransformation,
+    ::testing::Combine(
+        ::testing::ValuesIn(shapes),
+        ::testing::ValuesIn(testValues)),
+    RecurrentCellTransformation::getTestCaseName);
+} // namespace
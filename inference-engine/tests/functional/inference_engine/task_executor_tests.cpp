@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
 #include <future>
 
 #include <gtest/gtest.h>
@@ -105,6 +106,31 @@ TEST_P(TaskExecutorTests, canRunMultipleTasksFromMultipleThreads) {
     for (auto&& thread : threads) if (thread.joinable()) thread.join();
 }
 
+TEST_P(TaskExecutorTests, canRunManySmallTasksFromMultipleThreads) {
+    const int THREAD_NUMBER = 4;
+    // exceeds capacity of the per-stream queues in work stealing mode
+    const int TASKS_PER_THREAD = 10000;
+    std::atomic_int sharedVar = {0};
+    std::promise<void> allDone;
+    // the executor is destroyed first, so the tasks left after a failure don't outlive the variables they use
+    auto taskExecutor = GetParam()();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < THREAD_NUMBER; i++) {
+        threads.emplace_back([&] {
+            for (int k = 0; k < TASKS_PER_THREAD; k++) {
+                taskExecutor->run([&] {
+                    if (++sharedVar == THREAD_NUMBER * TASKS_PER_THREAD)
+                        allDone.set_value();
+                });
+            }
+        });
+    }
+    for (auto&& thread : threads) thread.join();
+    // a lost task fails the test instead of hanging it
+    ASSERT_EQ(std::future_status::ready, allDone.get_future().wait_for(std::chrono::seconds(60)));
+    ASSERT_EQ(THREAD_NUMBER * TASKS_PER_THREAD, sharedVar);
+}
+
 TEST_P(TaskExecutorTests, executorNotReleasedUntilTasksAreDone) {
     std::mutex mutex_block_emulation;
     std::condition_variable cv_block_emulation;
@@ -198,6 +224,15 @@ TEST_F(StreamsExecutorConfigTest, streamsExecutorConfigReturnStrings) {
     }
 }
 
+static ITaskExecutor::Ptr makeWorkStealingExecutor() {
+    auto streams = getNumberOfCPUCores();
+    auto threads = parallel_get_max_threads();
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, threads/streams,
+                                    IStreamsExecutor::ThreadBindingType::NONE};
+    config._workStealing = true;
+    return std::make_shared<CPUStreamsExecutor>(config);
+}
+
 static auto Executors = ::testing::Values(
     [] {
         auto streams = getNumberOfCPUCores();
@@ -217,6 +252,7 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
     },
+    makeWorkStealingExecutor,
     [] {
         return std::make_shared<ImmediateExecutor>();
     }
@@ -242,7 +278,8 @@ static auto AsyncExecutors = ::testing::Values(
         auto threads = parallel_get_max_threads();
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
-    }
+    },
+    makeWorkStealingExecutor
 );
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
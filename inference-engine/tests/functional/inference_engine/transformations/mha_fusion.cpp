@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph_ops/multi_head_attention.hpp>
+#include <transformations/common_optimizations/mha_fusion.hpp>
+#include <transformations/init_node_info.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+
+using namespace testing;
+using namespace ngraph;
+
+TEST(TransformationTests, MultiHeadAttentionFusionWithScaleAndMask) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 12, 128, 64});
+        auto k = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 12, 128, 64});
+        auto v = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 12, 128, 64});
+        auto mask = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 1, 1, 128});
+        auto matmul_qk = std::make_shared<opset1::MatMul>(q, k, false, true);
+        auto scale = opset1::Constant::create(element::f32, Shape{}, {0.125f});
+        auto mul = std::make_shared<opset1::Multiply>(matmul_qk, scale);
+        auto add = std::make_shared<opset1::Add>(mul, mask);
+        auto softmax = std::make_shared<opset1::Softmax>(add, 3);
+        auto matmul_v = std::make_shared<opset1::MatMul>(softmax, v);
+        f = std::make_shared<Function>(NodeVector{matmul_v}, ParameterVector{q, k, v, mask});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<pass::MultiHeadAttentionFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 12, 128, 64});
+        auto k = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 12, 128, 64});
+        auto v = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 12, 128, 64});
+        auto mask = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 1, 1, 128});
+        auto mha = std::make_shared<op::internal::MultiHeadAttention>(q, k, v, mask, 0.125f, true);
+        f_ref = std::make_shared<Function>(NodeVector{mha}, ParameterVector{q, k, v, mask});
+    }
+
+    auto res = compare_functions(f, f_ref, false, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, MultiHeadAttentionFusionWithoutScaleAndMask) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, Shape{4, 16, 32});
+        auto k = std::make_shared<opset1::Parameter>(element::f32, Shape{4, 32, 24});
+        auto v = std::make_shared<opset1::Parameter>(element::f32, Shape{4, 24, 48});
+        auto matmul_qk = std::make_shared<opset1::MatMul>(q, k);
+        auto softmax = std::make_shared<opset1::Softmax>(matmul_qk, 2);
+        auto matmul_v = std::make_shared<opset1::MatMul>(softmax, v);
+        f = std::make_shared<Function>(NodeVector{matmul_v}, ParameterVector{q, k, v});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<pass::MultiHeadAttentionFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, Shape{4, 16, 32});
+        auto k = std::make_shared<opset1::Parameter>(element::f32, Shape{4, 32, 24});
+        auto v = std::make_shared<opset1::Parameter>(element::f32, Shape{4, 24, 48});
+        auto mha = std::make_shared<op::internal::MultiHeadAttention>(q, k, v, 1.f, false);
+        f_ref = std::make_shared<Function>(NodeVector{mha}, ParameterVector{q, k, v});
+    }
+
+    auto res = compare_functions(f, f_ref, false, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, MultiHeadAttentionFusionNegativeSoftmaxAxis) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    auto create_function = []() {
+        auto q = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 8, 16, 16});
+        auto k = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 8, 16, 16});
+        auto v = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 8, 16, 16});
+        auto matmul_qk = std::make_shared<opset1::MatMul>(q, k, false, true);
+        auto softmax = std::make_shared<opset1::Softmax>(matmul_qk, 2);
+        auto matmul_v = std::make_shared<opset1::MatMul>(softmax, v);
+        return std::make_shared<Function>(NodeVector{matmul_v}, ParameterVector{q, k, v});
+    };
+    {
+        f = create_function();
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<pass::MultiHeadAttentionFusion>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+    f_ref = create_function();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
@@ -23,6 +23,12 @@ namespace {
             {{ AUTO_CONFIG_KEY(DEVICE_LIST) , CommonTestUtils::DEVICE_CPU}}
     };
 
+    const std::vector<std::map<std::string, std::string>> AutoBatchConfigs = {
+            {{ CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) , std::string(CommonTestUtils::DEVICE_CPU) + "(1)"}},
+            {{ CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG) , std::string(CommonTestUtils::DEVICE_CPU) + "(4)"},
+             { CONFIG_KEY(AUTO_BATCH_TIMEOUT) , "1"}}
+    };
+
     INSTANTIATE_TEST_SUITE_P(smoke_BehaviorTests, InferRequestWaitTests,
                             ::testing::Combine(
                                     ::testing::Values(CommonTestUtils::DEVICE_CPU),
@@ -41,4 +47,10 @@ namespace {
                                     ::testing::ValuesIn(Autoconfigs)),
                              InferRequestWaitTests::getTestCaseName);
 
+    INSTANTIATE_TEST_SUITE_P(smoke_AutoBatch_BehaviorTests, InferRequestWaitTests,
+                            ::testing::Combine(
+                                    ::testing::Values(CommonTestUtils::DEVICE_BATCH),
+                                    ::testing::ValuesIn(AutoBatchConfigs)),
+                             InferRequestWaitTests::getTestCaseName);
+
 }  // namespace
@@ -0,0 +1,133 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+
+const size_t batch = 4;
+// long enough for the test to fail on timeout if a batch is not collected or a request waits for it
+const std::string batchTimeoutMs = "20000";
+
+std::shared_ptr<Function> makeConvRelu() {
+    auto params = builder::makeParams(element::f32, {{1, 3, 10, 10}});
+    auto conv = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                         op::PadType::EXPLICIT, 8);
+    auto relu = std::make_shared<opset1::Relu>(conv);
+    return std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(relu)}, params, "ConvRelu");
+}
+
+class AutoBatchCompareWithCPU : public testing::Test {
+protected:
+    void SetUp() override {
+        auto ie = PluginCache::get().ie();
+        CNNNetwork network(makeConvRelu());
+        cpuNetwork = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+        batchNetwork = ie->LoadNetwork(network, CommonTestUtils::DEVICE_BATCH, {
+            {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG), std::string(CommonTestUtils::DEVICE_CPU) + "(" + std::to_string(batch) + ")"},
+            {CONFIG_KEY(AUTO_BATCH_TIMEOUT), batchTimeoutMs}});
+        inputName = cpuNetwork.GetInputsInfo().begin()->first;
+        outputName = cpuNetwork.GetOutputsInfo().begin()->first;
+        inputDesc = cpuNetwork.GetInputsInfo().begin()->second->getTensorDesc();
+        outputDesc = cpuNetwork.GetOutputsInfo().begin()->second->getTensorDesc();
+    }
+
+    // the odd requests read and write the blobs set by the user, the even ones use the slices of the batched blobs
+    void prepare(std::vector<InferRequest>& requests, std::vector<Blob::Ptr>& inputs) {
+        for (size_t i = 0; i < requests.size(); i++) {
+            inputs.push_back(FuncTestUtils::createAndFillBlob(inputDesc, 10, -5, 10, static_cast<int>(i + 1)));
+            if (i % 2) {
+                auto output = make_blob_with_precision(outputDesc);
+                output->allocate();
+                requests[i].SetBlob(inputName, inputs[i]);
+                requests[i].SetBlob(outputName, output);
+            } else {
+                auto input = requests[i].GetBlob(inputName);
+                std::memcpy(as<MemoryBlob>(input)->wmap().as<void*>(), as<MemoryBlob>(inputs[i])->rmap().as<const void*>(),
+                            input->byteSize());
+            }
+        }
+    }
+
+    void compareWithCPU(InferRequest& request, const Blob::Ptr& input) {
+        auto cpuRequest = cpuNetwork.CreateInferRequest();
+        cpuRequest.SetBlob(inputName, input);
+        cpuRequest.Infer();
+        auto expectedBlob = cpuRequest.GetBlob(outputName);
+        auto actualBlob = request.GetBlob(outputName);
+        ASSERT_EQ(expectedBlob->size(), actualBlob->size());
+
+        const auto expected = as<MemoryBlob>(expectedBlob)->rmap().as<const float*>();
+        const auto actual = as<MemoryBlob>(actualBlob)->rmap().as<const float*>();
+        for (size_t i = 0; i < expectedBlob->size(); i++)
+            ASSERT_NEAR(expected[i], actual[i], 1e-4f * std::max(1.f, std::fabs(expected[i]))) << "at " << i;
+    }
+
+    ExecutableNetwork cpuNetwork;
+    ExecutableNetwork batchNetwork;
+    std::string inputName;
+    std::string outputName;
+    TensorDesc inputDesc;
+    TensorDesc outputDesc;
+};
+
+}  // namespace
+
+// every request of the batch gets the result of its own input
+TEST_F(AutoBatchCompareWithCPU, smoke_BatchedRequestsMatchCPU) {
+    std::vector<InferRequest> requests;
+    for (size_t i = 0; i < batch; i++)
+        requests.push_back(batchNetwork.CreateInferRequest());
+    std::vector<Blob::Ptr> inputs;
+    prepare(requests, inputs);
+
+    // the requests are started in the reverse order, so the slots of the batch don't follow the submission order
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = batch; i-- > 0;)
+        requests[i].StartAsync();
+    for (auto& request : requests)
+        ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::RESULT_READY));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(std::stoll(batchTimeoutMs) / 2));
+
+    for (size_t i = 0; i < batch; i++)
+        compareWithCPU(requests[i], inputs[i]);
+}
+
+// the last request doesn't fill the batch, so it is run without batching and without waiting for the timeout
+TEST_F(AutoBatchCompareWithCPU, smoke_RequestsOverMultipleOfBatchDontWait) {
+    std::vector<InferRequest> requests;
+    for (size_t i = 0; i < batch + 1; i++)
+        requests.push_back(batchNetwork.CreateInferRequest());
+    std::vector<Blob::Ptr> inputs;
+    prepare(requests, inputs);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (auto& request : requests)
+        request.StartAsync();
+    for (auto& request : requests)
+        ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::RESULT_READY));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(std::stoll(batchTimeoutMs) / 2));
+
+    for (size_t i = 0; i < requests.size(); i++)
+        compareWithCPU(requests[i], inputs[i]);
+}
+
+}  // namespace SubgraphTestsDefinitions
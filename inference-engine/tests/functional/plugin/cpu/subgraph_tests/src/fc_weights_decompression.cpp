@@ -0,0 +1,125 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *                      Constant(u8/i8)
+ *                          |
+ *                       Convert     Constant
+ *                           \       /
+ *                           Subtract (optional)
+ *                               \      Constant
+ *                                \     /
+ *          Parameter            Multiply
+ *                 \             /
+ *                  \           /
+ *                     MatMul
+ *                       |
+ *                     Result
+ *
+ * The small inputs are processed by the FullyConnected node with the compressed weights,
+ * the decompression subgraph is fused into it.
+ */
+
+using FCWeightsDecompressionParams = std::tuple<SizeVector,           // input shape
+                                                size_t,               // output channels
+                                                bool,                 // transpose B
+                                                element::Type,        // weights precision
+                                                bool>;                // with zero points
+
+class FCWeightsDecompressionTest : public testing::WithParamInterface<FCWeightsDecompressionParams>,
+                                   virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCWeightsDecompressionParams> obj) {
+        SizeVector inputShape;
+        size_t outputChannels;
+        bool transposeB;
+        element::Type weightsPrc;
+        bool withZeroPoints;
+        std::tie(inputShape, outputChannels, transposeB, weightsPrc, withZeroPoints) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "OC=" << outputChannels << "_";
+        result << "Transp_B=" << transposeB << "_";
+        result << "WeightsPrc=" << weightsPrc << "_";
+        result << "ZeroPoints=" << withZeroPoints;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector inputShape;
+        size_t outputChannels;
+        bool transposeB;
+        element::Type weightsPrc;
+        bool withZeroPoints;
+        std::tie(inputShape, outputChannels, transposeB, weightsPrc, withZeroPoints) = this->GetParam();
+
+        const size_t inputChannels = inputShape.back();
+        const SizeVector weightsShape = transposeB ? SizeVector{outputChannels, inputChannels} : SizeVector{inputChannels, outputChannels};
+        const SizeVector perChannelShape = transposeB ? SizeVector{outputChannels, 1} : SizeVector{1, outputChannels};
+
+        auto inputParams = builder::makeParams(element::f32, {inputShape});
+        const bool isSigned = weightsPrc == element::i8;
+        auto weights = builder::makeConstant<float>(weightsPrc, weightsShape, {}, true, isSigned ? 127.f : 255.f, isSigned ? -128.f : 0.f);
+        std::shared_ptr<Node> decompressed = std::make_shared<opset1::Convert>(weights, element::f32);
+        if (withZeroPoints) {
+            auto zeroPoints = builder::makeConstant<float>(element::f32, perChannelShape, {}, true, 10.f, 0.f);
+            decompressed = std::make_shared<opset1::Subtract>(decompressed, zeroPoints);
+        }
+        auto scales = builder::makeConstant<float>(element::f32, perChannelShape, {}, true, 0.05f, 0.01f);
+        auto multiply = std::make_shared<opset1::Multiply>(decompressed, scales);
+        auto matMul = builder::makeMatMul(inputParams[0], multiply, false, transposeB);
+
+        ResultVector results{std::make_shared<opset1::Result>(matMul)};
+        function = std::make_shared<Function>(results, inputParams, "FCWeightsDecompression");
+    }
+};
+
+TEST_P(FCWeightsDecompressionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "FullyConnected", 1);
+    const auto& inputShape = std::get<0>(GetParam());
+    const size_t rowsNum = std::accumulate(inputShape.begin(), inputShape.end() - 1, size_t{1}, std::multiplies<size_t>());
+    if (rowsNum <= 8) {
+        CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+        CheckNodeOfTypeCount(executableNetwork, "Eltwise", 0);
+    }
+}
+
+namespace {
+
+const std::vector<SizeVector> inputShapes = {
+    {1, 64},
+    {3, 70},
+    {1, 2, 64},
+    {16, 64}
+};
+
+const auto fcWeightsDecompressionParams = ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                                             ::testing::Values(10, 32),
+                                                             ::testing::Values(true, false),
+                                                             ::testing::Values(element::u8, element::i8),
+                                                             ::testing::Values(true, false));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsDecompression, FCWeightsDecompressionTest, fcWeightsDecompressionParams,
+                         FCWeightsDecompressionTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,104 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "exec_graph_info.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+// Layout agnostic chain between two convolutions: the node by node selection propagates the blocked layout
+// of the first convolution down the chain until the Transpose, the whole-graph selection may move the layout
+// change to a cheaper place, but never adds reorders
+//
+//    Param
+//      |
+//    Conv
+//      |
+//    Relu
+//      |
+//  Transpose
+//      |
+//   Multiply
+//      |
+//     Add
+//      |
+//    Conv
+//
+class GlobalLayoutSelection : virtual public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[PluginConfigInternalParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION] = PluginConfigParams::YES;
+
+        const size_t channels = 16;
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, channels, 20, 12}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto conv1 = builder::makeConvolution(paramOuts[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                              op::PadType::EXPLICIT, channels);
+        auto relu = builder::makeActivation(conv1, ngPrc, helpers::ActivationTypes::Relu);
+        auto order = opset1::Constant::create(element::i64, Shape{4}, {0, 1, 3, 2});
+        auto transpose = std::make_shared<opset1::Transpose>(relu, order);
+        auto scale = builder::makeConstant<float>(ngPrc, {1}, {0.5f});
+        auto multiply = builder::makeEltwise(transpose, scale, helpers::EltwiseTypes::MULTIPLY);
+        auto shift = builder::makeConstant<float>(ngPrc, {1, channels, 1, 1}, {}, true, 1.f, -1.f);
+        auto add = builder::makeEltwise(multiply, shift, helpers::EltwiseTypes::ADD);
+        auto conv2 = builder::makeConvolution(add, ngPrc, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                              op::PadType::EXPLICIT, channels);
+
+        function = std::make_shared<Function>(NodeVector{conv2}, inputParams, "GlobalLayoutSelection");
+    }
+
+    static size_t countNodesOfType(ExecutableNetwork& execNet, const std::string& nodeType) {
+        auto function = execNet.GetExecGraphInfo().getFunction();
+        size_t count = 0;
+        for (const auto& node : function->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            IE_ASSERT(rtInfo.end() != it);
+            auto value = std::dynamic_pointer_cast<VariantImpl<std::string>>(it->second);
+            IE_ASSERT(nullptr != value);
+            if (value->get() == nodeType)
+                count++;
+        }
+        return count;
+    }
+};
+
+TEST_F(GlobalLayoutSelection, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const auto reorders = executableNetwork.GetMetric(METRIC_KEY(CPU_LAYOUT_SELECTION_REORDERS))
+                              .as<std::tuple<unsigned int, unsigned int>>();
+    const auto reordersBefore = std::get<0>(reorders);
+    const auto reordersAfter = std::get<1>(reorders);
+    EXPECT_LE(reordersAfter, reordersBefore);
+
+    // the same network with the node by node selection only
+    auto greedyNetwork = getCore()->LoadNetwork(CNNNetwork(function), targetDevice,
+        {{PluginConfigInternalParams::KEY_CPU_GLOBAL_LAYOUT_SELECTION, PluginConfigParams::NO}});
+    const auto supportedMetrics = greedyNetwork.GetMetric(METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+    EXPECT_EQ(supportedMetrics.end(),
+              std::find(supportedMetrics.begin(), supportedMetrics.end(), METRIC_KEY(CPU_LAYOUT_SELECTION_REORDERS)));
+
+    const auto greedyReorders = countNodesOfType(greedyNetwork, "Reorder");
+    const auto globalReorders = countNodesOfType(executableNetwork, "Reorder");
+    EXPECT_LE(globalReorders, greedyReorders);
+    // the graph is left as is if the selection finds nothing better
+    if (reordersAfter == reordersBefore) {
+        EXPECT_EQ(greedyReorders, globalReorders);
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,71 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+// Inception-like block: independent branches are executed concurrently in inter-op parallel mode,
+// so their outputs must not share memory
+//
+//            Param
+//   /      /       \        \
+// Conv   Conv     Conv    MaxPool
+//  |       |        |        |
+// Relu  Sigmoid    Conv     Conv
+//   \      \       /        /
+//            Concat
+//
+class InterOpParallelBranches : public testing::WithParamInterface<bool>,
+                                virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<bool> obj) {
+        std::ostringstream result;
+        result << "InterOpParallelism=" << (obj.param ? "YES" : "NO");
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLELISM] =
+            GetParam() ? PluginConfigParams::YES : PluginConfigParams::NO;
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 16, 20, 20}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto makeConv = [&](const Output<Node>& in, size_t kernel, size_t outChannels) {
+            const auto pad = static_cast<ptrdiff_t>(kernel / 2);
+            return builder::makeConvolution(in, ngPrc, {kernel, kernel}, {1, 1}, {pad, pad}, {pad, pad}, {1, 1},
+                                            op::PadType::EXPLICIT, outChannels);
+        };
+
+        auto branch1 = builder::makeActivation(makeConv(paramOuts[0], 1, 8), ngPrc, helpers::ActivationTypes::Relu);
+        auto branch2 = builder::makeActivation(makeConv(paramOuts[0], 3, 8), ngPrc, helpers::ActivationTypes::Sigmoid);
+        auto branch3 = makeConv(makeConv(paramOuts[0], 1, 4), 3, 8);
+        auto pool = builder::makePooling(paramOuts[0], {1, 1}, {1, 1}, {1, 1}, {3, 3}, op::RoundingType::FLOOR,
+                                         op::PadType::EXPLICIT, false, helpers::PoolingTypes::MAX);
+        auto branch4 = makeConv(pool, 1, 8);
+
+        auto concat = builder::makeConcat({branch1, branch2, branch3, branch4}, 1);
+        function = std::make_shared<Function>(NodeVector{concat}, inputParams, "InterOpParallelBranches");
+    }
+};
+
+TEST_P(InterOpParallelBranches, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_InterOpParallel, InterOpParallelBranches, ::testing::Bool(),
+                         InterOpParallelBranches::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,147 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_system_conf.h"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/opsets/opset5.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *                                        Constant(i8)       Constant(i8)
+ *                                             |                  |
+ *    Parameter(X)   Parameter(H)           Convert            Convert
+ *         |              |                    |                  |
+ *    FakeQuantize   FakeQuantize          Multiply(W)        Multiply(R)
+ *          \             |    Parameter(C)   /                  /
+ *           \            |        |         /                  /
+ *                 LSTMCell / LSTMSequence   <------------------
+ *                            |
+ *                          Result
+ *
+ * X and H share the u8 quantization, W and R are quantized per output channel with the same scales, so
+ * the cell runs in int8 on avx512_core: the data quantization goes to the primitive attributes and the weights
+ * are quantized back with the scales by the reorder to the packed format. Without the weights quantization
+ * the cell stays in fp32.
+ */
+
+using LSTMInt8Params = std::tuple<bool,      // sequence
+                                  size_t,    // batch
+                                  bool>;     // quantized weights
+
+class LSTMInt8Test : public testing::WithParamInterface<LSTMInt8Params>,
+                     virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<LSTMInt8Params> obj) {
+        bool sequence;
+        size_t batch;
+        bool quantizedWeights;
+        std::tie(sequence, batch, quantizedWeights) = obj.param;
+
+        std::ostringstream result;
+        result << (sequence ? "LSTMSequence" : "LSTMCell") << "_";
+        result << "Batch=" << batch << "_";
+        result << "QuantizedWeights=" << quantizedWeights;
+        return result.str();
+    }
+
+    Blob::Ptr GenerateInput(const InputInfo& info) const override {
+        // hidden and cell states of LSTM are in [-1, 1]
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 2, -1, 100);
+    }
+
+protected:
+    const size_t inputSize = 24;
+    const size_t hiddenSize = 16;
+    const size_t seqLength = 3;
+
+    std::shared_ptr<Node> makeWeights(const Shape& shape, const Shape& scalesShape, const std::vector<float>& scales, const bool quantized) {
+        if (!quantized)
+            return builder::makeConstant<float>(element::f32, shape, {}, true, 0.5f, -0.5f);
+
+        auto weights = builder::makeConstant<float>(element::i8, shape, {}, true, 127.f, -128.f);
+        auto convert = std::make_shared<opset5::Convert>(weights, element::f32);
+        return std::make_shared<opset5::Multiply>(convert, opset5::Constant::create(element::f32, scalesShape, scales));
+    }
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        // int8 tolerance: the data are quantized with the step of 0.01
+        threshold = 0.05f;
+
+        bool sequence;
+        size_t batch;
+        bool quantizedWeights;
+        std::tie(sequence, batch, quantizedWeights) = this->GetParam();
+
+        const size_t gates = 4;
+        const SizeVector dataShape = sequence ? SizeVector{batch, seqLength, inputSize} : SizeVector{batch, inputSize};
+        const SizeVector stateShape = sequence ? SizeVector{batch, 1, hiddenSize} : SizeVector{batch, hiddenSize};
+        // the sequence weights have num_directions dimension
+        const Shape prefix = sequence ? Shape{1} : Shape{};
+        auto withPrefix = [&](const Shape& shape) {
+            Shape result = prefix;
+            result.insert(result.end(), shape.begin(), shape.end());
+            return result;
+        };
+
+        auto params = builder::makeParams(element::f32, {dataShape, stateShape, stateShape});
+        auto quantizeData = [](const Output<Node>& input) {
+            return builder::makeFakeQuantize(input, element::f32, 256, {}, {-1.28f}, {1.27f}, {-1.28f}, {1.27f});
+        };
+        auto data = quantizeData(params[0]);
+        auto hiddenState = quantizeData(params[1]);
+
+        std::vector<float> scales(gates * hiddenSize);
+        for (size_t i = 0; i < scales.size(); i++)
+            scales[i] = 0.001f * static_cast<float>(1 + i % 5);
+        const auto scalesShape = withPrefix({gates * hiddenSize, 1});
+        auto W = makeWeights(withPrefix({gates * hiddenSize, inputSize}), scalesShape, scales, quantizedWeights);
+        auto R = makeWeights(withPrefix({gates * hiddenSize, hiddenSize}), scalesShape, scales, quantizedWeights);
+        auto B = builder::makeConstant<float>(element::f32, withPrefix({gates * hiddenSize}), {}, true, 0.1f, -0.1f);
+
+        std::shared_ptr<Node> lstm;
+        if (sequence) {
+            auto seqLengths = opset5::Constant::create(element::i64, Shape{batch}, std::vector<int64_t>(batch, seqLength));
+            lstm = std::make_shared<opset5::LSTMSequence>(data, hiddenState, params[2], seqLengths, W, R, B, hiddenSize,
+                                                          op::RecurrentSequenceDirection::FORWARD);
+        } else {
+            lstm = std::make_shared<opset5::LSTMCell>(data, hiddenState, params[2], W, R, B, hiddenSize);
+        }
+
+        ResultVector results;
+        for (size_t i = 0; i < lstm->get_output_size(); i++)
+            results.push_back(std::make_shared<opset5::Result>(lstm->output(i)));
+        function = std::make_shared<Function>(results, params, "LSTMInt8");
+    }
+};
+
+TEST_P(LSTMInt8Test, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    bool sequence;
+    size_t batch;
+    bool quantizedWeights;
+    std::tie(sequence, batch, quantizedWeights) = this->GetParam();
+    const bool int8 = quantizedWeights && with_cpu_x86_avx512_core();
+    EXPECT_EQ(int8 ? "U8" : "FP32", getRuntimePrecisionByType(sequence ? "RNNSeq" : "RNNCell"));
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_LSTMInt8, LSTMInt8Test,
+                         ::testing::Combine(::testing::Values(true, false),
+                                            ::testing::Values(1, 5),
+                                            ::testing::Values(true, false)),
+                         LSTMInt8Test::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,154 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *         Q         K
+ *          \       /
+ *            MatMul
+ *              |
+ *           Multiply (scale)
+ *              |
+ *             Add  <--- mask (optional)
+ *              |
+ *           Softmax      V
+ *               \       /
+ *                 MatMul
+ *                   |
+ *                 Result
+ *
+ * The subgraph is fused into the MultiHeadAttention node.
+ */
+
+using MHAParams = std::tuple<SizeVector,           // Q shape [..., Sq, D]
+                             size_t,               // K sequence length
+                             size_t,               // V head size
+                             bool,                 // transpose K
+                             bool>;                // with mask
+
+class MHATest : public testing::WithParamInterface<MHAParams>,
+                virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MHAParams> obj) {
+        SizeVector qShape;
+        size_t seqLenK;
+        size_t headSizeV;
+        bool transposeK;
+        bool withMask;
+        std::tie(qShape, seqLenK, headSizeV, transposeK, withMask) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(qShape) << "_";
+        result << "Sk=" << seqLenK << "_";
+        result << "Dv=" << headSizeV << "_";
+        result << "Transp_K=" << transposeK << "_";
+        result << "Mask=" << withMask;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector qShape;
+        size_t seqLenK;
+        size_t headSizeV;
+        bool transposeK;
+        bool withMask;
+        std::tie(qShape, seqLenK, headSizeV, transposeK, withMask) = this->GetParam();
+
+        const size_t rank = qShape.size();
+        const size_t headSize = qShape.back();
+        SizeVector kShape(qShape.begin(), qShape.end() - 2);
+        SizeVector vShape = kShape;
+        if (transposeK) {
+            kShape.insert(kShape.end(), {seqLenK, headSize});
+        } else {
+            kShape.insert(kShape.end(), {headSize, seqLenK});
+        }
+        vShape.insert(vShape.end(), {seqLenK, headSizeV});
+
+        auto params = builder::makeParams(element::f32, {qShape, kShape, vShape});
+        auto matMulQK = builder::makeMatMul(params[0], params[1], false, transposeK);
+        auto scale = builder::makeConstant<float>(element::f32, {}, {1.f / std::sqrt(static_cast<float>(headSize))});
+        std::shared_ptr<Node> scores = std::make_shared<opset1::Multiply>(matMulQK, scale);
+        if (withMask) {
+            // BERT-like mask which is broadcast over the heads and the queries
+            SizeVector maskShape(rank, 1);
+            maskShape[0] = qShape[0];
+            maskShape.back() = seqLenK;
+            auto maskParams = builder::makeParams(element::f32, {maskShape});
+            params.push_back(maskParams[0]);
+            scores = std::make_shared<opset1::Add>(scores, maskParams[0]);
+        }
+        auto softmax = std::make_shared<opset1::Softmax>(scores, rank - 1);
+        auto matMulV = builder::makeMatMul(softmax, params[2], false, false);
+
+        ResultVector results{std::make_shared<opset1::Result>(matMulV)};
+        function = std::make_shared<Function>(results, params, "MHA");
+    }
+};
+
+TEST_P(MHATest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "MultiHeadAttention", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Softmax", 0);
+}
+
+// The exported network is serialized after the transformations, so the fused node must be read back by the import
+class MHAExportImportTest : public MHATest {};
+
+TEST_P(MHAExportImportTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    std::stringstream model;
+    executableNetwork.Export(model);
+    executableNetwork = core->ImportNetwork(model, targetDevice, configuration);
+    CheckNodeOfTypeCount(executableNetwork, "MultiHeadAttention", 1);
+    Infer();
+    Validate();
+}
+
+namespace {
+
+const std::vector<SizeVector> qShapes = {
+    {1, 4, 16, 64},
+    {2, 2, 7, 32},
+    {3, 10, 24}
+};
+
+const auto mhaParams = ::testing::Combine(::testing::ValuesIn(qShapes),
+                                          ::testing::Values(16, 37, 300),
+                                          ::testing::Values(32, 24, 20),
+                                          ::testing::Values(true, false),
+                                          ::testing::Values(true, false));
+
+INSTANTIATE_TEST_SUITE_P(smoke_MHA, MHATest, mhaParams, MHATest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MHA, MHAExportImportTest,
+                         ::testing::Combine(::testing::Values(SizeVector{1, 4, 16, 64}),
+                                            ::testing::Values(37),
+                                            ::testing::Values(32),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(true, false)),
+                         MHATest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
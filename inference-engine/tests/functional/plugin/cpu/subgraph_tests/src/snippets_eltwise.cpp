@@ -0,0 +1,95 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+// Elementwise chain which is collapsed into a single snippet, the second input is broadcasted along
+// different dimensions to cover dense, broadcasted and tail accesses of the generated kernel
+//
+//   Param0   Param1
+//       \    /   |
+//        Add     |
+//       /   \    |
+//    Relu   Multiply
+//       \    /
+//      Subtract
+//
+using SnippetsEltwiseParams = std::tuple<std::vector<size_t>,  // first input shape
+                                         std::vector<size_t>,  // second input shape
+                                         bool>;                // snippets mode
+
+class SnippetsEltwise : public testing::WithParamInterface<SnippetsEltwiseParams>,
+                        virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<SnippetsEltwiseParams> obj) {
+        std::vector<size_t> inputShape0, inputShape1;
+        bool enableSnippets;
+        std::tie(inputShape0, inputShape1, enableSnippets) = obj.param;
+
+        std::ostringstream result;
+        result << "IS0=" << CommonTestUtils::vec2str(inputShape0) << "_";
+        result << "IS1=" << CommonTestUtils::vec2str(inputShape1) << "_";
+        result << "Snippets=" << (enableSnippets ? "YES" : "NO");
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::vector<size_t> inputShape0, inputShape1;
+        bool enableSnippets;
+        std::tie(inputShape0, inputShape1, enableSnippets) = GetParam();
+        configuration[PluginConfigInternalParams::KEY_CPU_SNIPPETS_MODE] =
+            enableSnippets ? PluginConfigParams::YES : PluginConfigParams::NO;
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {inputShape0, inputShape1});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto add = builder::makeEltwise(paramOuts[0], paramOuts[1], helpers::EltwiseTypes::ADD);
+        auto relu = builder::makeActivation(add, ngPrc, helpers::ActivationTypes::Relu);
+        auto mul = builder::makeEltwise(add, paramOuts[1], helpers::EltwiseTypes::MULTIPLY);
+        auto sub = builder::makeEltwise(relu, mul, helpers::EltwiseTypes::SUBTRACT);
+
+        function = std::make_shared<Function>(NodeVector{sub}, inputParams, "SnippetsEltwise");
+    }
+};
+
+TEST_P(SnippetsEltwise, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+const std::vector<std::vector<size_t>> inputShapes0 = {
+    {1, 3, 10, 17},
+    {2, 16, 7, 64},
+};
+
+const std::vector<std::vector<size_t>> inputShapes1 = {
+    {1, 1, 1, 1},
+    {1, 1, 1, 17},
+    {1, 3, 1, 1},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsEltwise_Broadcast, SnippetsEltwise,
+                         ::testing::Combine(::testing::Values(std::vector<size_t>{1, 3, 10, 17}),
+                                            ::testing::ValuesIn(inputShapes1),
+                                            ::testing::Bool()),
+                         SnippetsEltwise::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsEltwise_ScalarInput, SnippetsEltwise,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes0),
+                                            ::testing::Values(std::vector<size_t>{1}),
+                                            ::testing::Bool()),
+                         SnippetsEltwise::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,87 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+// TensorIterator whose ports may be bound without copies: the sliced input and the concatenated output
+// are dense chunks of the outer tensors and the back edge output is consumed only by the next iteration
+//
+//   X (sliced)   H (back edge)
+//          \     /
+//            Add
+//          /     \
+//   Multiply     Relu
+//      |           |
+//   H_next    Y (concatenated)
+//
+using TensorIteratorZeroCopyParams = std::tuple<size_t,   // sequence length
+                                                int64_t>; // iteration stride
+
+class TensorIteratorZeroCopy : public testing::WithParamInterface<TensorIteratorZeroCopyParams>,
+                               virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<TensorIteratorZeroCopyParams> obj) {
+        size_t seqLength;
+        int64_t stride;
+        std::tie(seqLength, stride) = obj.param;
+
+        std::ostringstream result;
+        result << "SeqLen=" << seqLength << "_";
+        result << "Stride=" << stride;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        size_t seqLength;
+        int64_t stride;
+        std::tie(seqLength, stride) = GetParam();
+        const size_t channels = 16;
+
+        auto ngPrc = element::f32;
+        auto outerParams = builder::makeParams(ngPrc, {{1, seqLength, channels}, {1, 1, channels}});
+
+        auto bodyParams = builder::makeParams(ngPrc, {{1, 1, channels}, {1, 1, channels}});
+        auto add = std::make_shared<opset1::Add>(bodyParams[0], bodyParams[1]);
+        auto scale = builder::makeConstant<float>(ngPrc, {1}, {0.5f});
+        auto hNext = std::make_shared<opset1::Multiply>(add, scale);
+        auto y = builder::makeActivation(add, ngPrc, helpers::ActivationTypes::Relu);
+
+        auto hResult = std::make_shared<opset1::Result>(hNext);
+        auto yResult = std::make_shared<opset1::Result>(y);
+        auto body = std::make_shared<Function>(ResultVector{hResult, yResult}, bodyParams, "body");
+
+        auto tensorIterator = std::make_shared<opset1::TensorIterator>();
+        tensorIterator->set_body(body);
+        if (stride > 0)
+            tensorIterator->set_sliced_input(bodyParams[0], outerParams[0], 0, stride, 1, -1, 1);
+        else
+            tensorIterator->set_sliced_input(bodyParams[0], outerParams[0], -1, stride, 1, 0, 1);
+        tensorIterator->set_merged_input(bodyParams[1], outerParams[1], hResult);
+        auto out = stride > 0 ? tensorIterator->get_concatenated_slices(yResult, 0, stride, 1, -1, 1)
+                              : tensorIterator->get_concatenated_slices(yResult, -1, stride, 1, 0, 1);
+
+        function = std::make_shared<Function>(OutputVector{out}, outerParams, "TensorIteratorZeroCopy");
+    }
+};
+
+TEST_P(TensorIteratorZeroCopy, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorZeroCopy, TensorIteratorZeroCopy,
+                         ::testing::Combine(::testing::Values(1, 5, 24),
+                                            ::testing::Values(1, -1)),
+                         TensorIteratorZeroCopy::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,84 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "ngraph/opsets/opset8.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+// Accumulator: ReadValue reads one state buffer and Assign writes the other one, the request swaps them
+// and redirects the graph edges to the buffers before every inference
+//
+//   Param   ReadValue
+//       \   /
+//        Add ---> Assign
+//         |
+//       Result
+//
+TEST(VariableStateDoubleBuffer, smoke_StateFollowsConsecutiveInfers) {
+    const size_t size = 16;
+    auto params = builder::makeParams(element::f32, {{1, size}});
+    auto variable = std::make_shared<Variable>(VariableInfo{PartialShape{1, size}, element::f32, "accumulator"});
+    auto init = opset8::Constant::create(element::f32, Shape{1, size}, {0.f});
+    auto read = std::make_shared<opset8::ReadValue>(init, variable);
+    auto add = std::make_shared<opset8::Add>(read, params[0]);
+    auto assign = std::make_shared<opset8::Assign>(add, variable);
+    auto result = std::make_shared<opset8::Result>(add);
+    auto function = std::make_shared<Function>(ResultVector{result}, SinkVector{assign}, params, "Accumulator");
+
+    auto ie = PluginCache::get().ie();
+    auto execNet = ie->LoadNetwork(CNNNetwork(function), CommonTestUtils::DEVICE_CPU);
+    const auto inputName = execNet.GetInputsInfo().begin()->first;
+    const auto outputName = execNet.GetOutputsInfo().begin()->first;
+
+    // both requests share the graph, but own their state buffers
+    auto request = execNet.CreateInferRequest();
+    auto otherRequest = execNet.CreateInferRequest();
+    std::vector<float> input(size);
+    for (size_t i = 0; i < size; i++)
+        input[i] = 0.5f * static_cast<float>(i + 1);
+    for (auto* req : {&request, &otherRequest}) {
+        auto blob = req->GetBlob(inputName);
+        std::copy(input.begin(), input.end(), blob->buffer().as<float*>());
+    }
+
+    auto states = request.QueryState();
+    ASSERT_EQ(1u, states.size());
+    auto heldState = states.front().GetState();
+
+    auto expectScaledInput = [&](const Blob::CPtr& blob, float scale) {
+        ASSERT_EQ(size, blob->size());
+        const auto data = blob->cbuffer().as<const float*>();
+        for (size_t i = 0; i < size; i++)
+            ASSERT_FLOAT_EQ(scale * input[i], data[i]) << "at " << i;
+    };
+
+    // the second inference reads the buffer written by the first one
+    for (int step = 1; step <= 3; step++) {
+        request.Infer();
+        expectScaledInput(request.GetBlob(outputName), static_cast<float>(step));
+    }
+
+    // the state blob given to the user stays the same and shows the current value on read
+    auto currentState = request.QueryState().front().GetState();
+    EXPECT_EQ(heldState.get(), currentState.get());
+    expectScaledInput(currentState, 3.f);
+
+    otherRequest.Infer();
+    expectScaledInput(otherRequest.GetBlob(outputName), 1.f);
+
+    // the new value is bound to the graph by the next inference
+    states.front().Reset();
+    request.Infer();
+    expectScaledInput(request.GetBlob(outputName), 1.f);
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,37 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <ngraph/ngraph.hpp>
+
+#include "lpt_ngraph_functions/common/dequantization_operations.hpp"
+
+namespace ngraph {
+namespace builder {
+namespace subgraph {
+
+class RecurrentCellFunction {
+public:
+    static std::shared_ptr<ngraph::Function> getOriginal(
+        const ngraph::element::Type inputPrecision,
+        const ngraph::Shape& inputShape,
+        const size_t hiddenSize,
+        const ngraph::builder::subgraph::DequantizationOperations& dequantizationOnData,
+        const ngraph::builder::subgraph::DequantizationOperations& dequantizationOnHiddenState,
+        const ngraph::builder::subgraph::DequantizationOperations& dequantizationOnWeights);
+
+    static std::shared_ptr<ngraph::Function> getReference(
+        const ngraph::element::Type inputPrecision,
+        const ngraph::Shape& inputShape,
+        const size_t hiddenSize,
+        const ngraph::builder::subgraph::DequantizationOperations& dequantizationOnWeights);
+};
+
+}  // namespace subgraph
+}  // namespace builder
+}  // namespace ngraph
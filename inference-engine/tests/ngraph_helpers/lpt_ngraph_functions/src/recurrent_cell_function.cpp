@@ -0,0 +1,130 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "lpt_ngraph_functions/recurrent_cell_function.hpp"
+
+#include <ngraph_ops/type_relaxed.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include "lpt_ngraph_functions/common/builders.hpp"
+
+namespace ngraph {
+namespace builder {
+namespace subgraph {
+
+namespace {
+
+// W and R: [num_directions, 4 * hidden_size, columns] of i8 values which are dequantized or folded with the dequantization,
+// the weights are f32 without dequantization
+std::shared_ptr<ngraph::Node> makeWeights(
+    const size_t channels,
+    const size_t columns,
+    const int8_t value,
+    const DequantizationOperations& dequantization,
+    const bool fold) {
+    const Shape shape{ 1ul, channels, columns };
+    if (dequantization.empty()) {
+        return std::make_shared<ngraph::opset1::Constant>(element::f32, shape, std::vector<float>{ 0.01f * value });
+    }
+
+    if (!fold) {
+        const auto weights = std::make_shared<ngraph::opset1::Constant>(element::i8, shape, std::vector<int8_t>{ value });
+        return makeDequantization(weights, dequantization);
+    }
+
+    const auto& scales = dequantization.multiply.values;
+    std::vector<float> folded(shape_size(shape));
+    for (size_t i = 0; i < folded.size(); ++i) {
+        folded[i] = value * (scales.size() == 1ul ? scales[0] : scales[(i / columns) % channels]);
+    }
+    return std::make_shared<ngraph::opset1::Constant>(element::f32, shape, folded);
+}
+
+// X: [batch, seq_length, input_size], H and C: [batch, num_directions, hidden_size]
+ngraph::OutputVector makeSequenceConstants(
+    const ngraph::Shape& inputShape,
+    const size_t hiddenSize,
+    const DequantizationOperations& dequantizationOnWeights,
+    const bool foldWeights) {
+    const size_t batch = inputShape[0];
+    const size_t seqLength = inputShape[1];
+    const size_t inputSize = inputShape[2];
+    const size_t gates = 4ul;
+
+    return {
+        std::make_shared<ngraph::opset1::Constant>(element::f32, Shape{ batch, 1ul, hiddenSize }, std::vector<float>{ 0.f }),
+        std::make_shared<ngraph::opset1::Constant>(element::i64, Shape{ batch }, std::vector<int64_t>(batch, seqLength)),
+        makeWeights(gates * hiddenSize, inputSize, 10, dequantizationOnWeights, foldWeights),
+        makeWeights(gates * hiddenSize, hiddenSize, -20, dequantizationOnWeights, foldWeights),
+        std::make_shared<ngraph::opset1::Constant>(element::f32, Shape{ 1ul, gates * hiddenSize }, std::vector<float>{ 0.3f })
+    };
+}
+
+std::shared_ptr<ngraph::Function> makeFunction(
+    const std::shared_ptr<ngraph::Node>& sequence,
+    const ngraph::ParameterVector& parameters) {
+    sequence->set_friendly_name("output");
+    ngraph::ResultVector results{
+        std::make_shared<ngraph::opset1::Result>(sequence->output(0)),
+        std::make_shared<ngraph::opset1::Result>(sequence->output(1)),
+        std::make_shared<ngraph::opset1::Result>(sequence->output(2))
+    };
+    return std::make_shared<ngraph::Function>(results, parameters, "RecurrentCellTransformation");
+}
+
+} // namespace
+
+std::shared_ptr<ngraph::Function> RecurrentCellFunction::getOriginal(
+    const ngraph::element::Type inputPrecision,
+    const ngraph::Shape& inputShape,
+    const size_t hiddenSize,
+    const ngraph::builder::subgraph::DequantizationOperations& dequantizationOnData,
+    const ngraph::builder::subgraph::DequantizationOperations& dequantizationOnHiddenState,
+    const ngraph::builder::subgraph::DequantizationOperations& dequantizationOnWeights) {
+    const auto data = std::make_shared<ngraph::opset1::Parameter>(inputPrecision, inputShape);
+    const auto hiddenState = std::make_shared<ngraph::opset1::Parameter>(inputPrecision, Shape{ inputShape[0], 1ul, hiddenSize });
+
+    const auto constants = makeSequenceConstants(inputShape, hiddenSize, dequantizationOnWeights, false);
+    const auto sequence = std::make_shared<ngraph::opset5::LSTMSequence>(
+        makeDequantization(data, dequantizationOnData),
+        makeDequantization(hiddenState, dequantizationOnHiddenState),
+        constants[0],
+        constants[1],
+        constants[2],
+        constants[3],
+        constants[4],
+        hiddenSize,
+        ngraph::op::RecurrentSequenceDirection::FORWARD);
+
+    return makeFunction(sequence, { data, hiddenState });
+}
+
+std::shared_ptr<ngraph::Function> RecurrentCellFunction::getReference(
+    const ngraph::element::Type inputPrecision,
+    const ngraph::Shape& inputShape,
+    const size_t hiddenSize,
+    const ngraph::builder::subgraph::DequantizationOperations& dequantizationOnWeights) {
+    const auto data = std::make_shared<ngraph::opset1::Parameter>(inputPrecision, inputShape);
+    const auto hiddenState = std::make_shared<ngraph::opset1::Parameter>(inputPrecision, Shape{ inputShape[0], 1ul, hiddenSize });
+
+    const auto constants = makeSequenceConstants(inputShape, hiddenSize, dequantizationOnWeights, true);
+    const auto sequence = std::make_shared<ngraph::op::TypeRelaxed<ngraph::opset5::LSTMSequence>>(
+        std::vector<ngraph::element::Type>{ element::f32, element::f32, element::f32, element::i64, element::f32, element::f32, element::f32 },
+        std::vector<ngraph::element::Type>{ element::f32, element::f32, element::f32 },
+        ngraph::op::TemporaryReplaceOutputType(data, element::f32).get(),
+        ngraph::op::TemporaryReplaceOutputType(hiddenState, element::f32).get(),
+        constants[0],
+        constants[1],
+        constants[2],
+        constants[3],
+        constants[4],
+        hiddenSize,
+        ngraph::op::RecurrentSequenceDirection::FORWARD);
+
+    return makeFunction(sequence, { data, hiddenState });
+}
+
+}  // namespace subgraph
+}  // namespace builder
+}  // namespace ngraph
@@ -0,0 +1,89 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <gtest/gtest.h>
+
+#include "common/fft.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+std::vector<double> referenceDFT(const std::vector<float>& data, bool inverse) {
+    const size_t nComplex = data.size() / 2;
+    const double sign = inverse ? 1.0 : -1.0;
+    std::vector<double> result(data.size());
+    for (size_t k = 0; k < nComplex; ++k) {
+        double real = 0.0;
+        double imag = 0.0;
+        for (size_t n = 0; n < nComplex; ++n) {
+            const double angle = sign * 2.0 * M_PI * static_cast<double>((n * k) % nComplex) / static_cast<double>(nComplex);
+            real += data[2 * n] * std::cos(angle) - data[2 * n + 1] * std::sin(angle);
+            imag += data[2 * n] * std::sin(angle) + data[2 * n + 1] * std::cos(angle);
+        }
+        result[2 * k] = inverse ? real / nComplex : real;
+        result[2 * k + 1] = inverse ? imag / nComplex : imag;
+    }
+    return result;
+}
+
+using FFTPlanTestParams = std::tuple<size_t,  // number of complex values
+                                     bool,    // inverse
+                                     bool>;   // parallelize
+
+class FFTPlanTest : public testing::TestWithParam<FFTPlanTestParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FFTPlanTestParams>& obj) {
+        size_t nComplex;
+        bool inverse, parallelize;
+        std::tie(nComplex, inverse, parallelize) = obj.param;
+        std::ostringstream result;
+        result << "N" << nComplex << (inverse ? "_inverse" : "_forward") << (parallelize ? "_parallel" : "");
+        return result.str();
+    }
+};
+
+TEST_P(FFTPlanTest, MatchesReferenceDFT) {
+    size_t nComplex;
+    bool inverse, parallelize;
+    std::tie(nComplex, inverse, parallelize) = GetParam();
+
+    std::mt19937 generator(static_cast<unsigned>(nComplex));
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    std::vector<float> data(2 * nComplex);
+    for (auto& value : data) {
+        value = distribution(generator);
+    }
+    const auto expected = referenceDFT(data, inverse);
+
+    FFTPlan plan(nComplex, inverse);
+    ASSERT_EQ(nComplex, plan.size());
+    std::vector<float> buffer(plan.bufferSize());
+    plan.execute(data.data(), buffer.data(), parallelize);
+
+    double maxValue = 0.0;
+    for (auto value : expected) {
+        maxValue = std::max(maxValue, std::fabs(value));
+    }
+    for (size_t i = 0; i < data.size(); ++i) {
+        ASSERT_NEAR(expected[i], data[i], 1e-5 * maxValue + 1e-6) << "at " << i;
+    }
+}
+
+// empty signal, powers of two, mixed radix 2/3/4/5, small primes handled by the generic butterfly and primes handled by Bluestein
+const std::vector<size_t> lengths = {
+    0, 1, 2, 3, 4, 5, 7, 8, 12, 13, 16, 30, 49, 60, 64, 97, 106, 169, 256, 400, 480, 512, 1009
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FFTPlan, FFTPlanTest,
+                         ::testing::Combine(::testing::ValuesIn(lengths),
+                                            ::testing::Bool(),
+                                            ::testing::Bool()),
+                         FFTPlanTest::getTestCaseName);
+
+}  // namespace
@@ -0,0 +1,95 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "utils/layout_assignment.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+// transition costs of two candidates (planar, blocked): a reorder costs 'reorder', the same layout is free
+std::vector<float> transition(float reorder) {
+    return {0.f, reorder,
+            reorder, 0.f};
+}
+
+}  // namespace
+
+TEST(LayoutAssignmentTest, KeepsInitialAssignmentWithoutGain) {
+    LayoutAssignment assignment;
+    auto a = assignment.addNode({1.f, 1.f}, 0);
+    auto b = assignment.addNode({1.f, 1.f}, 0);
+    assignment.addEdge(a, b, transition(10.f));
+
+    assignment.solve();
+    EXPECT_EQ(assignment.getSelected(a), 0u);
+    EXPECT_EQ(assignment.getSelected(b), 0u);
+    EXPECT_FLOAT_EQ(assignment.getTotalCost(), 2.f);
+}
+
+TEST(LayoutAssignmentTest, ChainFollowsFixedProducerAndConsumer) {
+    // blocked producer -> three layout agnostic nodes, greedily kept planar -> blocked consumer
+    LayoutAssignment assignment;
+    auto in = assignment.addNode({0.f}, 0);
+    std::vector<size_t> chain;
+    size_t prev = in;
+    for (int i = 0; i < 3; i++) {
+        chain.push_back(assignment.addNode({1.f, 1.f}, 0));
+        assignment.addEdge(prev, chain.back(), i == 0 ? std::vector<float>{10.f, 0.f} : transition(10.f));
+        prev = chain.back();
+    }
+    auto out = assignment.addNode({0.f}, 0);
+    assignment.addEdge(prev, out, {10.f, 0.f});
+    EXPECT_FLOAT_EQ(assignment.getTotalCost(), 23.f);
+
+    assignment.solve();
+    for (auto node : chain)
+        EXPECT_EQ(assignment.getSelected(node), 1u);
+    EXPECT_FLOAT_EQ(assignment.getTotalCost(), 3.f);
+}
+
+TEST(LayoutAssignmentTest, PaddingOutweighsReorder) {
+    // the blocked layout of the node is padded, so it is cheaper to reorder the small tensor
+    LayoutAssignment assignment;
+    auto in = assignment.addNode({0.f}, 0);
+    auto node = assignment.addNode({1.f, 100.f}, 1);
+    assignment.addEdge(in, node, {10.f, 0.f});
+
+    assignment.solve();
+    EXPECT_EQ(assignment.getSelected(node), 0u);
+    EXPECT_FLOAT_EQ(assignment.getTotalCost(), 11.f);
+}
+
+TEST(LayoutAssignmentTest, BranchesAgreeOnProducerLayout) {
+    // a -> b -> d (blocked only)
+    // a -> c -> d
+    LayoutAssignment assignment;
+    auto a = assignment.addNode({1.f, 1.f}, 0);
+    auto b = assignment.addNode({1.f, 1.f}, 0);
+    auto c = assignment.addNode({1.f, 1.f}, 0);
+    auto d = assignment.addNode({0.f}, 0);
+    assignment.addEdge(a, b, transition(10.f));
+    assignment.addEdge(a, c, transition(10.f));
+    assignment.addEdge(b, d, {10.f, 0.f});
+    assignment.addEdge(c, d, {10.f, 0.f});
+    EXPECT_FLOAT_EQ(assignment.getTotalCost(), 23.f);
+
+    assignment.solve();
+    EXPECT_EQ(assignment.getSelected(a), 1u);
+    EXPECT_EQ(assignment.getSelected(b), 1u);
+    EXPECT_EQ(assignment.getSelected(c), 1u);
+    EXPECT_FLOAT_EQ(assignment.getTotalCost(), 3.f);
+}
+
+TEST(LayoutAssignmentTest, ThrowsOnWrongEdges) {
+    LayoutAssignment assignment;
+    auto a = assignment.addNode({1.f, 1.f}, 0);
+    auto b = assignment.addNode({1.f}, 0);
+    EXPECT_ANY_THROW(assignment.addEdge(b, a, {0.f, 0.f}));
+    EXPECT_ANY_THROW(assignment.addEdge(a, b, transition(1.f)));
+    EXPECT_ANY_THROW(assignment.addNode({}, 0));
+}
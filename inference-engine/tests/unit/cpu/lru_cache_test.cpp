@@ -0,0 +1,101 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <gtest/gtest.h>
+
+#include "utils/lru_cache.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+struct IntKey {
+    int value;
+
+    size_t hash() const {
+        return hash_combine(0, value);
+    }
+
+    bool operator==(const IntKey& rhs) const {
+        return value == rhs.value;
+    }
+};
+
+struct StringKey {
+    std::string value;
+
+    size_t hash() const {
+        return hash_combine(0, value);
+    }
+
+    bool operator==(const StringKey& rhs) const {
+        return value == rhs.value;
+    }
+};
+
+}  // namespace
+
+TEST(LruCacheTest, ReturnsCachedValue) {
+    LruCache<IntKey, int> cache(2);
+    int builds = 0;
+    auto builder = [&](const IntKey& key) {
+        builds++;
+        return key.value * 10;
+    };
+
+    ASSERT_EQ(10, cache.getOrCreate({1}, builder));
+    ASSERT_EQ(10, cache.getOrCreate({1}, builder));
+    ASSERT_EQ(1, builds);
+    ASSERT_EQ(1u, cache.getHits());
+    ASSERT_EQ(1u, cache.getMisses());
+}
+
+TEST(LruCacheTest, EvictsLeastRecentlyUsed) {
+    LruCache<IntKey, int> cache(2);
+    int builds = 0;
+    auto builder = [&](const IntKey& key) {
+        builds++;
+        return key.value;
+    };
+
+    cache.getOrCreate({1}, builder);
+    cache.getOrCreate({2}, builder);
+    cache.getOrCreate({1}, builder);  // 1 becomes most recently used
+    cache.getOrCreate({3}, builder);  // evicts 2
+    ASSERT_EQ(2u, cache.size());
+    ASSERT_EQ(3, builds);
+
+    cache.getOrCreate({1}, builder);
+    ASSERT_EQ(3, builds);
+    cache.getOrCreate({2}, builder);
+    ASSERT_EQ(4, builds);
+}
+
+TEST(LruCacheTest, ZeroCapacityDisablesCaching) {
+    LruCache<IntKey, int> cache(0);
+    int builds = 0;
+    auto builder = [&](const IntKey& key) {
+        builds++;
+        return key.value;
+    };
+
+    cache.getOrCreate({1}, builder);
+    cache.getOrCreate({1}, builder);
+    ASSERT_EQ(2, builds);
+    ASSERT_EQ(0u, cache.size());
+}
+
+TEST(MultiCacheTest, SeparatesKeyTypes) {
+    MultiCache cache(10);
+    auto intValue = cache.getOrCreate<IntKey, std::string>({1}, [](const IntKey&) { return std::string("int"); });
+    auto strValue = cache.getOrCreate<StringKey, std::string>({"1"}, [](const StringKey&) { return std::string("string"); });
+    ASSERT_EQ("int", intValue);
+    ASSERT_EQ("string", strValue);
+
+    auto cached = cache.getOrCreate<IntKey, std::string>({1}, [](const IntKey&) { return std::string("other"); });
+    ASSERT_EQ("int", cached);
+    ASSERT_EQ(1u, cache.getHits());
+    ASSERT_EQ(2u, cache.getMisses());
+}
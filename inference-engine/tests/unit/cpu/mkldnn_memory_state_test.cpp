@@ -0,0 +1,65 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "mkldnn_memory_state.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+MKLDNNMemoryPtr makeStorage(const mkldnn::engine& eng, float value) {
+    auto storage = std::make_shared<MKLDNNMemory>(eng);
+    storage->Create(CpuBlockedMemoryDesc(Precision::FP32, Shape(SizeVector{2, 3})));
+    auto data = static_cast<float*>(storage->GetPtr());
+    for (size_t i = 0; i < 6; i++)
+        data[i] = value;
+    return storage;
+}
+}  // namespace
+
+TEST(VariableStateTest, SwapsPingPongBuffers) {
+    const mkldnn::engine eng(dnnl::engine::kind::cpu, 0);
+    MKLDNNVariableState state("var", makeStorage(eng, 1.f));
+
+    auto active = state.getActive();
+    auto inactive = state.getInactive();
+    ASSERT_NE(active->GetPtr(), inactive->GetPtr());
+    auto heldState = state.GetState();
+    ASSERT_EQ(1.f, heldState->cbuffer().as<const float*>()[5]);
+
+    static_cast<float*>(inactive->GetPtr())[0] = 2.f;
+    state.swapBuffers();
+    ASSERT_EQ(inactive, state.getActive());
+    ASSERT_EQ(active, state.getInactive());
+    // the blob given to the user doesn't change, it gets the value of the active buffer on read
+    ASSERT_EQ(heldState, state.GetState());
+    ASSERT_EQ(2.f, heldState->cbuffer().as<const float*>()[0]);
+}
+
+TEST(VariableStateTest, SetStateCopiesToBoundBuffer) {
+    const mkldnn::engine eng(dnnl::engine::kind::cpu, 0);
+    MKLDNNVariableState state("var", makeStorage(eng, 0.f));
+    const void* activePtr = state.getActive()->GetPtr();
+
+    auto newState = make_shared_blob<float>(TensorDesc(Precision::FP32, {2, 3}, Layout::NC));
+    newState->allocate();
+    for (size_t i = 0; i < newState->size(); i++)
+        newState->buffer().as<float*>()[i] = 3.f;
+
+    state.SetState(newState);
+    ASSERT_EQ(activePtr, state.getActive()->GetPtr());
+    ASSERT_EQ(3.f, static_cast<const float*>(activePtr)[4]);
+    ASSERT_EQ(3.f, state.GetState()->cbuffer().as<const float*>()[4]);
+
+    state.Reset();
+    ASSERT_EQ(0.f, static_cast<const float*>(activePtr)[4]);
+
+    auto wrongState = make_shared_blob<float>(TensorDesc(Precision::FP32, {2}, Layout::C));
+    wrongState->allocate();
+    ASSERT_THROW(state.SetState(wrongState), InferenceEngine::Exception);
+}
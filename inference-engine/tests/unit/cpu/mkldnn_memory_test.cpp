@@ -2,10 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstdint>
+#include <cstring>
 #include <utility>
 #include <gtest/gtest.h>
 
 #include "mkldnn_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -17,3 +20,43 @@ TEST(MemoryTest, SedDataCheck) {
 TEST(MemoryTest, SedDataWithAutoPadCheck) {
     GTEST_SKIP();
 }
+
+TEST(DynamicMemoryBlockTest, GrowsOnlyOnLargerRequest) {
+    MKLDNNDynamicMemoryBlock block;
+    auto first = block.acquire(1024);
+    ASSERT_NE(nullptr, first);
+    ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(first.get()) % 64);
+    ASSERT_EQ(1u, block.getReallocationsCount());
+
+    ASSERT_EQ(first, block.acquire(512));
+    ASSERT_EQ(first, block.acquire(1024));
+    ASSERT_EQ(1u, block.getReallocationsCount());
+
+    auto second = block.acquire(2048);
+    ASSERT_NE(first, second);
+    ASSERT_EQ(2048u, block.getSize());
+    ASSERT_EQ(2u, block.getReallocationsCount());
+    // previous buffer stays valid while it is used
+    memset(first.get(), 0, 1024);
+}
+
+TEST(DynamicMemoryBlockTest, RedefineReusesBlockMemory) {
+    mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    auto block = std::make_shared<MKLDNNDynamicMemoryBlock>();
+    MKLDNNMemory memory(eng);
+    memory.Create(CpuBlockedMemoryDesc(Precision::FP32, Shape(ngraph::PartialShape{-1, 16})));
+    memory.setDynamicMemoryBlock(block);
+
+    memory.redefineDesc(CpuBlockedMemoryDesc(Precision::FP32, Shape(SizeVector{8, 16})));
+    auto data = memory.GetData();
+    ASSERT_FALSE(memory.isUsedExternalStorage());
+
+    memory.redefineDesc(CpuBlockedMemoryDesc(Precision::FP32, Shape(SizeVector{4, 16})));
+    ASSERT_EQ(data, memory.GetData());
+    memory.redefineDesc(CpuBlockedMemoryDesc(Precision::FP32, Shape(SizeVector{8, 16})));
+    ASSERT_EQ(data, memory.GetData());
+    ASSERT_EQ(1u, block->getReallocationsCount());
+
+    memory.redefineDesc(CpuBlockedMemoryDesc(Precision::FP32, Shape(SizeVector{16, 16})));
+    ASSERT_EQ(2u, block->getReallocationsCount());
+}
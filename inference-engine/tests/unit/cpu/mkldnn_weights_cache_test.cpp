@@ -0,0 +1,31 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_weights_cache.hpp"
+
+using namespace MKLDNNPlugin;
+
+TEST(SimpleDataHashTest, MatchesReferenceValues) {
+    const auto& hasher = MKLDNNWeightsSharing::GetHashFunc();
+    const unsigned char data[] = "abc";
+    ASSERT_EQ(0xEF46DB3751D8E999ULL, hasher.hash(data, 0));
+    ASSERT_EQ(0x44BC2CF5AD770999ULL, hasher.hash(data, 3));
+}
+
+TEST(SimpleDataHashTest, DetectsChangesInLargeData) {
+    const auto& hasher = MKLDNNWeightsSharing::GetHashFunc();
+    std::vector<unsigned char> data(3 * SimpleDataHash::chunkSize + 17);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<unsigned char>(i * 31);
+
+    const auto original = hasher.hash(data.data(), data.size());
+    ASSERT_EQ(original, hasher.hash(data.data(), data.size()));
+    ASSERT_NE(original, hasher.hash(data.data(), data.size() - 1));
+
+    data[2 * SimpleDataHash::chunkSize + 5] ^= 1;
+    ASSERT_NE(original, hasher.hash(data.data(), data.size()));
+}
@@ -0,0 +1,130 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+// the plugin is built with the software emulation routines
+#ifndef _NO_MKL_
+#define _NO_MKL_
+#endif
+#include "runtime/floatmath.h"
+
+namespace {
+
+using SgemmParams = std::tuple<
+    CBLAS_TRANSPOSE,    // transpose of A
+    CBLAS_TRANSPOSE,    // transpose of B
+    int,                // M
+    int,                // N
+    int                 // K
+>;
+
+std::vector<float> randomVector(size_t size, std::mt19937& generator) {
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::vector<float> result(size);
+    for (auto& value : result) {
+        value = distribution(generator);
+    }
+    return result;
+}
+
+class GNAFloatSgemmTest : public ::testing::TestWithParam<SgemmParams> {};
+
+TEST_P(GNAFloatSgemmTest, matchesReference) {
+    CBLAS_TRANSPOSE transA, transB;
+    int M, N, K;
+    std::tie(transA, transB, M, N, K) = GetParam();
+    std::mt19937 generator(M * N + K);
+
+    const auto A = randomVector(M * K, generator);
+    const auto B = randomVector(K * N, generator);
+    auto C = randomVector(M * N, generator);
+    const int lda = transA == CblasNoTrans ? K : M;
+    const int ldb = transB == CblasNoTrans ? N : K;
+
+    // beta = 1 accumulates into C for every supported combination of transposes
+    std::vector<double> expected(C.begin(), C.end());
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < N; j++) {
+            for (int k = 0; k < K; k++) {
+                const double a = transA == CblasNoTrans ? A[i * lda + k] : A[k * lda + i];
+                const double b = transB == CblasNoTrans ? B[k * ldb + j] : B[j * ldb + k];
+                expected[i * N + j] += a * b;
+            }
+        }
+    }
+
+    cblas_sgemm1(CblasRowMajor, transA, transB, M, N, K, 1.0f, A.data(), lda, B.data(), ldb, 1.0f, C.data(), N);
+    for (size_t i = 0; i < C.size(); i++) {
+        ASSERT_NEAR(expected[i], C[i], 1e-4) << "at index " << i;
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(GNAFloatMath, GNAFloatSgemmTest,
+    ::testing::Combine(
+        ::testing::Values(CblasNoTrans),
+        ::testing::Values(CblasNoTrans, CblasTrans),
+        ::testing::Values(1, 7, 256),
+        ::testing::Values(1, 4),
+        ::testing::Values(3, 16, 300)));
+
+INSTANTIATE_TEST_CASE_P(GNAFloatMathTransposedA, GNAFloatSgemmTest,
+    ::testing::Combine(
+        ::testing::Values(CblasTrans),
+        ::testing::Values(CblasNoTrans),
+        ::testing::Values(1, 256),
+        ::testing::Values(1, 4),
+        ::testing::Values(3, 300)));
+
+TEST(GNAFloatMathTest, sgemmSubsetMatchesReference) {
+    const int M = 128, N = 3, K = 500;
+    const std::vector<uint32_t> outputs = {127, 0, 5, 64, 64, 100};
+    const int L = static_cast<int>(outputs.size());
+    std::mt19937 generator(42);
+    const auto A = randomVector(M * K, generator);
+    const auto B = randomVector(K * N, generator);
+    auto C = randomVector(L * N, generator);
+
+    std::vector<double> expected(C.begin(), C.end());
+    for (int l = 0; l < L; l++) {
+        for (int j = 0; j < N; j++) {
+            for (int k = 0; k < K; k++) {
+                expected[l * N + j] += static_cast<double>(A[outputs[l] * K + k]) * B[k * N + j];
+            }
+        }
+    }
+
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0f, A.data(), K, B.data(), N,
+                       1.0f, C.data(), N, outputs.data(), L);
+    for (size_t i = 0; i < C.size(); i++) {
+        ASSERT_NEAR(expected[i], C[i], 1e-4) << "at index " << i;
+    }
+}
+
+TEST(GNAFloatMathTest, sgemvSplitMatchesReference) {
+    const uint32_t N = 300, K1 = 37, K2 = 300;
+    std::mt19937 generator(7);
+    const auto A1 = randomVector(K1, generator);
+    const auto A2 = randomVector(K2, generator);
+    const auto X = randomVector(N * (K1 + K2), generator);
+    const auto B = randomVector(N, generator);
+    std::vector<float> C(N);
+
+    sgemv_split(N, K1, K2, A1.data(), A2.data(), X.data(), B.data(), C.data());
+    for (uint32_t i = 0; i < N; i++) {
+        double expected = B[i];
+        for (uint32_t j = 0; j < K1; j++) {
+            expected += static_cast<double>(A1[j]) * X[i * (K1 + K2) + j];
+        }
+        for (uint32_t j = 0; j < K2; j++) {
+            expected += static_cast<double>(A2[j]) * X[i * (K1 + K2) + K1 + j];
+        }
+        ASSERT_NEAR(expected, C[i], 1e-4) << "at row " << i;
+    }
+}
+
+} // namespace
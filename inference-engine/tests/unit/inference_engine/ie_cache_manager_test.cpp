@@ -0,0 +1,199 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <ctime>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#ifdef _WIN32
+#    include <sys/utime.h>
+#else
+#    include <utime.h>
+#endif
+
+#include "ie_cache_manager.hpp"
+#include "compilation_context.hpp"
+
+#include "common_test_utils/file_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace ::testing;
+using namespace std::chrono;
+
+class FileStorageCacheManagerTests : public Test {
+public:
+    std::string m_cacheDir;
+
+    void SetUp() override {
+        auto testInfo = UnitTest::GetInstance()->current_test_info();
+        std::stringstream ss;
+        ss << "cache_" << testInfo->name() << "_" << std::this_thread::get_id() << "_"
+           << duration_cast<microseconds>(high_resolution_clock::now().time_since_epoch()).count();
+        m_cacheDir = ss.str();
+        CommonTestUtils::createDirectory(m_cacheDir);
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "blob");
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "tmp");
+        CommonTestUtils::removeDir(m_cacheDir);
+    }
+
+    static void writeEntry(ICacheManager& manager, const std::string& id, std::size_t size) {
+        manager.writeCacheEntry(id, [&](std::ostream& stream) {
+            stream << std::string(size, 'a');
+        });
+    }
+
+    // The cache uses modification time of the blob as its last access time
+    void setLastAccess(const std::string& id, std::time_t time) {
+        const auto path = FileUtils::makePath(m_cacheDir, id + ".blob");
+#ifdef _WIN32
+        struct _utimbuf times {time, time};
+        ASSERT_EQ(0, _utime(path.c_str(), &times));
+#else
+        struct utimbuf times {time, time};
+        ASSERT_EQ(0, utime(path.c_str(), &times));
+#endif
+    }
+
+    static bool hasEntry(ICacheManager& manager, const std::string& id) {
+        bool found = false;
+        manager.readCacheEntry(id, [&](std::istream&) {
+            found = true;
+        });
+        return found;
+    }
+};
+
+TEST_F(FileStorageCacheManagerTests, WriteAndRead) {
+    std::shared_ptr<ICacheManager> manager = std::make_shared<FileStorageCacheManager>(std::string(m_cacheDir));
+    writeEntry(*manager, "id1", 10);
+    std::string content;
+    manager->readCacheEntry("id1", [&](std::istream& stream) {
+        stream >> content;
+    });
+    ASSERT_EQ(std::string(10, 'a'), content);
+    ASSERT_TRUE(CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").empty());
+}
+
+TEST_F(FileStorageCacheManagerTests, FailedWriteDoesNotPublishEntry) {
+    std::shared_ptr<ICacheManager> manager = std::make_shared<FileStorageCacheManager>(std::string(m_cacheDir));
+    ASSERT_ANY_THROW(manager->writeCacheEntry("id1", [&](std::ostream& stream) {
+        stream << "partial";
+        throw std::runtime_error("writer failed");
+    }));
+    ASSERT_FALSE(hasEntry(*manager, "id1"));
+    ASSERT_TRUE(CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").empty());
+}
+
+TEST_F(FileStorageCacheManagerTests, NoEvictionWithoutLimit) {
+    std::shared_ptr<ICacheManager> manager = std::make_shared<FileStorageCacheManager>(std::string(m_cacheDir));
+    for (int i = 0; i < 5; i++) {
+        writeEntry(*manager, "id" + std::to_string(i), 100);
+    }
+    ASSERT_EQ(5u, CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size());
+}
+
+TEST_F(FileStorageCacheManagerTests, EvictLeastRecentlyUsed) {
+    std::shared_ptr<ICacheManager> manager = std::make_shared<FileStorageCacheManager>(std::string(m_cacheDir), 250);
+    writeEntry(*manager, "id1", 100);
+    writeEntry(*manager, "id2", 100);
+    const auto now = std::time(nullptr);
+    setLastAccess("id1", now - 200);
+    setLastAccess("id2", now - 100);
+    ASSERT_TRUE(hasEntry(*manager, "id1"));  // id1 becomes most recently used
+    writeEntry(*manager, "id3", 100);
+
+    ASSERT_TRUE(hasEntry(*manager, "id1"));
+    ASSERT_FALSE(hasEntry(*manager, "id2"));
+    ASSERT_TRUE(hasEntry(*manager, "id3"));
+}
+
+////////////////////////////////////////////
+
+TEST(CompiledBlobHeaderTests, ValidChecksum) {
+    std::stringstream stream;
+    CompiledBlobHeader header("version", "fileInfo");
+    header.writeWithData(stream, [](std::ostream& dataStream) {
+        dataStream << std::string(3 << 20, 'b');
+    });
+
+    CompiledBlobHeader readHeader;
+    stream >> readHeader;
+    ASSERT_EQ(header.getDataSize(), readHeader.getDataSize());
+    ASSERT_EQ(header.getChecksum(), readHeader.getChecksum());
+    ASSERT_EQ(static_cast<uint64_t>(3 << 20), readHeader.getDataSize());
+
+    std::string data;
+    ASSERT_TRUE(readHeader.readWithData(stream, [&](std::istream& dataStream) {
+        dataStream >> data;
+    }));
+    ASSERT_EQ(std::string(3 << 20, 'b'), data);
+}
+
+TEST(CompiledBlobHeaderTests, ReaderSeeksAndSkipsData) {
+    std::stringstream stream;
+    CompiledBlobHeader header("version", "fileInfo");
+    header.writeWithData(stream, [](std::ostream& dataStream) {
+        dataStream << std::string(100 << 10, 'b') << "tail";
+    });
+
+    CompiledBlobHeader readHeader;
+    stream >> readHeader;
+    std::string tail(4, ' ');
+    ASSERT_TRUE(readHeader.readWithData(stream, [&](std::istream& dataStream) {
+        // measures the data like the plugins do, then reads a part of it
+        const auto start = dataStream.tellg();
+        dataStream.seekg(-4, std::ios_base::end);
+        dataStream.read(&tail[0], 4);
+        dataStream.seekg(start);
+        std::string head(10, ' ');
+        dataStream.read(&head[0], 10);
+        ASSERT_EQ(std::string(10, 'b'), head);
+    }));
+    ASSERT_EQ("tail", tail);
+}
+
+TEST(CompiledBlobHeaderTests, TruncatedData) {
+    std::stringstream stream;
+    CompiledBlobHeader header("version", "fileInfo");
+    header.writeWithData(stream, [](std::ostream& dataStream) {
+        dataStream << std::string(1000, 'b');
+    });
+    auto content = stream.str();
+    std::stringstream truncated(content.substr(0, content.size() - 1));
+
+    CompiledBlobHeader readHeader;
+    truncated >> readHeader;
+    ASSERT_FALSE(readHeader.readWithData(truncated, [](std::istream& dataStream) {
+        std::string data;
+        dataStream >> data;
+    }));
+}
+
+TEST(CompiledBlobHeaderTests, CorruptedData) {
+    std::stringstream stream;
+    CompiledBlobHeader header("version", "fileInfo");
+    header.writeWithData(stream, [](std::ostream& dataStream) {
+        dataStream << std::string(1000, 'b');
+    });
+    auto content = stream.str();
+    content[content.size() - 10] = 'c';
+    std::stringstream corrupted(content);
+
+    CompiledBlobHeader readHeader;
+    corrupted >> readHeader;
+    // the reader doesn't reach the corrupted part, it is checked afterwards
+    ASSERT_FALSE(readHeader.readWithData(corrupted, [](std::istream& dataStream) {
+        std::string data(10, ' ');
+        dataStream.read(&data[0], 10);
+    }));
+}
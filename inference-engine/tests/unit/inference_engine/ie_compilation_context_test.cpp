@@ -341,6 +341,91 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstantValues) {
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    auto net3 = createNetwork();
+    for (const auto& op : net3.getFunction()->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(op)) {
+            auto newConstant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{1}, {5});
+            newConstant->set_friendly_name(constant->get_friendly_name());
+            newConstant->get_output_tensor(0).set_names(constant->get_output_tensor(0).get_names());
+            ngraph::replace_node(constant, newConstant);
+            break;
+        }
+    }
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentLargeConstantTail) {
+    // Constant exceeds single hashing chunk, so the weights are hashed in parallel chunks
+    auto createNet = [](int8_t lastValue) {
+        const size_t size = (3 << 20) + 17;
+        std::vector<int8_t> values(size, 1);
+        values.back() = lastValue;
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::i8, ngraph::Shape{size});
+        auto constant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{size}, values);
+        auto add = std::make_shared<ngraph::opset6::Add>(data, constant);
+        auto res = std::make_shared<ngraph::opset6::Result>(add);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res},
+                                                             ngraph::ParameterVector{data}));
+    };
+    ASSERT_EQ(NetworkCompilationContext::computeHash(createNet(1), {}),
+              NetworkCompilationContext::computeHash(createNet(1), {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(createNet(1), {}),
+              NetworkCompilationContext::computeHash(createNet(2), {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentAttributes) {
+    auto createNet = [](ngraph::op::AutoBroadcastType broadcast) {
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3});
+        auto constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3}, {1, 2, 3});
+        auto add = std::make_shared<ngraph::opset6::Add>(data, constant, broadcast);
+        auto res = std::make_shared<ngraph::opset6::Result>(add);
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res},
+                                                             ngraph::ParameterVector{data}));
+    };
+    ASSERT_EQ(NetworkCompilationContext::computeHash(createNet(ngraph::op::AutoBroadcastType::NUMPY), {}),
+              NetworkCompilationContext::computeHash(createNet(ngraph::op::AutoBroadcastType::NUMPY), {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(createNet(ngraph::op::AutoBroadcastType::NUMPY), {}),
+              NetworkCompilationContext::computeHash(createNet(ngraph::op::AutoBroadcastType::NONE), {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentNames) {
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    net2.getFunction()->get_parameters().front()->set_friendly_name("NewParameter");
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithTensorNamesInDifferentOrder) {
+    std::vector<std::string> names;
+    for (int i = 0; i < 64; i++) {
+        names.push_back("name_" + std::to_string(i));
+    }
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    auto& tensor1 = net1.getFunction()->get_parameters().front()->get_output_tensor(0);
+    auto& tensor2 = net2.getFunction()->get_parameters().front()->get_output_tensor(0);
+    // the names are inserted one by one in the opposite orders, so the sets are rehashed differently
+    for (auto it = names.begin(); it != names.end(); ++it) {
+        tensor1.add_names({*it});
+    }
+    for (auto it = names.rbegin(); it != names.rend(); ++it) {
+        tensor2.add_names({*it});
+    }
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+
+    tensor2.add_names({"name_64"});
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
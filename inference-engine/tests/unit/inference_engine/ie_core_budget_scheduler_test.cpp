@@ -0,0 +1,222 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <threading/ie_core_budget_scheduler.hpp>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+namespace {
+
+// Runs every task in a separate thread, so the concurrency is limited by the scheduler only
+class ThreadPerTaskExecutor : public IStreamsExecutor {
+public:
+    ~ThreadPerTaskExecutor() override {
+        std::lock_guard<std::mutex> lock{_mutex};
+        for (auto& thread : _threads) {
+            thread.join();
+        }
+    }
+
+    void run(Task task) override {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _threads.emplace_back(std::move(task));
+    }
+
+    void Execute(Task task) override {
+        task();
+    }
+
+    int GetStreamId() override {
+        return 0;
+    }
+
+    int GetNumaNodeId() override {
+        return 0;
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<std::thread> _threads;
+};
+
+CoreBudgetScheduler::NetworkConfig makeConfig(const std::string& name, int priority, int minCores, int coresPerTask) {
+    CoreBudgetScheduler::NetworkConfig config;
+    config._name = name;
+    config._priority = priority;
+    config._minCores = minCores;
+    config._coresPerTask = coresPerTask;
+    return config;
+}
+
+template <typename F>
+std::future<void> async(const ITaskExecutor::Ptr& executor, F&& f) {
+    auto task = std::make_shared<std::packaged_task<void()>>(std::forward<F>(f));
+    auto future = task->get_future();
+    executor->run([task] {
+        (*task)();
+    });
+    return future;
+}
+
+}  // namespace
+
+TEST(CoreBudgetSchedulerTests, dispatchesHighPriorityTasksFirst) {
+    auto executor = std::make_shared<ThreadPerTaskExecutor>();
+    CoreBudgetScheduler scheduler{2};
+    auto low = scheduler.registerNetwork(makeConfig("low", 0, 0, 2), executor);
+    auto high = scheduler.registerNetwork(makeConfig("high", 1, 0, 2), executor);
+
+    std::promise<void> gate;
+    auto gateFuture = gate.get_future().share();
+    auto blocking = async(low, [gateFuture] {
+        gateFuture.wait();
+    });
+
+    std::mutex mutex;
+    std::vector<std::string> order;
+    auto lowTask = async(low, [&] {
+        std::lock_guard<std::mutex> lock{mutex};
+        order.push_back("low");
+    });
+    auto highTask = async(high, [&] {
+        std::lock_guard<std::mutex> lock{mutex};
+        order.push_back("high");
+    });
+    EXPECT_EQ(1u, low->GetStatistics()._waitingTasks);
+    EXPECT_EQ(1u, high->GetStatistics()._waitingTasks);
+
+    gate.set_value();
+    blocking.get();
+    lowTask.get();
+    highTask.get();
+    ASSERT_EQ((std::vector<std::string>{"high", "low"}), order);
+}
+
+TEST(CoreBudgetSchedulerTests, reservedCoresAreAvailableWhenPoolIsBusy) {
+    auto executor = std::make_shared<ThreadPerTaskExecutor>();
+    CoreBudgetScheduler scheduler{4};
+    auto batch = scheduler.registerNetwork(makeConfig("batch", 1, 0, 3), executor);
+    auto latency = scheduler.registerNetwork(makeConfig("latency", 0, 1, 1), executor);
+
+    std::promise<void> gate;
+    auto gateFuture = gate.get_future().share();
+    auto blocking = async(batch, [gateFuture] {
+        gateFuture.wait();
+    });
+    auto batchTask = async(batch, [] {});
+    EXPECT_EQ(1u, batch->GetStatistics()._waitingTasks);
+
+    // the batch network waits for the pool, but the reserved core of the latency network is free
+    auto latencyTask = async(latency, [] {});
+    EXPECT_EQ(std::future_status::ready, latencyTask.wait_for(std::chrono::seconds(10)));
+
+    gate.set_value();
+    blocking.get();
+    batchTask.get();
+    latencyTask.get();
+}
+
+TEST(CoreBudgetSchedulerTests, networkWithoutReservationMakesProgress) {
+    auto executor = std::make_shared<ThreadPerTaskExecutor>();
+    CoreBudgetScheduler scheduler{2};
+    auto greedy = scheduler.registerNetwork(makeConfig("greedy", 1, 100, 1), executor);
+    auto other = scheduler.registerNetwork(makeConfig("other", 0, 0, 4), executor);
+
+    auto task = async(other, [] {});
+    EXPECT_EQ(std::future_status::ready, task.wait_for(std::chrono::seconds(10)));
+    task.get();
+}
+
+TEST(CoreBudgetSchedulerTests, collectsQueueingDelay) {
+    auto executor = std::make_shared<ThreadPerTaskExecutor>();
+    CoreBudgetScheduler scheduler{1};
+    auto network = scheduler.registerNetwork(makeConfig("network", 0, 0, 1), executor);
+
+    std::promise<void> gate;
+    auto gateFuture = gate.get_future().share();
+    auto blocking = async(network, [gateFuture] {
+        gateFuture.wait();
+    });
+    auto waiting = async(network, [] {});
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    gate.set_value();
+    blocking.get();
+    waiting.get();
+
+    const auto statistics = network->GetStatistics();
+    EXPECT_EQ(2u, statistics._dispatchedTasks);
+    EXPECT_EQ(0u, statistics._waitingTasks);
+    EXPECT_GE(statistics._maxDelay, std::chrono::milliseconds(20));
+    EXPECT_GE(statistics._totalDelay, statistics._maxDelay);
+}
+
+TEST(CoreBudgetSchedulerTests, unregistersNetworkWithExecutor) {
+    auto executor = std::make_shared<ThreadPerTaskExecutor>();
+    CoreBudgetScheduler scheduler{2};
+    auto first = scheduler.registerNetwork(makeConfig("first", 0, 0, 1), executor);
+    {
+        auto second = scheduler.registerNetwork(makeConfig("second", 0, 0, 1), executor);
+        ASSERT_EQ(2u, scheduler.getNetworksNumber());
+    }
+    ASSERT_EQ(1u, scheduler.getNetworksNumber());
+}
+
+TEST(CoreBudgetSchedulerTests, syncExecuteWaitsForCoresWithAsyncTasks) {
+    auto executor = std::make_shared<ThreadPerTaskExecutor>();
+    CoreBudgetScheduler scheduler{2};
+    auto low = scheduler.registerNetwork(makeConfig("low", 0, 0, 2), executor);
+    auto high = scheduler.registerNetwork(makeConfig("high", 1, 0, 2), executor);
+
+    std::promise<void> gate;
+    auto gateFuture = gate.get_future().share();
+    auto blocking = async(low, [gateFuture] {
+        gateFuture.wait();
+    });
+
+    std::mutex mutex;
+    std::vector<std::string> order;
+    std::thread::id syncThread;
+    auto sync = std::async(std::launch::async, [&] {
+        high->Execute([&] {
+            std::lock_guard<std::mutex> lock{mutex};
+            order.push_back("high");
+            syncThread = std::this_thread::get_id();
+        });
+        return std::this_thread::get_id();
+    });
+    // the inference in the calling thread waits for the cores of the running network
+    for (int i = 0; i < 1000 && high->GetStatistics()._waitingTasks == 0; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(1u, high->GetStatistics()._waitingTasks);
+    EXPECT_EQ(std::future_status::timeout, sync.wait_for(std::chrono::milliseconds(20)));
+
+    auto lowTask = async(low, [&] {
+        std::lock_guard<std::mutex> lock{mutex};
+        order.push_back("low");
+    });
+    EXPECT_EQ(1u, low->GetStatistics()._waitingTasks);
+
+    gate.set_value();
+    blocking.get();
+    EXPECT_EQ(sync.get(), syncThread);
+    lowTask.get();
+    ASSERT_EQ((std::vector<std::string>{"high", "low"}), order);
+
+    const auto statistics = high->GetStatistics();
+    EXPECT_EQ(1u, statistics._dispatchedTasks);
+    EXPECT_EQ(0u, statistics._waitingTasks);
+    EXPECT_GE(statistics._maxDelay, std::chrono::milliseconds(20));
+}
@@ -36,3 +36,18 @@ TEST(ExecutorManagerTests, returnTheSameExecutorForTheSameDevice) {
     ASSERT_EQ(executor, executor2);
     ASSERT_EQ(2, _manager.getExecutorsNumber());
 }
+
+TEST(ExecutorManagerTests, returnDifferentIdleStreamsExecutorsForWorkStealingMode) {
+    ExecutorManagerImpl _manager;
+    IStreamsExecutor::Config config{"CPUStreamsExecutor", 2, 1};
+    auto plain = _manager.getIdleCPUStreamsExecutor(config).get();
+    // the executor above is idle now, but it doesn't match the work stealing config
+    config._workStealing = true;
+    auto workStealing = _manager.getIdleCPUStreamsExecutor(config).get();
+
+    ASSERT_NE(plain, workStealing);
+    ASSERT_EQ(2u, _manager.getIdleCPUStreamsExecutorsNumber());
+    ASSERT_EQ(workStealing, _manager.getIdleCPUStreamsExecutor(config).get());
+    config._workStealing = false;
+    ASSERT_EQ(plain, _manager.getIdleCPUStreamsExecutor(config).get());
+}
@@ -0,0 +1,105 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_preprocess_lru_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace {
+
+// precision, color format and dims of a preprocessing call
+using CallKey = std::tuple<std::string, std::string, std::vector<size_t>>;
+
+struct Compiled {
+    CallKey compiledFor;
+    int compilations = 0;
+};
+
+using Cache = LruCache<CallKey, Compiled>;
+
+const CallKey u8Bgr720p {"U8", "BGR", {1, 3, 720, 1280}};
+const CallKey u8Bgr1080p {"U8", "BGR", {1, 3, 1080, 1920}};
+const CallKey u8Nv12720p {"U8", "NV12", {1, 3, 720, 1280}};
+const CallKey fp32Bgr720p {"FP32", "BGR", {1, 3, 720, 1280}};
+
+const CallKey newEntry {};
+
+// Compiles the value for the key, returns the key the value was compiled for before
+CallKey compile(Cache& cache, const CallKey& key) {
+    CallKey previous = newEntry;
+    cache.access(key, [&](Compiled& compiled, const CallKey* builtFor) {
+        if (builtFor != nullptr)
+            previous = *builtFor;
+        if (builtFor == nullptr || *builtFor != key) {
+            compiled.compiledFor = key;
+            compiled.compilations++;
+        }
+    });
+    return previous;
+}
+
+}  // namespace
+
+TEST(PreprocLruCacheTest, HitsOnSameShapeFormatAndPrecision) {
+    Cache cache(4);
+    EXPECT_EQ(newEntry, compile(cache, u8Bgr720p));
+    for (const auto& key : {u8Nv12720p, fp32Bgr720p, u8Bgr1080p}) {
+        EXPECT_EQ(newEntry, compile(cache, key));
+    }
+    ASSERT_EQ(4u, cache.size());
+
+    int compilations = 0;
+    cache.access(u8Bgr720p, [&](Compiled& compiled, const CallKey* builtFor) {
+        ASSERT_NE(nullptr, builtFor);
+        EXPECT_EQ(u8Bgr720p, *builtFor);
+        EXPECT_EQ(u8Bgr720p, compiled.compiledFor);
+        compilations = compiled.compilations;
+    });
+    EXPECT_EQ(1, compilations);
+    EXPECT_EQ(4u, cache.size());
+}
+
+TEST(PreprocLruCacheTest, EvictsLeastRecentlyUsedEntryAtCapacity) {
+    Cache cache(2);
+    compile(cache, u8Bgr720p);
+    compile(cache, u8Bgr1080p);
+    // 720p becomes the most recently used one
+    compile(cache, u8Bgr720p);
+
+    // the value of the evicted 1080p entry is handed over to the new key
+    EXPECT_EQ(u8Bgr1080p, compile(cache, fp32Bgr720p));
+
+    EXPECT_EQ(2u, cache.size());
+    EXPECT_TRUE(cache.contains(u8Bgr720p));
+    EXPECT_TRUE(cache.contains(fp32Bgr720p));
+    EXPECT_FALSE(cache.contains(u8Bgr1080p));
+}
+
+TEST(PreprocLruCacheTest, DropsEntryWhenCompilationThrows) {
+    Cache cache(2);
+    compile(cache, u8Bgr720p);
+
+    auto failingCompile = [](Compiled&, const CallKey*) {
+        throw std::runtime_error("compilation failed");
+    };
+    EXPECT_THROW(cache.access(u8Bgr1080p, failingCompile), std::runtime_error);
+    EXPECT_EQ(1u, cache.size());
+    EXPECT_FALSE(cache.contains(u8Bgr1080p));
+    // the next call compiles from scratch instead of using the partially compiled value
+    EXPECT_EQ(newEntry, compile(cache, u8Bgr1080p));
+
+    // the evicted entry is partially overwritten by the failed compilation, so it is dropped as well
+    EXPECT_THROW(cache.access(u8Nv12720p, failingCompile), std::runtime_error);
+    EXPECT_EQ(1u, cache.size());
+    EXPECT_FALSE(cache.contains(u8Nv12720p));
+    EXPECT_FALSE(cache.contains(u8Bgr720p));
+    EXPECT_TRUE(cache.contains(u8Bgr1080p));
+}
@@ -10,6 +10,7 @@
 #include <ir_frontend/utility.hpp>
 #include <ngraph/variant.hpp>
 #include <openvino/util/file_util.hpp>
+#include <openvino/util/mmap_object.hpp>
 #include <vector>
 
 using namespace ngraph;
@@ -52,6 +53,38 @@ size_t GetIRVersion(std::istream& model) {
     return 0;
 }
 
+namespace {
+
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+ov::Weights read_weights(const std::wstring& weights_path) {
+#else
+ov::Weights read_weights(const std::string& weights_path) {
+#endif
+    std::ifstream bin_stream;
+    bin_stream.open(weights_path, std::ios::binary);
+    if (!bin_stream.is_open())
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+        IR_THROW("Weights file " + ov::util::wstring_to_string(weights_path) + " cannot be opened!");
+#else
+        IR_THROW("Weights file " + weights_path + " cannot be opened!");
+#endif
+
+    bin_stream.seekg(0, std::ios::end);
+    size_t file_size = bin_stream.tellg();
+    bin_stream.seekg(0, std::ios::beg);
+
+    auto aligned_weights_buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(file_size);
+    bin_stream.read(aligned_weights_buffer->get_ptr<char>(), aligned_weights_buffer->size());
+    bin_stream.close();
+
+    return std::make_shared<runtime::SharedBuffer<std::shared_ptr<runtime::AlignedBuffer>>>(
+        aligned_weights_buffer->get_ptr<char>(),
+        aligned_weights_buffer->size(),
+        aligned_weights_buffer);
+}
+
+}  // namespace
+
 bool FrontEndIR::supported_impl(const std::vector<std::shared_ptr<Variant>>& variants) const {
     std::ifstream local_model_stream;
     std::istream* provided_model_stream = nullptr;
@@ -174,27 +207,24 @@ InputModel::Ptr FrontEndIR::load_impl(const std::vector<std::shared_ptr<Variant>
     }
 
     if (!weights_path.empty()) {
-        std::ifstream bin_stream;
-        bin_stream.open(weights_path, std::ios::binary);
-        if (!bin_stream.is_open())
-#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-            IR_THROW("Weights file " + ov::util::wstring_to_string(weights_path) + " cannot be opened!");
-#else
-            IR_THROW("Weights file " + weights_path + " cannot be opened!");
-#endif
-
-        bin_stream.seekg(0, std::ios::end);
-        size_t file_size = bin_stream.tellg();
-        bin_stream.seekg(0, std::ios::beg);
-
-        auto aligned_weights_buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(file_size);
-        bin_stream.read(aligned_weights_buffer->get_ptr<char>(), aligned_weights_buffer->size());
-        bin_stream.close();
+        // Map weights file instead of reading it: Constants created by the deserializer point directly
+        // into the mapping, so the model is read without copying weights and the pages are shared
+        // between processes which read the same model
+        std::shared_ptr<ov::util::MappedMemory> mapped_weights;
+        try {
+            mapped_weights = ov::util::load_mmap_object(weights_path);
+        } catch (const std::exception&) {
+            // Some file systems don't support mapping, fall back to reading the whole file
+        }
 
-        weights = std::make_shared<runtime::SharedBuffer<std::shared_ptr<runtime::AlignedBuffer>>>(
-            aligned_weights_buffer->get_ptr<char>(),
-            aligned_weights_buffer->size(),
-            aligned_weights_buffer);
+        if (mapped_weights && mapped_weights->data()) {
+            weights = std::make_shared<runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+                mapped_weights->data(),
+                mapped_weights->size(),
+                mapped_weights);
+        } else {
+            weights = read_weights(weights_path);
+        }
     }
 
     return create_input_model();
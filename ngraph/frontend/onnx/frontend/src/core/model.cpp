@@ -26,7 +26,9 @@ std::int64_t get_opset_version(const ONNX_NAMESPACE::ModelProto& model_proto, co
     throw ngraph_error("Couldn't find operator set's version for domain: " + domain + ".");
 }
 
-Model::Model(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto) : m_model_proto{model_proto} {
+Model::Model(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto)
+    : m_model_proto{model_proto},
+      m_mmap_cache{std::make_shared<std::map<std::string, std::shared_ptr<ov::util::MappedMemory>>>()} {
     // Walk through the elements of opset_import field and register operator sets
     // for each domain. An exception UnknownDomain() will raise if the domain is
     // unknown or invalid.
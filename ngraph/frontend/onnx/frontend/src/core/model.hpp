@@ -11,6 +11,7 @@
 #include <unordered_map>
 
 #include "onnx_import/core/operator_set.hpp"
+#include "utils/tensor_external_data.hpp"
 
 namespace ngraph {
 namespace onnx_import {
@@ -45,6 +46,15 @@ public:
     const std::string& get_producer_version() const {
         return m_model_proto->producer_version();
     }
+    /// \brief The model proto, Constants created from its initializers keep it alive
+    ///        and point directly to the tensors data.
+    const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& get_model_proto() const {
+        return m_model_proto;
+    }
+    /// \brief Memory mappings of the external data files, shared by all initializers of the model
+    const detail::MappedMemoryHandles& get_mmap_cache() const {
+        return m_mmap_cache;
+    }
 
     /// \brief Access an operator object by its type name and domain name
     /// The function will return the operator object if it exists, or report an error
@@ -74,6 +84,7 @@ public:
 private:
     const std::shared_ptr<ONNX_NAMESPACE::ModelProto> m_model_proto;
     std::unordered_map<std::string, OperatorSet> m_opset;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Model& model) {
@@ -7,6 +7,8 @@
 #include <onnx/onnx_pb.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -352,9 +354,20 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor) : Tensor(tensor, nullptr, nullptr) {}
+
+    /// \brief      Tensor whose Constant shares the data with the model instead of copying it
+    ///
+    /// \param[in]  tensor        The tensor owned by model_proto.
+    /// \param[in]  model_proto   The model kept alive by the Constants which point to its raw data.
+    /// \param[in]  mmap_cache    Mappings of the external data files shared by the tensors of the model.
+    Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+           std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto,
+           detail::MappedMemoryHandles mmap_cache)
         : m_tensor_proto{&tensor},
-          m_shape{std::begin(tensor.dims()), std::end(tensor.dims())} {
+          m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
+          m_model_proto{std::move(model_proto)},
+          m_mmap_cache{std::move(mmap_cache)} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -471,15 +484,60 @@ public:
 private:
     template <typename T>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
-        auto constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+        if (m_tensor_proto->has_segment()) {
+            throw error::tensor::segments_unsupported{};
+        }
+        std::shared_ptr<ngraph::op::Constant> constant;
+        if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto)) {
+            constant = make_external_data_constant(type);
+        } else if (m_tensor_proto->has_raw_data()) {
+            constant = make_raw_data_constant(type);
+        }
+        // the data stored in typed fields or not matching the shape exactly (e.g. a single value
+        // which is broadcasted) is converted element by element
+        if (!constant) {
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+        }
         if (m_tensor_proto->has_name()) {
             constant->set_friendly_name(get_name());
         }
         return constant;
     }
 
+    static bool is_aligned(const char* data, const element::Type& type) {
+        return reinterpret_cast<std::uintptr_t>(data) % type.size() == 0;
+    }
+
+    std::shared_ptr<ngraph::op::Constant> make_raw_data_constant(const element::Type& type) const {
+        const auto& raw_data = m_tensor_proto->raw_data();
+        if (raw_data.size() != shape_size(m_shape) * type.size()) {
+            return nullptr;
+        }
+        if (m_model_proto && is_aligned(raw_data.data(), type)) {
+            auto buffer = std::make_shared<runtime::SharedBuffer<std::shared_ptr<ONNX_NAMESPACE::ModelProto>>>(
+                const_cast<char*>(raw_data.data()),
+                raw_data.size(),
+                m_model_proto);
+            return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+        }
+        return std::make_shared<ngraph::op::Constant>(type, m_shape, raw_data.data());
+    }
+
+    std::shared_ptr<ngraph::op::Constant> make_external_data_constant(const element::Type& type) const {
+        const auto buffer = detail::TensorExternalData(*m_tensor_proto).load_external_mmap_data(m_mmap_cache);
+        if (!buffer || buffer->size() != shape_size(m_shape) * type.size()) {
+            return nullptr;
+        }
+        if (is_aligned(buffer->get_ptr<char>(), type)) {
+            return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+        }
+        return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer->get_ptr());
+    }
+
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
     Shape m_shape;
+    std::shared_ptr<ONNX_NAMESPACE::ModelProto> m_model_proto;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
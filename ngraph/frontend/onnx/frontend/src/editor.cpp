@@ -202,6 +202,14 @@ struct onnx_editor::ONNXModelEditor::Impl {
     Impl(const std::wstring& model_path)
         : m_model_proto{std::make_shared<ONNX_NAMESPACE::ModelProto>(onnx_common::parse_from_file(model_path))} {}
 #endif
+
+    /// \brief Constants of the functions converted from the model point directly to its initializers data
+    ///        and share the ownership of the model, so it's copied before modification if it's shared.
+    void make_model_proto_unique() {
+        if (m_model_proto.use_count() > 1) {
+            m_model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>(*m_model_proto);
+        }
+    }
 };
 
 onnx_editor::ONNXModelEditor::ONNXModelEditor(const std::string& model_path)
@@ -243,6 +251,7 @@ void onnx_editor::ONNXModelEditor::serialize(const std::string& out_file_path) c
 }
 
 void onnx_editor::ONNXModelEditor::set_input_types(const std::map<std::string, element::Type_t>& input_types) {
+    m_pimpl->make_model_proto_unique();
     auto* onnx_graph = m_pimpl->m_model_proto->mutable_graph();
 
     for (const auto& input_desc : input_types) {
@@ -257,6 +266,7 @@ void onnx_editor::ONNXModelEditor::set_input_types(const std::map<std::string, e
 }
 
 void onnx_editor::ONNXModelEditor::set_input_shapes(const std::map<std::string, ngraph::PartialShape>& input_shapes) {
+    m_pimpl->make_model_proto_unique();
     auto* onnx_graph = m_pimpl->m_model_proto->mutable_graph();
 
     for (const auto& input_desc : input_shapes) {
@@ -312,6 +322,7 @@ void onnx_editor::ONNXModelEditor::cut_graph_fragment(const std::vector<InputEdg
         return;
     }
 
+    m_pimpl->make_model_proto_unique();
     InferShapesAutoRelease onnx_shapes(m_pimpl->m_model_proto);
     onnx_shapes.infer_shapes();
 
@@ -390,6 +401,7 @@ std::shared_ptr<Function> onnx_editor::ONNXModelEditor::get_function() const {
 
 void onnx_editor::ONNXModelEditor::set_input_values(
     const std::map<std::string, std::shared_ptr<ngraph::op::Constant>>& input_values) {
+    m_pimpl->make_model_proto_unique();
     auto onnx_graph = m_pimpl->m_model_proto->mutable_graph();
 
     for (const auto& input : input_values) {
@@ -4,6 +4,7 @@
 
 #include "utils/tensor_external_data.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 
@@ -67,6 +68,51 @@ std::string TensorExternalData::load_external_data() const {
     return read_data;
 }
 
+Buffer<ov::util::MappedMemory> TensorExternalData::load_external_mmap_data(const MappedMemoryHandles& cache) const {
+    std::shared_ptr<ov::util::MappedMemory> mapped_memory;
+    if (cache) {
+        const auto cached = cache->find(m_data_location);
+        if (cached != cache->end()) {
+            mapped_memory = cached->second;
+        }
+    }
+    if (!mapped_memory) {
+        try {
+            NGRAPH_SUPPRESS_DEPRECATED_START
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+            mapped_memory = ov::util::load_mmap_object(ov::util::string_to_wstring(m_data_location));
+#else
+            mapped_memory = ov::util::load_mmap_object(m_data_location);
+#endif
+            NGRAPH_SUPPRESS_DEPRECATED_END
+        } catch (const std::exception&) {
+            // Some file systems don't support mapping, the caller falls back to reading the file
+            return nullptr;
+        }
+        if (!mapped_memory || !mapped_memory->data()) {
+            return nullptr;
+        }
+        if (cache) {
+            cache->emplace(m_data_location, mapped_memory);
+        }
+    }
+
+    const auto file_size = mapped_memory->size();
+    const size_t offset = m_offset;
+    const size_t data_length = m_data_length == 0 ? file_size - std::min<size_t>(offset, file_size) : m_data_length;
+    if (m_offset < 0 || m_data_length < 0 || offset > file_size || data_length > file_size - offset)
+        throw error::invalid_external_data{*this};
+
+    if (m_sha1_digest != 0) {
+        NGRAPH_WARN << "SHA1 checksum is not supported";
+    }
+
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+        mapped_memory->data() + offset,
+        data_length,
+        mapped_memory);
+}
+
 std::string TensorExternalData::to_string() const {
     std::stringstream s;
     s << "ExternalDataInfo(";
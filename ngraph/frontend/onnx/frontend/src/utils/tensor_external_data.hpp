@@ -6,9 +6,22 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+template <class T>
+using Buffer = std::shared_ptr<ngraph::runtime::SharedBuffer<std::shared_ptr<T>>>;
+
+/// \brief Memory mappings of the external data files of a model, the key is the file location
+using MappedMemoryHandles = std::shared_ptr<std::map<std::string, std::shared_ptr<ov::util::MappedMemory>>>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -23,6 +36,16 @@ public:
     /// \return     External binary data loaded into a std::string
     std::string load_external_data() const;
 
+    /// \brief      Map the external file and return a buffer which points to the tensor data in the mapping
+    ///
+    /// \param      cache  Mappings of the already used external files, the file is mapped once for all
+    ///                    the tensors which refer to it. If nullptr the mapping is owned by the buffer only.
+    ///
+    /// \note       If the data is out of the file bounds, the invalid_external_data exception is thrown.
+    ///
+    /// \return     Buffer which keeps the mapping alive or nullptr if the file can't be mapped
+    Buffer<ov::util::MappedMemory> load_external_mmap_data(const MappedMemoryHandles& cache) const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/mmap_object.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+using namespace std;
+
+namespace {
+string create_test_file(const string& name, const string& content) {
+    ofstream out(name, ios::binary);
+    out << content;
+    return name;
+}
+}  // namespace
+
+TEST(mmap_object, read_content) {
+    const auto file_name = create_test_file("mmap_object_read_content.bin", "0123456789");
+    {
+        auto mapped = ov::util::load_mmap_object(file_name);
+        ASSERT_NE(nullptr, mapped);
+        ASSERT_EQ(10u, mapped->size());
+        EXPECT_EQ("0123456789", string(mapped->data(), mapped->size()));
+    }
+    remove(file_name.c_str());
+}
+
+TEST(mmap_object, write_does_not_modify_file) {
+    const auto file_name = create_test_file("mmap_object_copy_on_write.bin", "0123456789");
+    {
+        auto mapped = ov::util::load_mmap_object(file_name);
+        mapped->data()[0] = 'x';
+        EXPECT_EQ('x', mapped->data()[0]);
+    }
+    {
+        ifstream in(file_name, ios::binary);
+        string content;
+        in >> content;
+        EXPECT_EQ("0123456789", content);
+    }
+    remove(file_name.c_str());
+}
+
+TEST(mmap_object, empty_file) {
+    const auto file_name = create_test_file("mmap_object_empty.bin", "");
+    {
+        auto mapped = ov::util::load_mmap_object(file_name);
+        EXPECT_EQ(0u, mapped->size());
+    }
+    remove(file_name.c_str());
+}
+
+TEST(mmap_object, not_existing_file) {
+    EXPECT_THROW(ov::util::load_mmap_object("mmap_object_not_existing.bin"), std::runtime_error);
+}
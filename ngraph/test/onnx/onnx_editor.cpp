@@ -1206,6 +1206,29 @@ NGRAPH_TEST(onnx_editor, values__modify_two_initializers) {
     test_case.run();
 }
 
+NGRAPH_TEST(onnx_editor, values__modify_initializer_of_converted_model) {
+    onnx_editor::ONNXModelEditor editor{
+        file_util::path_join(SERIALIZED_ZOO, "onnx/model_editor/add_1D_with_initializers.onnx")};
+    std::map<std::string, std::shared_ptr<ngraph::op::Constant>> in_vals;
+
+    in_vals["B"] = op::Constant::create(element::i64, Shape{2}, {3, 4});
+    editor.set_input_values(in_vals);
+    // Constants of the converted function point directly to the initializers data of the model
+    const auto function = editor.get_function();
+
+    in_vals["B"] = op::Constant::create(element::i64, Shape{2}, {10, 20});
+    editor.set_input_values(in_vals);
+    const auto modified_function = editor.get_function();
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    test_case.add_expected_output<int64_t>(Shape{2}, {4, 6});
+    test_case.run();
+
+    auto modified_test_case = test::TestCase<TestEngine>(modified_function);
+    modified_test_case.add_expected_output<int64_t>(Shape{2}, {11, 22});
+    modified_test_case.run();
+}
+
 NGRAPH_TEST(onnx_editor, values__no_inputs_modify_two_initializers) {
     onnx_editor::ONNXModelEditor editor{
         file_util::path_join(SERIALIZED_ZOO, "onnx/model_editor/add_1D_with_initializers_only.onnx")};
@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific memory mapped files
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/util/file_util.hpp"
+
+namespace ov {
+namespace util {
+
+/// \brief Memory mapped view of a whole file.
+///
+/// Mapping is copy-on-write: pages are shared with the OS page cache (and other processes
+/// mapping the same file) until someone writes to them, the file itself is never modified.
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+
+    /// \brief Pointer to the beginning of mapped file content
+    virtual char* data() noexcept = 0;
+
+    /// \brief Size of mapped file in bytes
+    virtual size_t size() const noexcept = 0;
+};
+
+/// \brief Maps the whole file into memory
+/// \param path Path to the file
+/// \return Mapped memory object, the mapping is released when the object is destroyed
+/// \throw std::runtime_error if the file can't be opened or mapped
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+/// \brief Maps the whole file with UNICODE path into memory
+/// \param path Path to the file
+/// \return Mapped memory object, the mapping is released when the object is destroyed
+/// \throw std::runtime_error if the file can't be opened or mapped
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path);
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
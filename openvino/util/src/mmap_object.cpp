@@ -0,0 +1,192 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/mmap_object.hpp"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace ov {
+namespace util {
+
+#ifdef _WIN32
+
+class HandleHolder {
+    HANDLE m_handle = INVALID_HANDLE_VALUE;
+
+public:
+    explicit HandleHolder(HANDLE handle = INVALID_HANDLE_VALUE) : m_handle(handle) {}
+    HandleHolder(const HandleHolder&) = delete;
+    HandleHolder& operator=(const HandleHolder&) = delete;
+    ~HandleHolder() {
+        reset();
+    }
+
+    void reset(HANDLE handle = INVALID_HANDLE_VALUE) {
+        if (m_handle != INVALID_HANDLE_VALUE && m_handle != nullptr) {
+            ::CloseHandle(m_handle);
+        }
+        m_handle = handle;
+    }
+
+    HANDLE get() const noexcept {
+        return m_handle;
+    }
+};
+
+class MapHolder : public MappedMemory {
+    void* m_data = nullptr;
+    size_t m_size = 0;
+    HandleHolder m_file;
+    HandleHolder m_mapping;
+
+public:
+    template <typename C>
+    void set(const std::basic_string<C>& path, HANDLE file) {
+        m_file.reset(file);
+        if (m_file.get() == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Can not open file " + to_string(path) + " for mapping");
+        }
+        LARGE_INTEGER file_size;
+        if (!::GetFileSizeEx(m_file.get(), &file_size)) {
+            throw std::runtime_error("Can not get size of file " + to_string(path));
+        }
+        m_size = static_cast<size_t>(file_size.QuadPart);
+        if (m_size == 0) {
+            return;
+        }
+        m_mapping.reset(::CreateFileMapping(m_file.get(), nullptr, PAGE_WRITECOPY, 0, 0, nullptr));
+        if (m_mapping.get() == nullptr) {
+            throw std::runtime_error("Can not create file mapping for " + to_string(path));
+        }
+        m_data = ::MapViewOfFile(m_mapping.get(), FILE_MAP_COPY, 0, 0, 0);
+        if (m_data == nullptr) {
+            throw std::runtime_error("Can not map file " + to_string(path));
+        }
+    }
+
+    ~MapHolder() override {
+        if (m_data) {
+            ::UnmapViewOfFile(m_data);
+        }
+    }
+
+    char* data() noexcept override {
+        return static_cast<char*>(m_data);
+    }
+
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    static std::string to_string(const std::string& path) {
+        return path;
+    }
+#    ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+    static std::string to_string(const std::wstring& path) {
+        return wstring_to_string(path);
+    }
+#    endif
+};
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path,
+                ::CreateFileA(path.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr));
+    return holder;
+}
+
+#    ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path,
+                ::CreateFileW(path.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr));
+    return holder;
+}
+#    endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+#else  // _WIN32
+
+class MapHolder : public MappedMemory {
+    void* m_data = MAP_FAILED;
+    size_t m_size = 0;
+
+public:
+    void set(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1) {
+            throw std::runtime_error("Can not open file " + path + " for mapping");
+        }
+        struct stat sb = {};
+        if (::fstat(fd, &sb) == -1) {
+            ::close(fd);
+            throw std::runtime_error("Can not get size of file " + path);
+        }
+        m_size = static_cast<size_t>(sb.st_size);
+        if (m_size > 0) {
+            // Private writable mapping: plugins modifying constants in place get their own copy of touched pages
+            m_data = ::mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        }
+        // Mapping stays valid after the descriptor is closed
+        ::close(fd);
+        if (m_size > 0 && m_data == MAP_FAILED) {
+            throw std::runtime_error("Can not map file " + path);
+        }
+    }
+
+    ~MapHolder() override {
+        if (m_data != MAP_FAILED) {
+            ::munmap(m_data, m_size);
+        }
+    }
+
+    char* data() noexcept override {
+        return m_data != MAP_FAILED ? static_cast<char*>(m_data) : nullptr;
+    }
+
+    size_t size() const noexcept override {
+        return m_size;
+    }
+};
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path);
+    return holder;
+}
+
+#    ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
+    return load_mmap_object(wstring_to_string(path));
+}
+#    endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+#endif  // _WIN32
+
+}  // namespace util
+}  // namespace ov